@@ -1,17 +1,61 @@
 // Copyright Hkt Studios, Inc. All Rights Reserved.
 
 #include "Modules/ModuleManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "VM/HktVMProgram.h"
 
 class FHktCoreModule : public IModuleInterface
 {
 public:
 	virtual void StartupModule() override
 	{
+		// 등록된 Flow → AOT 네이티브 C++ (HktVMNativeGenerated.cpp로 저장 후 모듈과 함께 빌드)
+		ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+			TEXT("hkt.VM.GenerateNative"),
+			TEXT("Transpile registered VM flows to C++. Usage: hkt.VM.GenerateNative <OutputFile>"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+			{
+				if (Args.Num() == 0)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[VM Native] Usage: hkt.VM.GenerateNative <OutputFile>"));
+					return;
+				}
+
+				TArray<const FHktVMProgram*> Programs;
+				FHktVMProgramRegistry::Get().ForEachProgram([&Programs](const FHktVMProgram& Program)
+				{
+					Programs.Add(&Program);
+				});
+
+				const FString Source = FHktVMTranspiler::GenerateSource(Programs);
+				if (FFileHelper::SaveStringToFile(Source, *Args[0], FFileHelper::EEncodingOptions::ForceUTF8))
+				{
+					UE_LOG(LogTemp, Log, TEXT("[VM Native] Generated %d flows to %s"), Programs.Num(), *Args[0]);
+				}
+				else
+				{
+					UE_LOG(LogTemp, Error, TEXT("[VM Native] Failed to write %s"), *Args[0]);
+				}
+			}),
+			ECVF_Default
+		));
 	}
 
 	virtual void ShutdownModule() override
 	{
+		for (IConsoleObject* Cmd : ConsoleCommands)
+		{
+			if (Cmd)
+			{
+				IConsoleManager::Get().UnregisterConsoleObject(Cmd);
+			}
+		}
+		ConsoleCommands.Empty();
 	}
+
+private:
+	TArray<IConsoleObject*> ConsoleCommands;
 };
 
 IMPLEMENT_MODULE(FHktCoreModule, HktCore)
@@ -0,0 +1,188 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "HktFixedMath.h"
+
+namespace
+{
+    /**
+     * sin(i/256 × 90°) × 65536, i = 0..256
+     * 런타임 libm(sinf)은 플랫폼마다 마지막 비트가 다를 수 있어 값을 직접 고정
+     */
+    constexpr int32 SinTable[257] =
+    {
+            0,   402,   804,  1206,  1608,  2010,  2412,  2814,
+         3216,  3617,  4019,  4420,  4821,  5222,  5623,  6023,
+         6424,  6824,  7224,  7623,  8022,  8421,  8820,  9218,
+         9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391,
+        12785, 13180, 13573, 13966, 14359, 14751, 15143, 15534,
+        15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+        19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699,
+        22078, 22457, 22834, 23210, 23586, 23961, 24335, 24708,
+        25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+        28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538,
+        30893, 31248, 31600, 31952, 32303, 32652, 33000, 33347,
+        33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+        36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716,
+        39040, 39362, 39683, 40002, 40320, 40636, 40951, 41264,
+        41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+        44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056,
+        46341, 46624, 46906, 47186, 47464, 47741, 48015, 48288,
+        48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+        50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398,
+        52639, 52878, 53114, 53349, 53581, 53812, 54040, 54267,
+        54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+        56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607,
+        57798, 57986, 58172, 58356, 58538, 58718, 58896, 59071,
+        59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+        60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568,
+        61705, 61839, 61971, 62101, 62228, 62353, 62476, 62596,
+        62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+        63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197,
+        64277, 64354, 64429, 64501, 64571, 64639, 64704, 64766,
+        64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+        65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436,
+        65457, 65476, 65492, 65505, 65516, 65525, 65531, 65535,
+        65536,
+    };
+
+    /** atan(i/256) (이진 각도), i = 0..256 - 256 = 45° = 8192 */
+    constexpr int32 AtanTable[257] =
+    {
+            0,    41,    81,   122,   163,   204,   244,   285,
+          326,   367,   407,   448,   489,   529,   570,   610,
+          651,   692,   732,   773,   813,   854,   894,   935,
+          975,  1015,  1056,  1096,  1136,  1177,  1217,  1257,
+         1297,  1337,  1377,  1417,  1457,  1497,  1537,  1577,
+         1617,  1656,  1696,  1736,  1775,  1815,  1854,  1894,
+         1933,  1973,  2012,  2051,  2090,  2129,  2168,  2207,
+         2246,  2285,  2324,  2363,  2401,  2440,  2478,  2517,
+         2555,  2594,  2632,  2670,  2708,  2746,  2784,  2822,
+         2860,  2897,  2935,  2973,  3010,  3047,  3085,  3122,
+         3159,  3196,  3233,  3270,  3307,  3344,  3380,  3417,
+         3453,  3490,  3526,  3562,  3599,  3635,  3670,  3706,
+         3742,  3778,  3813,  3849,  3884,  3920,  3955,  3990,
+         4025,  4060,  4095,  4129,  4164,  4199,  4233,  4267,
+         4302,  4336,  4370,  4404,  4438,  4471,  4505,  4539,
+         4572,  4605,  4639,  4672,  4705,  4738,  4771,  4803,
+         4836,  4869,  4901,  4933,  4966,  4998,  5030,  5062,
+         5094,  5125,  5157,  5188,  5220,  5251,  5282,  5313,
+         5344,  5375,  5406,  5437,  5467,  5498,  5528,  5559,
+         5589,  5619,  5649,  5679,  5708,  5738,  5768,  5797,
+         5826,  5856,  5885,  5914,  5943,  5972,  6000,  6029,
+         6058,  6086,  6114,  6142,  6171,  6199,  6227,  6254,
+         6282,  6310,  6337,  6365,  6392,  6419,  6446,  6473,
+         6500,  6527,  6554,  6580,  6607,  6633,  6660,  6686,
+         6712,  6738,  6764,  6790,  6815,  6841,  6867,  6892,
+         6917,  6943,  6968,  6993,  7018,  7043,  7068,  7092,
+         7117,  7141,  7166,  7190,  7214,  7238,  7262,  7286,
+         7310,  7334,  7358,  7381,  7405,  7428,  7451,  7475,
+         7498,  7521,  7544,  7566,  7589,  7612,  7635,  7657,
+         7679,  7702,  7724,  7746,  7768,  7790,  7812,  7834,
+         7856,  7877,  7899,  7920,  7942,  7963,  7984,  8005,
+         8026,  8047,  8068,  8089,  8110,  8131,  8151,  8172,
+         8192,
+    };
+
+    /** 테이블 + 선형 보간: Index는 0..256 구간, Frac은 FracBits 비트 */
+    FORCEINLINE int32 Lerp(const int32* Table, int32 Index, int32 Frac, int32 FracBits)
+    {
+        return Table[Index] + (((Table[Index + 1] - Table[Index]) * Frac) >> FracBits);
+    }
+}
+
+namespace HktMath
+{
+    uint64 SqrtU64(uint64 V)
+    {
+        uint64 Result = 0;
+        uint64 Bit = 1ull << 62;
+        while (Bit > V)
+        {
+            Bit >>= 2;
+        }
+        while (Bit != 0)
+        {
+            if (V >= Result + Bit)
+            {
+                V -= Result + Bit;
+                Result = (Result >> 1) + Bit;
+            }
+            else
+            {
+                Result >>= 1;
+            }
+            Bit >>= 2;
+        }
+        return Result;
+    }
+
+    FHktFixed Sqrt(FHktFixed V)
+    {
+        // sqrt(Raw / 2^16) × 2^16 = sqrt(Raw × 2^16)
+        return V.Raw > 0 ? FHktFixed::FromRaw(static_cast<int32>(SqrtU64(static_cast<uint64>(V.Raw) << FHktFixed::FracBits))) : FHktFixed();
+    }
+
+    uint64 DistanceSquared(const FIntVector& A, const FIntVector& B)
+    {
+        uint64 Sum = 0;
+        auto Accumulate = [&Sum](int32 From, int32 To)
+        {
+            const int64 D = static_cast<int64>(To) - From;
+            const uint64 AbsD = static_cast<uint64>(D < 0 ? -D : D);
+            const uint64 Sq = AbsD * AbsD;
+            Sum = (Sum > UINT64_MAX - Sq) ? UINT64_MAX : Sum + Sq;
+        };
+        Accumulate(A.X, B.X);
+        Accumulate(A.Y, B.Y);
+        Accumulate(A.Z, B.Z);
+        return Sum;
+    }
+
+    int32 Distance(const FIntVector& A, const FIntVector& B)
+    {
+        return static_cast<int32>(FMath::Min<uint64>(SqrtU64(DistanceSquared(A, B)), INT32_MAX));
+    }
+
+    FHktFixed Sin(int32 Angle)
+    {
+        // 16비트 각도 = [사분면:2][사분면 내 위치:14], 위치 = [테이블 인덱스:8][보간:6]
+        const uint32 A = static_cast<uint32>(Angle) & (AngleFullTurn - 1);
+        const uint32 Quadrant = A >> 14;
+        const int32 InQuadrant = static_cast<int32>(A & (AngleQuarterTurn - 1));
+
+        // 2, 4 사분면은 90°에서 거꾸로 읽음 (0..16384)
+        const int32 P = (Quadrant & 1) ? AngleQuarterTurn - InQuadrant : InQuadrant;
+        const int32 Index = P >> 6;
+        const int32 Value = Index >= 256 ? SinTable[256] : Lerp(SinTable, Index, P & 0x3F, 6);
+
+        return FHktFixed::FromRaw(Quadrant >= 2 ? -Value : Value);
+    }
+
+    FHktFixed Cos(int32 Angle)
+    {
+        return Sin(static_cast<int32>(static_cast<uint32>(Angle) + AngleQuarterTurn));
+    }
+
+    int32 Atan2(int32 Y, int32 X)
+    {
+        if (X == 0 && Y == 0)
+        {
+            return 0;
+        }
+
+        const int64 AX = FMath::Abs(static_cast<int64>(X));
+        const int64 AY = FMath::Abs(static_cast<int64>(Y));
+
+        // 0~45°로 접어서 테이블 조회: T = 작은 쪽 / 큰 쪽 (Q16, 0..65536)
+        const bool bSteep = AY > AX;
+        const int64 T = (bSteep ? AX : AY) * FHktFixed::OneRaw / (bSteep ? AY : AX);
+        const int32 Index = static_cast<int32>(T >> 8);
+        const int32 Frac = static_cast<int32>(T & 0xFF);
+        int32 Angle = Index >= 256 ? AtanTable[256] : Lerp(AtanTable, Index, Frac, 8);
+
+        if (bSteep)   Angle = AngleQuarterTurn - Angle;
+        if (X < 0)    Angle = AngleHalfTurn - Angle;
+        if (Y < 0)    Angle = -Angle;
+        return Angle;
+    }
+}
@@ -387,6 +387,43 @@ namespace HktPhysics
         return false;
     }
     
+    bool OverlapColliders(
+        EHktColliderType TypeA, const FIntVector& PosA, int32 RadiusA, int32 HalfHeightA,
+        EHktColliderType TypeB, const FIntVector& PosB, int32 RadiusB, int32 HalfHeightB)
+    {
+        // None 타입은 충돌 없음
+        if (TypeA == EHktColliderType::None || TypeB == EHktColliderType::None)
+        {
+            return false;
+        }
+        
+        // Sphere-Sphere
+        if (TypeA == EHktColliderType::Sphere && TypeB == EHktColliderType::Sphere)
+        {
+            return OverlapSphereSphere(PosA, RadiusA, PosB, RadiusB);
+        }
+        
+        // Sphere-Capsule
+        if (TypeA == EHktColliderType::Sphere && TypeB == EHktColliderType::Capsule)
+        {
+            return OverlapSphereCapsule(PosA, RadiusA, PosB, HalfHeightB, RadiusB);
+        }
+        
+        // Capsule-Sphere (순서 반전)
+        if (TypeA == EHktColliderType::Capsule && TypeB == EHktColliderType::Sphere)
+        {
+            return OverlapSphereCapsule(PosB, RadiusB, PosA, HalfHeightA, RadiusA);
+        }
+        
+        // Capsule-Capsule
+        if (TypeA == EHktColliderType::Capsule && TypeB == EHktColliderType::Capsule)
+        {
+            return OverlapCapsuleCapsule(PosA, HalfHeightA, RadiusA, PosB, HalfHeightB, RadiusB);
+        }
+        
+        return false;
+    }
+    
     bool TestColliders(
         EHktColliderType TypeA, const FVector& PosA, float RadiusA, float HalfHeightA,
         EHktColliderType TypeB, const FVector& PosB, float RadiusB, float HalfHeightB,
@@ -4,6 +4,7 @@
 
 #include "HktPhysicsTypes.h"
 #include "HktPhysicsMath.h"
+#include "HktFixedMath.h"
 
 namespace HktPhysics
 {
@@ -59,6 +60,56 @@ namespace HktPhysics
         return SegmentSegmentDistanceSquared(A1, A2, B1, B2) <= RadiusSum * RadiusSum;
     }
     
+    // ========================================================================
+    // 정수 Overlap 테스트 (시뮬레이션 경로)
+    // - Stash의 int32 cm 좌표/반경을 float 변환 없이 사용 (플랫폼 간 비트 단위 동일)
+    // - Capsule은 항상 Z축 정렬이므로 최근접점이 정수로 정확히 계산됨
+    // ========================================================================
+    
+    /**
+     * Sphere vs Sphere Overlap (정수)
+     */
+    FORCEINLINE bool OverlapSphereSphere(
+        const FIntVector& CenterA, int32 RadiusA,
+        const FIntVector& CenterB, int32 RadiusB)
+    {
+        // 반경 합 < 2^32 → 제곱은 uint64 범위
+        const uint64 RadiusSum = static_cast<uint64>(FMath::Max(0, RadiusA)) + static_cast<uint64>(FMath::Max(0, RadiusB));
+        return HktMath::DistanceSquared(CenterA, CenterB) <= RadiusSum * RadiusSum;
+    }
+    
+    /**
+     * Sphere vs Capsule Overlap (정수)
+     * @param CapsuleCenter - 캡슐 중심 (축은 Center ± HalfHeight의 Z축 선분)
+     */
+    FORCEINLINE bool OverlapSphereCapsule(
+        const FIntVector& SphereCenter, int32 SphereRadius,
+        const FIntVector& CapsuleCenter, int32 CapsuleHalfHeight, int32 CapsuleRadius)
+    {
+        // Z축 선분 위 최근접점: XY는 캡슐 중심, Z는 선분 범위로 클램프
+        const int64 Bottom = static_cast<int64>(CapsuleCenter.Z) - CapsuleHalfHeight;
+        const int64 Top = static_cast<int64>(CapsuleCenter.Z) + CapsuleHalfHeight;
+        const int32 ClosestZ = static_cast<int32>(FMath::Clamp(static_cast<int64>(SphereCenter.Z), Bottom, Top));
+        
+        return OverlapSphereSphere(SphereCenter, SphereRadius,
+            FIntVector(CapsuleCenter.X, CapsuleCenter.Y, ClosestZ), CapsuleRadius);
+    }
+    
+    /**
+     * Capsule vs Capsule Overlap (정수)
+     * 두 축이 모두 Z축과 평행하므로 최근접 거리 = XY 거리와 Z 간격(겹치면 0)의 합성
+     */
+    FORCEINLINE bool OverlapCapsuleCapsule(
+        const FIntVector& CenterA, int32 HalfHeightA, int32 RadiusA,
+        const FIntVector& CenterB, int32 HalfHeightB, int32 RadiusB)
+    {
+        const int64 DZ = FMath::Abs(static_cast<int64>(CenterA.Z) - CenterB.Z);
+        const int64 Gap = FMath::Clamp(DZ - HalfHeightA - HalfHeightB, static_cast<int64>(0), static_cast<int64>(INT32_MAX));
+        
+        return OverlapSphereSphere(FIntVector(CenterA.X, CenterA.Y, 0), RadiusA,
+            FIntVector(CenterB.X, CenterB.Y, static_cast<int32>(Gap)), RadiusB);
+    }
+    
     // ========================================================================
     // 상세 충돌 테스트 (Contact Point, Normal, Depth 포함)
     // - 물리 응답이 필요할 때 사용
@@ -172,6 +223,14 @@ namespace HktPhysics
         EHktColliderType TypeA, const FVector& PosA, float RadiusA, float HalfHeightA,
         EHktColliderType TypeB, const FVector& PosB, float RadiusB, float HalfHeightB);
     
+    /**
+     * 두 충돌체 Overlap 테스트 (정수, 타입 자동 판별)
+     * 시뮬레이션 결과(WaitCollision 등)에 영향을 주는 판정은 이 버전을 사용
+     */
+    bool OverlapColliders(
+        EHktColliderType TypeA, const FIntVector& PosA, int32 RadiusA, int32 HalfHeightA,
+        EHktColliderType TypeB, const FIntVector& PosB, int32 RadiusB, int32 HalfHeightB);
+    
     /**
      * 두 충돌체 상세 테스트 (타입 자동 판별)
      */
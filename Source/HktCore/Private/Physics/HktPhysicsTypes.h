@@ -12,7 +12,7 @@
 
 namespace HktPhysics
 {
-    /** 최대 충돌체 수 (Stash MaxEntities와 동일) */
+    /** 충돌체 배열 초기 예약 수 (Stash 용량은 청크 단위로 늘어나므로 상한 아님) */
     constexpr int32 MaxColliders = 1024;
     
     /** 충돌 감지 시 최대 결과 수 */
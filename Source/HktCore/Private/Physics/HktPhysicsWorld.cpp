@@ -63,11 +63,11 @@ int32 FHktPhysicsWorld::DetectWatchedCollisions(TArray<FHktCollisionPair>& OutCo
         }
 
         // Watch 엔티티 정보 캐싱
-        const FVector WatchedPos = GetEntityPosition(WatchedEntity);
+        const FIntVector WatchedPos = GetEntityPositionCm(WatchedEntity);
         const EHktColliderType WatchedType = GetColliderType(WatchedEntity);
-        const float WatchedRadius = GetColliderRadius(WatchedEntity);
-        const float WatchedHalfHeight = (WatchedType == EHktColliderType::Capsule)
-            ? GetCapsuleHalfHeight(WatchedEntity) : 0.f;
+        const int32 WatchedRadius = GetColliderRadiusCm(WatchedEntity);
+        const int32 WatchedHalfHeight = (WatchedType == EHktColliderType::Capsule)
+            ? GetCapsuleHalfHeightCm(WatchedEntity) : 0;
 
         // 모든 활성 충돌체와 비교
         for (FHktEntityId OtherEntity : ActiveColliders)
@@ -82,11 +82,11 @@ int32 FHktPhysicsWorld::DetectWatchedCollisions(TArray<FHktCollisionPair>& OutCo
                 continue;
             }
 
-            const FVector OtherPos = GetEntityPosition(OtherEntity);
+            const FIntVector OtherPos = GetEntityPositionCm(OtherEntity);
             const EHktColliderType OtherType = GetColliderType(OtherEntity);
-            const float OtherRadius = GetColliderRadius(OtherEntity);
-            const float OtherHalfHeight = (OtherType == EHktColliderType::Capsule)
-                ? GetCapsuleHalfHeight(OtherEntity) : 0.f;
+            const int32 OtherRadius = GetColliderRadiusCm(OtherEntity);
+            const int32 OtherHalfHeight = (OtherType == EHktColliderType::Capsule)
+                ? GetCapsuleHalfHeightCm(OtherEntity) : 0;
 
             if (HktPhysics::OverlapColliders(
                 WatchedType, WatchedPos, WatchedRadius, WatchedHalfHeight,
@@ -125,11 +125,11 @@ int32 FHktPhysicsWorld::DetectAllCollisions(TArray<FHktCollisionPair>& OutPairs)
     for (int32 i = 0; i < NumColliders; ++i)
     {
         const FHktEntityId EntityA = ActiveColliders[i];
-        const FVector PosA = GetEntityPosition(EntityA);
+        const FIntVector PosA = GetEntityPositionCm(EntityA);
         const EHktColliderType TypeA = GetColliderType(EntityA);
-        const float RadiusA = GetColliderRadius(EntityA);
-        const float HalfHeightA = (TypeA == EHktColliderType::Capsule) 
-            ? GetCapsuleHalfHeight(EntityA) : 0.f;
+        const int32 RadiusA = GetColliderRadiusCm(EntityA);
+        const int32 HalfHeightA = (TypeA == EHktColliderType::Capsule) 
+            ? GetCapsuleHalfHeightCm(EntityA) : 0;
         
         for (int32 j = i + 1; j < NumColliders; ++j)
         {
@@ -140,11 +140,11 @@ int32 FHktPhysicsWorld::DetectAllCollisions(TArray<FHktCollisionPair>& OutPairs)
                 continue;
             }
             
-            const FVector PosB = GetEntityPosition(EntityB);
+            const FIntVector PosB = GetEntityPositionCm(EntityB);
             const EHktColliderType TypeB = GetColliderType(EntityB);
-            const float RadiusB = GetColliderRadius(EntityB);
-            const float HalfHeightB = (TypeB == EHktColliderType::Capsule)
-                ? GetCapsuleHalfHeight(EntityB) : 0.f;
+            const int32 RadiusB = GetColliderRadiusCm(EntityB);
+            const int32 HalfHeightB = (TypeB == EHktColliderType::Capsule)
+                ? GetCapsuleHalfHeightCm(EntityB) : 0;
             
             if (HktPhysics::OverlapColliders(TypeA, PosA, RadiusA, HalfHeightA,
                                              TypeB, PosB, RadiusB, HalfHeightB))
@@ -208,6 +208,10 @@ int32 FHktPhysicsWorld::OverlapSphere(
     
     RefreshActiveColliders();
     
+    // 쿼리 입력만 cm 정수로 반올림하고 판정은 정수로
+    const FIntVector CenterCm(FMath::RoundToInt(Center.X), FMath::RoundToInt(Center.Y), FMath::RoundToInt(Center.Z));
+    const int32 RadiusCm = FMath::RoundToInt(Radius);
+    
     int32 FoundCount = 0;
     
     for (FHktEntityId Entity : ActiveColliders)
@@ -222,22 +226,20 @@ int32 FHktPhysicsWorld::OverlapSphere(
             continue;
         }
         
-        const FVector Pos = GetEntityPosition(Entity);
+        const FIntVector Pos = GetEntityPositionCm(Entity);
         const EHktColliderType Type = GetColliderType(Entity);
-        const float ColliderRadius = GetColliderRadius(Entity);
+        const int32 ColliderRadius = GetColliderRadiusCm(Entity);
         
         bool bOverlap = false;
         
         if (Type == EHktColliderType::Sphere)
         {
-            bOverlap = HktPhysics::OverlapSphereSphere(Center, Radius, Pos, ColliderRadius);
+            bOverlap = HktPhysics::OverlapSphereSphere(CenterCm, RadiusCm, Pos, ColliderRadius);
         }
         else if (Type == EHktColliderType::Capsule)
         {
-            FVector CapsuleTop, CapsuleBottom;
-            GetCapsuleEndpoints(Entity, CapsuleTop, CapsuleBottom);
-            bOverlap = HktPhysics::OverlapSphereCapsule(Center, Radius, 
-                CapsuleTop, CapsuleBottom, ColliderRadius);
+            bOverlap = HktPhysics::OverlapSphereCapsule(CenterCm, RadiusCm, 
+                Pos, GetCapsuleHalfHeightCm(Entity), ColliderRadius);
         }
         
         if (bOverlap)
@@ -409,14 +411,14 @@ bool FHktPhysicsWorld::TestEntityOverlap(FHktEntityId EntityA, FHktEntityId Enti
         return false;
     }
     
-    const FVector PosA = GetEntityPosition(EntityA);
-    const FVector PosB = GetEntityPosition(EntityB);
+    const FIntVector PosA = GetEntityPositionCm(EntityA);
+    const FIntVector PosB = GetEntityPositionCm(EntityB);
     const EHktColliderType TypeA = GetColliderType(EntityA);
     const EHktColliderType TypeB = GetColliderType(EntityB);
-    const float RadiusA = GetColliderRadius(EntityA);
-    const float RadiusB = GetColliderRadius(EntityB);
-    const float HalfHeightA = (TypeA == EHktColliderType::Capsule) ? GetCapsuleHalfHeight(EntityA) : 0.f;
-    const float HalfHeightB = (TypeB == EHktColliderType::Capsule) ? GetCapsuleHalfHeight(EntityB) : 0.f;
+    const int32 RadiusA = GetColliderRadiusCm(EntityA);
+    const int32 RadiusB = GetColliderRadiusCm(EntityB);
+    const int32 HalfHeightA = (TypeA == EHktColliderType::Capsule) ? GetCapsuleHalfHeightCm(EntityA) : 0;
+    const int32 HalfHeightB = (TypeB == EHktColliderType::Capsule) ? GetCapsuleHalfHeightCm(EntityB) : 0;
     
     return HktPhysics::OverlapColliders(TypeA, PosA, RadiusA, HalfHeightA,
                                         TypeB, PosB, RadiusB, HalfHeightB);
@@ -517,6 +519,25 @@ bool FHktPhysicsWorld::CanCollide(FHktEntityId EntityA, FHktEntityId EntityB) co
 // 내부 헬퍼
 // ============================================================================
 
+FIntVector FHktPhysicsWorld::GetEntityPositionCm(FHktEntityId Entity) const
+{
+    return FIntVector(
+        Stash->GetProperty(Entity, PropertyId::PosX),
+        Stash->GetProperty(Entity, PropertyId::PosY),
+        Stash->GetProperty(Entity, PropertyId::PosZ)
+    );
+}
+
+int32 FHktPhysicsWorld::GetColliderRadiusCm(FHktEntityId Entity) const
+{
+    return Stash->GetProperty(Entity, PropertyId::ColliderRadius);
+}
+
+int32 FHktPhysicsWorld::GetCapsuleHalfHeightCm(FHktEntityId Entity) const
+{
+    return Stash->GetProperty(Entity, PropertyId::ColliderHalfHeight);
+}
+
 FVector FHktPhysicsWorld::GetEntityPosition(FHktEntityId Entity) const
 {
     return FVector(
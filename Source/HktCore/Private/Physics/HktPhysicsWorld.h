@@ -173,6 +173,12 @@ private:
     // 내부 헬퍼
     // ========================================================================
 
+    /** 정수 cm 값 그대로 (Overlap 판정 - 결정론 경로) */
+    FIntVector GetEntityPositionCm(FHktEntityId Entity) const;
+    int32 GetColliderRadiusCm(FHktEntityId Entity) const;
+    int32 GetCapsuleHalfHeightCm(FHktEntityId Entity) const;
+
+    /** float 변환 (레이캐스트/스윕/상세 테스트 - 접촉점/법선 출력용) */
     FVector GetEntityPosition(FHktEntityId Entity) const;
     float GetColliderRadius(FHktEntityId Entity) const;
     float GetCapsuleHalfHeight(FHktEntityId Entity) const;
@@ -0,0 +1,325 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HktCoreTestScene.h"
+#include "HktVMTrace.h"
+#include "VM/HktVMInterpreter.h"
+#include "VM/HktVMProcessor.h"
+#include "VM/HktVMStore.h"
+#include "VM/HktVMVerifier.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeExit.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 성능 측정 (PerfFilter) - 결과는 로그(AddInfo)로 남기고, 정확성 조건만 검사합니다.
+ * 시간은 장비/빌드 구성에 따라 달라지므로 상한을 두지 않습니다.
+ */
+namespace
+{
+    /** 엔티티당 나노초 */
+    double NsPerItem(double StartSeconds, int32 NumItems)
+    {
+        return (FPlatformTime::Seconds() - StartSeconds) * 1e9 / FMath::Max(1, NumItems);
+    }
+
+    /** 대기 중인 VM을 모두 깨우는 이벤트 - 생성된 투사체까지 (Flow가 끝까지 진행하도록) */
+    void NotifyAllEntities(FHktVMProcessor& Processor, const FHktMasterStash& Stash, FHktEntityId HitEntity)
+    {
+        Stash.ForEachEntity([&Processor, HitEntity](FHktEntityId Entity)
+        {
+            Processor.NotifyAnimEnd(Entity);
+            Processor.NotifyMoveEnd(Entity);
+            Processor.NotifyCollision(Entity, HitEntity);
+        });
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktStashScaleBenchmark, "HktCore.Benchmark.StashScale",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHktStashScaleBenchmark::RunTest(const FString& Parameters)
+{
+    // 청크 저장소와 세대 ID: 규모별 할당/읽기/순회/해제 비용, 재사용 후 이전 ID 적중 수
+    const int32 Scales[] = { 1000, 10000, 100000 };
+    for (const int32 NumEntities : Scales)
+    {
+        FHktMasterStash Stash;
+        TArray<FHktEntityId> Entities;
+        Entities.Reserve(NumEntities);
+
+        double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumEntities; ++i)
+        {
+            const FHktEntityId E = Stash.AllocateEntity();
+            Stash.SetProperty(E, PropertyId::Health, i);
+            Entities.Add(E);
+        }
+        const double AllocateNs = NsPerItem(Start, NumEntities);
+
+        int64 Sum = 0;
+        Start = FPlatformTime::Seconds();
+        for (FHktEntityId E : Entities)
+        {
+            Sum += Stash.GetProperty(E, PropertyId::Health);
+        }
+        const double ReadNs = NsPerItem(Start, NumEntities);
+
+        Start = FPlatformTime::Seconds();
+        Stash.ForEachEntity([&Stash, &Sum](FHktEntityId E)
+        {
+            Sum += Stash.GetProperty(E, PropertyId::Health);
+        });
+        const double IterateNs = NsPerItem(Start, NumEntities);
+
+        Start = FPlatformTime::Seconds();
+        for (FHktEntityId E : Entities)
+        {
+            Stash.FreeEntity(E);
+        }
+        const double FreeNs = NsPerItem(Start, NumEntities);
+
+        // 같은 슬롯을 다시 채운 뒤 이전 ID는 모두 무효여야 함
+        for (int32 i = 0; i < NumEntities; ++i)
+        {
+            Stash.AllocateEntity();
+        }
+        int32 StaleHits = 0;
+        for (FHktEntityId E : Entities)
+        {
+            StaleHits += Stash.IsValidEntity(E) ? 1 : 0;
+        }
+        TestEqual(FString::Printf(TEXT("stale ID hits at %d entities"), NumEntities), StaleHits, 0);
+
+        AddInfo(FString::Printf(TEXT("Stash %6d entities: allocate %.1f ns, read %.2f ns, iterate %.2f ns, free %.1f ns (checksum %lld)"),
+            NumEntities, AllocateNs, ReadNs, IterateNs, FreeNs, Sum));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMDispatchBenchmark, "HktCore.Benchmark.VMDispatch",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHktVMDispatchBenchmark::RunTest(const FString& Parameters)
+{
+    // 레지스터 연산만 도는 루프 - 명령어당 비용이 대부분 디스패치
+    constexpr int32 NumIterations = 500000;    // LoadConst 20비트 즉시값 범위
+
+    const bool bWasOptimizing = FFlowBuilder::bOptimizeOnBuild;
+    const bool bTraceWasEnabled = FHktVMTrace::IsEnabled();
+    FFlowBuilder::bOptimizeOnBuild = false;
+    FHktVMTrace::SetEnabled(false);
+    ON_SCOPE_EXIT
+    {
+        FFlowBuilder::bOptimizeOnBuild = bWasOptimizing;
+        FHktVMTrace::SetEnabled(bTraceWasEnabled);
+    };
+
+    FHktVMProgram Loop = FFlowBuilder::Create(FGameplayTag())
+        .LoadConst(Reg::R0, 0)
+        .LoadConst(Reg::R1, NumIterations)
+        .LoadConst(Reg::R3, 3)
+        .Label(TEXT("Loop"))
+            .Sub(Reg::R2, Reg::R0, Reg::R3)
+            .Add(Reg::R4, Reg::R2, Reg::R3)
+            .Move(Reg::R5, Reg::R4)
+            .AddImm(Reg::R0, Reg::R0, 1)
+            .CmpLt(Reg::Flag, Reg::R0, Reg::R1)
+            .JumpIf(Reg::Flag, TEXT("Loop"))
+        .Halt()
+        .Build();
+    if (!TestTrue(TEXT("loop program verified"), FHktVMVerifier::Verify(Loop)))
+    {
+        return false;
+    }
+
+    FHktMasterStash Stash;
+    FHktVMInterpreter VM;
+    VM.Initialize(&Stash);
+    VM.bEnableNative = false;
+
+    FHktVMStore Store;
+    Store.Stash.Bind(&Stash);
+    FHktVMRuntime Runtime;
+    Runtime.Program = &Loop;
+    Runtime.Store = &Store;
+
+    // 1. 바이트코드 디스패치 (computed goto 또는 핸들러 테이블 - 컴파일러에 따라)
+    int64 Executed = 0;
+    EVMStatus Status = EVMStatus::Ready;
+    double Start = FPlatformTime::Seconds();
+    while (Status != EVMStatus::Completed && Status != EVMStatus::Failed)
+    {
+        int32 Budget = FHktVMInterpreter::MaxInstructionsPerTick;
+        Status = VM.Execute(Runtime, Budget);
+        Executed += FHktVMInterpreter::MaxInstructionsPerTick - Budget;
+    }
+    const double DispatchNs = NsPerItem(Start, static_cast<int32>(Executed));
+    TestTrue(TEXT("loop completed"), Status == EVMStatus::Completed);
+    TestEqual(TEXT("loop counter"), Runtime.GetReg(Reg::R5), NumIterations - 1);
+
+    // 2. 같은 루프 본문을 명령어마다 핸들러 테이블 호출로 (분기는 C++ 루프)
+    const FInstruction Body[] =
+    {
+        FInstruction::Make(EOpCode::Sub, Reg::R2, Reg::R0, Reg::R3),
+        FInstruction::Make(EOpCode::Add, Reg::R4, Reg::R2, Reg::R3),
+        FInstruction::Make(EOpCode::Move, Reg::R5, Reg::R4),
+        FInstruction::Make(EOpCode::AddImm, Reg::R0, Reg::R0, 0, 1),
+    };
+    FHktVMRuntime TableRuntime;
+    TableRuntime.Program = &Loop;
+    TableRuntime.Store = &Store;
+    TableRuntime.SetReg(Reg::R3, 3);
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumIterations; ++i)
+    {
+        for (const FInstruction& Inst : Body)
+        {
+            VM.ExecuteNativeOp(TableRuntime, Inst);
+        }
+    }
+    const double TableNs = NsPerItem(Start, NumIterations * UE_ARRAY_COUNT(Body));
+    TestEqual(TEXT("table loop counter"), TableRuntime.GetReg(Reg::R5), NumIterations - 1);
+
+    AddInfo(FString::Printf(TEXT("VM dispatch: bytecode %.2f ns/instruction (%lld instructions), per-op handler call %.2f ns/instruction"),
+        DispatchNs, Executed, TableNs));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMPoolBenchmark, "HktCore.Benchmark.VMPool",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHktVMPoolBenchmark::RunTest(const FString& Parameters)
+{
+    HktCoreTest::EnsureFlowsRegistered();
+    const TArray<FGameplayTag> Tags = HktCoreTest::GetFlowTags();
+
+    const bool bTraceWasEnabled = FHktVMTrace::IsEnabled();
+    FHktVMTrace::SetEnabled(false);
+    ON_SCOPE_EXIT { FHktVMTrace::SetEnabled(bTraceWasEnabled); };
+
+    // 1. 한 프레임 Intent 폭주: 풀이 청크 단위로 자라는 비용 vs ReserveVMs로 미리 확보
+    const int32 Bursts[] = { 1000, 10000, 50000 };
+    for (const int32 NumIntents : Bursts)
+    {
+        double FirstTickMs[2] = {};
+        for (int32 bReserve = 0; bReserve < 2; ++bReserve)
+        {
+            FHktMasterStash Stash;
+            const TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Stash, 1024);
+
+            FHktVMProcessor Processor;
+            Processor.Initialize(&Stash);
+            if (bReserve)
+            {
+                Processor.ReserveVMs(NumIntents);
+            }
+            for (int32 i = 0; i < NumIntents; ++i)
+            {
+                Processor.NotifyIntentEvent(HktCoreTest::MakeIntent(Units, i % Units.Num(), Tags, i + 1));
+            }
+
+            const double Start = FPlatformTime::Seconds();
+            Processor.Tick(1, 1.0f / 30.0f);
+            FirstTickMs[bReserve] = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+            TestEqual(FString::Printf(TEXT("no deferred intents at %d (reserve %d)"), NumIntents, bReserve), Processor.GetNumDeferredIntents(), 0);
+        }
+
+        AddInfo(FString::Printf(TEXT("VM pool burst %6d intents: first tick %.2f ms growing, %.2f ms reserved"),
+            NumIntents, FirstTickMs[0], FirstTickMs[1]));
+    }
+
+    // 2. 풀 상한 초과: 넘친 Intent는 버리지 않고 다음 프레임들로 미뤄 모두 처리
+    {
+        constexpr int32 MaxVMs = 1024;
+        constexpr int32 NumIntents = 8192;
+        constexpr int32 MaxFrames = 2000;
+
+        FHktMasterStash Stash;
+        const TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Stash, 1024);
+
+        FHktVMProcessor Processor;
+        Processor.Initialize(&Stash);
+        Processor.SetMaxVMs(MaxVMs);
+        for (int32 i = 0; i < NumIntents; ++i)
+        {
+            Processor.NotifyIntentEvent(HktCoreTest::MakeIntent(Units, i % Units.Num(), Tags, i + 1));
+        }
+
+        const double Start = FPlatformTime::Seconds();
+        Processor.Tick(1, 1.0f / 30.0f);
+        TestEqual(TEXT("deferred after first frame"), Processor.GetNumDeferredIntents(), NumIntents - MaxVMs);
+
+        int32 Frame = 1;
+        while (Processor.GetNumDeferredIntents() > 0 && Frame < MaxFrames)
+        {
+            NotifyAllEntities(Processor, Stash, Units[0]);
+            Processor.Tick(++Frame, 1.0f / 30.0f);
+        }
+        const double DrainMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+        TestEqual(TEXT("admission queue drained"), Processor.GetNumDeferredIntents(), 0);
+
+        AddInfo(FString::Printf(TEXT("VM pool cap %d, %d intents: admission queue drained in %d frames (%.2f ms)"),
+            MaxVMs, NumIntents, Frame, DrainMs));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMWideBenchmark, "HktCore.Benchmark.WideExecution",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FHktVMWideBenchmark::RunTest(const FString& Parameters)
+{
+    HktCoreTest::EnsureFlowsRegistered();
+    const TArray<FGameplayTag> Tags = { FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Heal")) };
+
+    const bool bTraceWasEnabled = FHktVMTrace::IsEnabled();
+    FHktVMTrace::SetEnabled(false);
+    ON_SCOPE_EXIT { FHktVMTrace::SetEnabled(bTraceWasEnabled); };
+
+    // 같은 Flow N개 = 같은 Program/PC에 모인 VM (시전 → WaitSeconds(0.8) → 회복 계산까지 완료)
+    // 바이트코드 경로끼리, 게임 스레드에서만 비교 (네이티브/워커 분배 비용 제외)
+    constexpr int32 NumFrames = 40;
+    const int32 Counts[] = { 1000, 10000, 50000 };
+    for (const int32 NumVMs : Counts)
+    {
+        double TotalMs[2] = {};
+        uint32 Checksums[2] = {};
+        for (int32 bWide = 0; bWide < 2; ++bWide)
+        {
+            FHktMasterStash Stash;
+            const TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Stash, NumVMs);
+
+            FHktVMProcessor Processor;
+            Processor.Initialize(&Stash);
+            Processor.ReserveVMs(NumVMs);
+            Processor.bEnableWideExecution = bWide != 0;
+            Processor.bEnableNativeExecution = false;
+            Processor.bEnableParallelExecution = false;
+            for (int32 i = 0; i < NumVMs; ++i)
+            {
+                Processor.NotifyIntentEvent(HktCoreTest::MakeIntent(Units, i, Tags, i + 1));
+            }
+
+            double Seconds = 0.0;
+            for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+            {
+                const double Start = FPlatformTime::Seconds();
+                Processor.Tick(Frame, 1.0f / 30.0f);
+                Seconds += FPlatformTime::Seconds() - Start;
+                Stash.MarkFrameCompleted(Frame);
+            }
+            TotalMs[bWide] = Seconds * 1000.0;
+            Checksums[bWide] = Stash.CalculateChecksum();
+        }
+
+        TestEqual(FString::Printf(TEXT("wide/scalar checksum at %d VMs"), NumVMs), Checksums[1], Checksums[0]);
+        AddInfo(FString::Printf(TEXT("Wide execution %6d x %s: scalar %.2f ms, wide %.2f ms over %d frames (%.2fx)"),
+            NumVMs, *Tags[0].ToString(), TotalMs[0], TotalMs[1], NumFrames, TotalMs[0] / FMath::Max(TotalMs[1], 1e-6)));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,85 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktCoreTypes.h"
+#include "HktPropertyIds.h"
+#include "VM/HktMasterStash.h"
+#include "VM/HktVMProgram.h"
+#include "VM/HktFlowDefinitions.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * HktCoreTest - 헤드리스 테스트/벤치마크 공용 장면 (UWorld 없이 Stash + 기본 Flow)
+ *
+ * 모든 값은 인덱스에서 계산하므로 같은 인자면 프로세스/실행과 무관하게 같은 장면입니다.
+ */
+namespace HktCoreTest
+{
+    /** 기본 Flow (HktFlowDefinitions.h) - 다른 테스트가 이미 등록했으면 그대로 */
+    inline void EnsureFlowsRegistered()
+    {
+        const FGameplayTag Heal = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Heal"), false);
+        if (!Heal.IsValid() || !FHktVMProgramRegistry::Get().FindProgram(Heal))
+        {
+            FlowDefinitions::RegisterAllFlows();
+        }
+    }
+
+    /** 등록된 Flow Tag (이름 순) */
+    inline TArray<FGameplayTag> GetFlowTags()
+    {
+        TArray<FGameplayTag> Tags;
+        FHktVMProgramRegistry::Get().ForEachProgram([&Tags](const FHktVMProgram& Program)
+        {
+            Tags.Add(Program.Tag);
+        });
+        Tags.Sort([](const FGameplayTag& A, const FGameplayTag& B) { return A.ToString() < B.ToString(); });
+        return Tags;
+    }
+
+    /** 정사각 격자에 유닛 배치 (팀은 체커보드, 체력/공격력은 인덱스별로 다름) */
+    inline TArray<FHktEntityId> SpawnUnits(FHktMasterStash& Stash, int32 NumUnits, int32 SpacingCm = 150)
+    {
+        const int32 Side = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumUnits))));
+
+        TArray<FHktEntityId> Units;
+        Units.Reserve(NumUnits);
+        for (int32 i = 0; i < NumUnits; ++i)
+        {
+            const FHktEntityId E = Stash.AllocateEntity();
+            const int32 X = i % Side;
+            const int32 Y = i / Side;
+            Stash.SetPosition(E, FVector(X * SpacingCm, Y * SpacingCm, 0));
+            Stash.SetProperty(E, PropertyId::Team, 1 + ((X + Y) & 1));
+            Stash.SetProperty(E, PropertyId::Health, 400 + (i * 37) % 500);
+            Stash.SetProperty(E, PropertyId::MaxHealth, 1000);
+            Stash.SetProperty(E, PropertyId::AttackPower, 10 + i % 25);
+            Stash.SetProperty(E, PropertyId::Defense, i % 7);
+            Units.Add(E);
+        }
+        return Units;
+    }
+
+    /** 유닛 Index의 Intent - Flow는 Tags를 순환, 타깃은 다음 유닛 */
+    inline FHktIntentEvent MakeIntent(const TArray<FHktEntityId>& Units, int32 Index, const TArray<FGameplayTag>& Tags, int32 EventId)
+    {
+        const FHktEntityId Target = Units[(Index + 1) % Units.Num()];
+
+        FHktIntentEvent Event;
+        Event.EventId = EventId;
+        Event.SourceEntity = Units[Index];
+        Event.TargetEntity = Target;
+        Event.EventTag = Tags[Index % Tags.Num()];
+        Event.Location = FVector(Index * 50 % 3000, Index * 70 % 3000, 0);
+
+        // Param0 = 타깃 (BasicAttack), Param1 = 인덱스별 값
+        const int32 Params[2] = { Target.RawValue, 10 + Index % 90 };
+        Event.Payload.Append(reinterpret_cast<const uint8*>(Params), sizeof(Params));
+        return Event;
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,180 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HktFixedMath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ============================================================================
+// 고정소수점 수학 골든 값
+//
+// 기대값은 HktFixedMath.cpp의 정수 알고리즘/테이블을 그대로 계산한 값입니다.
+// 플랫폼/컴파일러가 바뀌어도 비트 단위로 같아야 하므로 오차 허용 없이 비교하고,
+// 테이블을 고치면 여기 값도 함께 바꿔야 합니다 (실수와의 오차 검사는 별도).
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktFixedMathSinCosTest, "HktCore.FixedMath.SinCos",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktFixedMathSinCosTest::RunTest(const FString& Parameters)
+{
+    using namespace HktMath;
+
+    struct FCase { int32 Angle; int32 Sin; int32 Cos; };
+    const FCase Cases[] =
+    {
+        {      0,      0,  65536 },
+        {      1,      6,  65535 },
+        {   5461,  32766,  56756 },     // ≈30°
+        {   8192,  46341,  46341 },     // 45°
+        {  10923,  56756,  32766 },     // ≈60°
+        {  16383,  65535,      6 },     // 사분면 경계 직전/직후
+        {  16384,  65536,      0 },
+        {  16385,  65535,     -6 },
+        {  32767,      6, -65535 },
+        {  32768,      0, -65536 },
+        {  32769,     -6, -65535 },
+        {  49152, -65536,      0 },
+        {  65535,     -6,  65535 },
+        {  65536,      0,  65536 },     // 한 바퀴 주기
+        {  70000,  27199,  59624 },
+        {     -1,     -6,  65535 },
+        { -16384, -65536,      0 },
+    };
+    for (const FCase& Case : Cases)
+    {
+        TestEqual(FString::Printf(TEXT("Sin(%d)"), Case.Angle), Sin(Case.Angle).Raw, Case.Sin);
+        TestEqual(FString::Printf(TEXT("Cos(%d)"), Case.Angle), Cos(Case.Angle).Raw, Case.Cos);
+    }
+
+    // 전체 각도 체크섬 + 홀함수 대칭 + 실수 sin과의 오차 (2/65536 이내)
+    int64 Checksum = 0;
+    double MaxError = 0.0;
+    for (int32 Angle = 0; Angle < AngleFullTurn; ++Angle)
+    {
+        const int32 Value = Sin(Angle).Raw;
+        Checksum += static_cast<int64>(Angle + 1) * Value;
+        if (Angle > 0 && Sin(-Angle).Raw != -Value)
+        {
+            AddError(FString::Printf(TEXT("Sin(-%d) != -Sin(%d)"), Angle, Angle));
+            break;
+        }
+        MaxError = FMath::Max(MaxError, FMath::Abs(Value - FMath::Sin(Angle * UE_DOUBLE_TWO_PI / AngleFullTurn) * FHktFixed::OneRaw));
+    }
+    TestEqual(TEXT("Sin checksum over a full turn"), Checksum, static_cast<int64>(-44797494689792ll));
+    TestTrue(FString::Printf(TEXT("Sin max error %.3f raw"), MaxError), MaxError < 2.0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktFixedMathAtan2Test, "HktCore.FixedMath.Atan2",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktFixedMathAtan2Test::RunTest(const FString& Parameters)
+{
+    using namespace HktMath;
+
+    struct FCase { int32 Y; int32 X; int32 Angle; };
+    const FCase Cases[] =
+    {
+        // 축 - 원점은 0, -X축은 +AngleHalfTurn
+        {  0,  0,      0 },
+        {  0,  1,      0 },
+        {  1,  0,  16384 },
+        {  0, -1,  32768 },
+        { -1,  0, -16384 },
+        // 대각선 (사분면별)
+        {  1,  1,   8192 },
+        {  1, -1,  24576 },
+        { -1, -1, -24576 },
+        { -1,  1,  -8192 },
+        // 45° 양쪽 (완만/가파름 접기)
+        {  3,  4,   6712 },
+        {  4,  3,   9672 },
+        { 100, 1,  16281 },
+        // int32 끝값 (절댓값을 64비트로 계산)
+        { MIN_int32, 1, -16384 },
+        { 1, MIN_int32,  32768 },
+        { MIN_int32, MIN_int32, -24576 },
+        { MAX_int32, MIN_int32,  24577 },
+    };
+    for (const FCase& Case : Cases)
+    {
+        TestEqual(FString::Printf(TEXT("Atan2(%d, %d)"), Case.Y, Case.X), Atan2(Case.Y, Case.X), Case.Angle);
+    }
+
+    // 격자 체크섬 + 실수 atan2와의 오차 (2 이진 각도 이내)
+    int64 Checksum = 0;
+    int32 Count = 0;
+    double MaxError = 0.0;
+    for (int32 Y = -1000; Y <= 1000; Y += 50)
+    {
+        for (int32 X = -1000; X <= 1000; X += 50)
+        {
+            const int32 Angle = Atan2(Y, X);
+            Checksum += static_cast<int64>(Angle) * ++Count;
+            if (X != 0 || Y != 0)
+            {
+                MaxError = FMath::Max(MaxError, FMath::Abs(Angle - FMath::Atan2(static_cast<double>(Y), static_cast<double>(X)) * AngleHalfTurn / UE_DOUBLE_PI));
+            }
+        }
+    }
+    TestEqual(TEXT("Atan2 grid checksum"), Checksum, static_cast<int64>(12111708160ll));
+    TestTrue(FString::Printf(TEXT("Atan2 max error %.3f"), MaxError), MaxError < 2.0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktFixedMathSqrtTest, "HktCore.FixedMath.SqrtDistance",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktFixedMathSqrtTest::RunTest(const FString& Parameters)
+{
+    using namespace HktMath;
+
+    struct FCase { uint64 Value; uint64 Root; };
+    const FCase Cases[] =
+    {
+        { 0, 0 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 4, 2 },
+        { 15, 3 }, { 16, 4 }, { 17, 4 },
+        { 0xFFFFFFFFull, 65535 },
+        { 1ull << 62, 1ull << 31 },
+        { (1ull << 62) - 1, (1ull << 31) - 1 },
+        { 1ull << 63, 3037000499ull },
+        // 2^64 근처: (2^32 - 1)² 앞뒤와 최댓값
+        { 18446744065119617024ull, 4294967294ull },
+        { 18446744065119617025ull, 4294967295ull },
+        { 18446744065119617026ull, 4294967295ull },
+        { MAX_uint64, 4294967295ull },
+    };
+    for (const FCase& Case : Cases)
+    {
+        TestEqual(FString::Printf(TEXT("SqrtU64(%llu)"), Case.Value), SqrtU64(Case.Value), Case.Root);
+    }
+
+    // 완전제곱 경계: floor(sqrt(n² - 1)) = n - 1
+    for (uint64 N = 1; N < (1ull << 32); N = N * 3 + 1)
+    {
+        if (SqrtU64(N * N) != N || SqrtU64(N * N - 1) != N - 1)
+        {
+            AddError(FString::Printf(TEXT("SqrtU64 perfect square boundary at %llu"), N));
+        }
+    }
+
+    TestEqual(TEXT("Q16.16 Sqrt(4)"), Sqrt(FHktFixed::FromInt(4)).Raw, 2 * FHktFixed::OneRaw);
+    TestEqual(TEXT("Q16.16 Sqrt(2)"), Sqrt(FHktFixed::FromInt(2)).Raw, 92681);
+    TestEqual(TEXT("Q16.16 Sqrt(-1)"), Sqrt(FHktFixed::FromInt(-1)).Raw, 0);
+
+    // cm 거리 (내림, 합 포화, INT32_MAX 포화)
+    TestEqual(TEXT("Distance 3-4-5"), Distance(FIntVector(0, 0, 0), FIntVector(3, 4, 0)), 5);
+    TestEqual(TEXT("Distance 2-3-6"), Distance(FIntVector(0, 0, 0), FIntVector(2, 3, 6)), 7);
+    TestEqual(TEXT("Distance floors"), Distance(FIntVector(0, 0, 0), FIntVector(1, 1, 1)), 1);
+    TestEqual(TEXT("Distance diagonal"), Distance(FIntVector(-100, -100, -100), FIntVector(100, 100, 100)), 346);
+    TestEqual(TEXT("DistanceSquared full X span"), DistanceSquared(FIntVector(MIN_int32, 0, 0), FIntVector(MAX_int32, 0, 0)), 18446744065119617025ull);
+    TestEqual(TEXT("DistanceSquared saturates"), DistanceSquared(FIntVector(MIN_int32), FIntVector(MAX_int32)), MAX_uint64);
+    TestEqual(TEXT("Distance saturates"), Distance(FIntVector(MIN_int32), FIntVector(MAX_int32)), MAX_int32);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,58 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Physics/HktCollisionTests.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktPhysicsIntegerOverlapTest, "HktCore.Physics.IntegerOverlap",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktPhysicsIntegerOverlapTest::RunTest(const FString& Parameters)
+{
+    using namespace HktPhysics;
+    constexpr EHktColliderType Sphere = EHktColliderType::Sphere;
+    constexpr EHktColliderType Capsule = EHktColliderType::Capsule;
+
+    // 캡슐 A: 중심 원점, 축 Z -100..100, 반경 30
+    const FIntVector A(0, 0, 0);
+    constexpr int32 HalfHeight = 100;
+    constexpr int32 Radius = 30;
+
+    // Capsule-Capsule: 높이 구간이 겹치면 XY 거리만으로 판정 (float 판정이 놓치던 경우)
+    TestTrue(TEXT("side by side, overlapping heights"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(50, 0, 40), HalfHeight, Radius));
+    TestTrue(TEXT("side by side, touching"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(60, 0, 40), HalfHeight, Radius));
+    TestFalse(TEXT("side by side, 1cm apart"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(61, 0, 40), HalfHeight, Radius));
+
+    // 위아래로 쌓임: 선분 간격 60 = 반경 합
+    TestTrue(TEXT("stacked, touching"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(0, 0, 260), HalfHeight, Radius));
+    TestFalse(TEXT("stacked, 1cm apart"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(0, 0, 261), HalfHeight, Radius));
+    TestTrue(TEXT("stacked below, touching"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(0, 0, -260), HalfHeight, Radius));
+
+    // 대각: 간격 (36, 0, 48) → 거리 60
+    TestTrue(TEXT("diagonal gap, touching"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(36, 0, 248), HalfHeight, Radius));
+    TestFalse(TEXT("diagonal gap, apart"), OverlapCapsuleCapsule(A, HalfHeight, Radius, FIntVector(37, 0, 248), HalfHeight, Radius));
+
+    // Sphere-Capsule: 최근접점은 축 위로 클램프한 Z
+    TestTrue(TEXT("sphere beside the cylinder"), OverlapSphereCapsule(FIntVector(30, 0, 50), 10, A, HalfHeight, Radius));
+    TestFalse(TEXT("sphere beside the cap, apart"), OverlapSphereCapsule(FIntVector(40, 0, 150), 10, A, HalfHeight, Radius));
+    TestTrue(TEXT("sphere above the cap, touching"), OverlapSphereCapsule(FIntVector(0, 0, 140), 10, A, HalfHeight, Radius));
+    TestFalse(TEXT("sphere above the cap, 1cm apart"), OverlapSphereCapsule(FIntVector(0, 0, 141), 10, A, HalfHeight, Radius));
+
+    // Sphere-Sphere: 경계는 겹침, int32 끝값에서도 넘치지 않음
+    TestTrue(TEXT("spheres touching"), OverlapSphereSphere(FIntVector(0, 0, 0), 20, FIntVector(30, 40, 0), 30));
+    TestFalse(TEXT("spheres apart"), OverlapSphereSphere(FIntVector(0, 0, 0), 20, FIntVector(30, 40, 1), 30));
+    TestFalse(TEXT("spheres across the full int32 span"), OverlapSphereSphere(FIntVector(MIN_int32, 0, 0), MAX_int32, FIntVector(MAX_int32, 0, 0), MAX_int32));
+    TestTrue(TEXT("spheres across the full int32 span, large radii"), OverlapSphereSphere(FIntVector(MIN_int32, 0, 0), MAX_int32, FIntVector(MAX_int32 - 1, 0, 0), MAX_int32));
+
+    // 타입 분기: 순서를 바꿔도 같은 결과, None은 항상 겹치지 않음
+    const FIntVector S(0, 0, 140);
+    TestTrue(TEXT("sphere-capsule dispatch"), OverlapColliders(Sphere, S, 10, 0, Capsule, A, Radius, HalfHeight));
+    TestTrue(TEXT("capsule-sphere dispatch"), OverlapColliders(Capsule, A, Radius, HalfHeight, Sphere, S, 10, 0));
+    TestTrue(TEXT("capsule-capsule dispatch"), OverlapColliders(Capsule, A, Radius, HalfHeight, Capsule, FIntVector(50, 0, 40), Radius, HalfHeight));
+    TestFalse(TEXT("none never overlaps"), OverlapColliders(EHktColliderType::None, A, Radius, HalfHeight, Sphere, A, Radius, 0));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
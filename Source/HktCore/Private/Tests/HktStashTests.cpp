@@ -0,0 +1,371 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HktCoreTestScene.h"
+#include "HktStashHashTree.h"
+#include "VM/HktVisibleStash.h"
+#include "VM/HktTagRegistry.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktStashSparseCellUpdateTest, "HktCore.Stash.SparseCellUpdates",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktStashSparseCellUpdateTest::RunTest(const FString& Parameters)
+{
+    // 슬롯은 많고 살아 있는 엔티티는 적은 Stash - 셀 갱신은 쓰인 엔티티만 보고 슬롯 순이어야 함
+    constexpr int32 NumSlots = 20000;
+
+    FHktMasterStash Stash;
+    TArray<FHktEntityId> Slots;
+    for (int32 i = 0; i < NumSlots; ++i)
+    {
+        Slots.Add(Stash.AllocateEntity());
+    }
+
+    const FHktEntityId Low = Slots[10];
+    const FHktEntityId Mid = Slots[9000];
+    const FHktEntityId High = Slots[NumSlots - 1];
+    const FHktEntityId Stale = Slots[5000];
+    for (FHktEntityId E : Slots)
+    {
+        if (E != Low && E != Mid && E != High && E != Stale)
+        {
+            Stash.FreeEntity(E);
+        }
+    }
+
+    // 마지막에 해제한 슬롯 재사용 - 이전 세대 ID로 온 쓰기는 무시되어야 함
+    Stash.FreeEntity(Stale);
+    const FHktEntityId Reused = Stash.AllocateEntity();
+    TestEqual(TEXT("reused slot"), Reused.GetIndex(), Stale.GetIndex());
+    Stash.ConsumeCellChangeEvents();
+
+    // 쓰기 순서는 슬롯 순이 아니고, 같은 엔티티가 여러 위치 Property에 나옴
+    TArray<FHktPropertyWrite> Writes;
+    Writes.Add({ High, PropertyId::PosX, 12000 });
+    Writes.Add({ Stale, PropertyId::PosX, 30000 });
+    Writes.Add({ Low, PropertyId::PosY, 7000 });
+    Writes.Add({ High, PropertyId::PosY, 6000 });
+    Writes.Add({ Mid, PropertyId::Health, 10 });
+    Writes.Add({ Reused, PropertyId::PosZ, 100 });
+    Writes.Add({ Low, PropertyId::PosX, -1 });
+    Stash.ApplyWrites(Writes);
+
+    const TArray<FHktCellChangeEvent> Events = Stash.ConsumeCellChangeEvents();
+    if (!TestEqual(TEXT("cell events"), Events.Num(), 3))
+    {
+        return false;
+    }
+
+    // 슬롯 오름차순, 엔티티당 한 번, 위치가 쓰이지 않은 Mid는 없음
+    TestTrue(TEXT("first event is the low slot"), Events[0].Entity == Low && Events[0].NewCell == FIntPoint(-1, 1));
+    TestTrue(TEXT("second event is the reused slot"), Events[1].Entity == Reused && Events[1].NewCell == FIntPoint(0, 0));
+    TestTrue(TEXT("third event is the high slot"), Events[2].Entity == High && Events[2].NewCell == FIntPoint(2, 1));
+
+    TestTrue(TEXT("high cell"), Stash.GetEntityCell(High) == FIntPoint(2, 1));
+    TestTrue(TEXT("mid cell untouched"), Stash.GetEntityCell(Mid) == InvalidCell);
+    TestEqual(TEXT("reused position x"), Stash.GetProperty(Reused, PropertyId::PosX), 0);
+
+    // 위치 쓰기 없는 프레임은 이벤트 없음
+    Writes.Reset();
+    Writes.Add({ Mid, PropertyId::Health, 20 });
+    Stash.ApplyWrites(Writes);
+    TestEqual(TEXT("no position writes"), Stash.ConsumeCellChangeEvents().Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktStashFullStateTest, "HktCore.Stash.FullStateRoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktStashFullStateTest::RunTest(const FString& Parameters)
+{
+    FHktMasterStash Source;
+    TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Source, 300);
+    for (int32 i = 0; i < Units.Num(); i += 7)
+    {
+        Source.FreeEntity(Units[i]);
+    }
+    Source.MarkFrameCompleted(42);
+
+    const TArray<uint8> Data = Source.SerializeFullState();
+
+    // 복원 결과는 체크섬과 다음 할당 ID까지 원본과 같음
+    FHktMasterStash Restored;
+    Restored.DeserializeFullState(Data);
+    TestEqual(TEXT("frame"), Restored.GetCompletedFrameNumber(), 42);
+    TestEqual(TEXT("entity count"), Restored.GetEntityCount(), Source.GetEntityCount());
+    TestEqual(TEXT("full checksum"), Restored.CalculateFullChecksum(), Source.CalculateFullChecksum());
+    TestTrue(TEXT("next allocation"), Restored.AllocateEntity() == Source.AllocateEntity());
+
+    // 헤더가 다르면 기존 상태를 지우지 않고 거부
+    const uint32 Before = Restored.CalculateFullChecksum();
+    TArray<uint8> BadVersion = Data;
+    BadVersion[4] ^= 0xFF;
+    AddExpectedError(TEXT("unsupported format"), EAutomationExpectedErrorFlags::Contains, 2);
+    Restored.DeserializeFullState(BadVersion);
+
+    TArray<uint8> BadMagic = Data;
+    BadMagic[0] ^= 0xFF;
+    Restored.DeserializeFullState(BadMagic);
+    TestEqual(TEXT("rejected data leaves state"), Restored.CalculateFullChecksum(), Before);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktStashHashTreeDesyncTest, "HktCore.Stash.HashTreeDesync",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktStashHashTreeDesyncTest::RunTest(const FString& Parameters)
+{
+    // 서버 상태 - 해제된 슬롯이 섞여 리프가 인덱스 공간에 흩어지도록
+    FHktMasterStash Master;
+    TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Master, 200);
+    for (int32 i = 3; i < Units.Num(); i += 11)
+    {
+        Master.FreeEntity(Units[i]);
+    }
+
+    // 클라이언트 - 스냅샷으로 같은 ID/값/태그를 받음
+    FHktVisibleStash Visible;
+    Visible.ApplySnapshots(Master.CreateSnapshots(Master.GetLiveEntities()));
+
+    FHktStashHashTree MasterTree;
+    FHktStashHashTree VisibleTree;
+    MasterTree.BuildAll(Master);
+    VisibleTree.BuildAll(Visible);
+
+    TestEqual(TEXT("leaves"), MasterTree.GetNumLeaves(), Master.GetEntityCount());
+    TestEqual(TEXT("master root = state hash"), MasterTree.GetRootHash(), Master.GetStateHash());
+    TestEqual(TEXT("visible root = master root"), VisibleTree.GetRootHash(), MasterTree.GetRootHash());
+
+    TArray<FHktEntityDesync> Desyncs;
+    FHktStashHashTree::FindDesyncs(VisibleTree, MasterTree, Desyncs);
+    TestEqual(TEXT("no desyncs when in sync"), Desyncs.Num(), 0);
+
+    // 클라이언트만 엔티티 둘을 바꿈: 하나는 Property(그룹 3), 하나는 태그
+    const FHktEntityId PropertyUnit = Units[40];
+    const FHktEntityId TagUnit = Units[150];
+    const FGameplayTag BurnTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Burn"));
+    Visible.SetProperty(PropertyUnit, PropertyId::OwnerPlayerHash, 12345);
+    Visible.AddTag(TagUnit, BurnTag);
+
+    VisibleTree.BuildAll(Visible);
+    TestEqual(TEXT("visible root = visible state hash"), VisibleTree.GetRootHash(), Visible.GetStateHash());
+    TestTrue(TEXT("roots differ"), VisibleTree.GetRootHash() != MasterTree.GetRootHash());
+
+    Desyncs.Reset();
+    FHktStashHashTree::FindDesyncs(VisibleTree, MasterTree, Desyncs);
+    if (!TestEqual(TEXT("desyncs"), Desyncs.Num(), 2))
+    {
+        return false;
+    }
+
+    // 슬롯 오름차순, 바뀐 그룹 비트만
+    TestEqual(TEXT("property slot"), Desyncs[0].SlotIndex, PropertyUnit.GetIndex());
+    TestTrue(TEXT("property local entity"), Desyncs[0].LocalEntity == PropertyUnit);
+    TestEqual(TEXT("property group mask"), (int32)Desyncs[0].GroupMask, 1 << (PropertyId::OwnerPlayerHash >> FHktEntityChange::PropertyGroupShift));
+
+    TestEqual(TEXT("tag slot"), Desyncs[1].SlotIndex, TagUnit.GetIndex());
+    TestTrue(TEXT("tag local entity"), Desyncs[1].LocalEntity == TagUnit);
+    TestEqual(TEXT("tag group mask"), (int32)Desyncs[1].GroupMask, 1 << HktHashGroup::Tags);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktStashChangeFeedTest, "HktCore.Stash.ChangeFeed",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktStashChangeFeedTest::RunTest(const FString& Parameters)
+{
+    FHktMasterStash Stash;
+    const FHktEntityId Same = Stash.AllocateEntity();
+    const FHktEntityId Written = Stash.AllocateEntity();
+    const FHktEntityId Freed = Stash.AllocateEntity();
+    const FHktEntityId Recycled = Stash.AllocateEntity();
+    Stash.SetProperty(Same, PropertyId::Health, 100);
+    Stash.MarkFrameCompleted(1);
+    TestEqual(TEXT("frame 1 creations"), Stash.GetFrameChanges().Num(), 4);
+
+    // 같은 값 쓰기 - SetProperty/ApplyWrites 모두 더티 아님 (빈 열에 0 쓰기 포함)
+    Stash.SetProperty(Same, PropertyId::Health, 100);
+    TArray<FHktPropertyWrite> Writes;
+    Writes.Add({ Same, PropertyId::Health, 100 });
+    Writes.Add({ Same, PropertyId::MaxMana, 0 });
+    Stash.ApplyWrites(Writes);
+    TestFalse(TEXT("unchanged writes are not dirty"), Stash.IsEntityDirty(Same));
+
+    // 그룹 0 (Health), 1 (MaxMana), 3 (OwnerPlayerHash)
+    Stash.SetProperty(Written, PropertyId::Health, 50);
+    Stash.SetProperty(Written, PropertyId::MaxMana, 30);
+    Writes.Reset();
+    Writes.Add({ Written, PropertyId::OwnerPlayerHash, 7 });
+    Stash.ApplyWrites(Writes);
+
+    // 해제만 한 슬롯, 해제 후 같은 프레임에 재할당된 슬롯 (FreeList는 LIFO)
+    Stash.FreeEntity(Freed);
+    Stash.FreeEntity(Recycled);
+    const FHktEntityId Reused = Stash.AllocateEntity();
+    TestEqual(TEXT("reused slot"), Reused.GetIndex(), Recycled.GetIndex());
+
+    Stash.MarkFrameCompleted(2);
+    const TArray<FHktEntityChange>& Changes = Stash.GetFrameChanges();
+    if (!TestEqual(TEXT("frame 2 changes"), Changes.Num(), 3))
+    {
+        return false;
+    }
+
+    // 슬롯 순, 같은 값만 쓴 엔티티는 없음
+    TestTrue(TEXT("written entity"), Changes[0].Entity == Written);
+    TestEqual(TEXT("written flags"), (int32)Changes[0].Flags, (int32)FHktEntityChange::Properties);
+    const int32 ExpectedGroups = (1 << (PropertyId::Health >> FHktEntityChange::PropertyGroupShift))
+        | (1 << (PropertyId::MaxMana >> FHktEntityChange::PropertyGroupShift))
+        | (1 << (PropertyId::OwnerPlayerHash >> FHktEntityChange::PropertyGroupShift));
+    TestEqual(TEXT("written property groups"), (int32)Changes[0].PropertyGroups, ExpectedGroups);
+    TestTrue(TEXT("health group dirty"), Changes[0].IsPropertyGroupDirty(PropertyId::Health));
+    TestFalse(TEXT("position group clean"), Changes[0].IsPropertyGroupDirty(PropertyId::AnimState));
+
+    // 해제된 슬롯은 세대가 올라가 있어도 해제된 ID (SlotGenerations - 1)로 보고
+    TestTrue(TEXT("freed entity keeps its id"), Changes[1].Entity == Freed);
+    TestFalse(TEXT("freed id is stale"), Stash.IsValidEntity(Changes[1].Entity));
+    TestEqual(TEXT("freed flags"), (int32)Changes[1].Flags, (int32)FHktEntityChange::Destroyed);
+    TestEqual(TEXT("freed property groups"), (int32)Changes[1].PropertyGroups, 0);
+
+    // 재할당된 슬롯은 새 ID 하나로 Created | Destroyed
+    TestTrue(TEXT("recycled slot reports the new id"), Changes[2].Entity == Reused);
+    TestEqual(TEXT("new generation"), Changes[2].Entity.GetGeneration(), Recycled.GetGeneration() + 1);
+    TestEqual(TEXT("recycled flags"), (int32)Changes[2].Flags, FHktEntityChange::Created | FHktEntityChange::Destroyed);
+
+    // 아무것도 바뀌지 않은 프레임은 빈 피드
+    Stash.MarkFrameCompleted(3);
+    TestEqual(TEXT("empty frame"), Stash.GetFrameChanges().Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktStashTagHierarchyTest, "HktCore.Stash.TagHierarchy",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktStashTagHierarchyTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag Ability = FGameplayTag::RequestGameplayTag(TEXT("Ability"));
+    const FGameplayTag Skill = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill"));
+    const FGameplayTag Fireball = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Fireball"));
+    const FGameplayTag Heal = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Heal"));
+    const FGameplayTag Burn = FGameplayTag::RequestGameplayTag(TEXT("Effect.Burn"));
+
+    FHktMasterStash Stash;
+    const FHktEntityId E = Stash.AllocateEntity();
+
+    // 자식 태그 하나로 부모 전체가 매칭 (MatchMask), 명시 태그는 자식뿐
+    Stash.AddTag(E, Fireball);
+    TestTrue(TEXT("child matches parent"), Stash.HasTag(E, Skill));
+    TestTrue(TEXT("child matches grandparent"), Stash.HasTag(E, Ability));
+    TestFalse(TEXT("parent is not explicit"), Stash.HasTagExact(E, Skill));
+    TestFalse(TEXT("sibling does not match"), Stash.HasTag(E, Heal));
+
+    // 부모 아래 명시 태그만 (ChildMask) - 다른 계층 태그는 제외
+    Stash.AddTag(E, Heal);
+    Stash.AddTag(E, Burn);
+    const FGameplayTagContainer Skills = Stash.GetTagsWithParent(E, Skill);
+    TestEqual(TEXT("tags under parent"), Skills.Num(), 2);
+    TestTrue(TEXT("fireball under parent"), Skills.HasTagExact(Fireball));
+    TestTrue(TEXT("heal under parent"), Skills.HasTagExact(Heal));
+    TestFalse(TEXT("burn not under parent"), Skills.HasTagExact(Burn));
+    TestTrue(TEXT("first tag under parent is in name order"), Stash.GetFirstTagWithParent(E, Skill) == Fireball);
+
+    // 형제 하나를 빼도 남은 형제가 부모 매칭을 유지 (RemoveTag가 남은 태그로 매칭을 다시 전개)
+    Stash.RemoveTag(E, Fireball);
+    TestFalse(TEXT("removed child"), Stash.HasTag(E, Fireball));
+    TestTrue(TEXT("parent kept by sibling"), Stash.HasTag(E, Skill));
+    TestTrue(TEXT("grandparent kept by sibling"), Stash.HasTag(E, Ability));
+
+    // 마지막 자식을 빼면 부모 매칭도 사라지고 다른 계층은 그대로
+    Stash.RemoveTag(E, Heal);
+    TestFalse(TEXT("parent cleared with last child"), Stash.HasTag(E, Skill));
+    TestFalse(TEXT("grandparent cleared with last child"), Stash.HasTag(E, Ability));
+    TestTrue(TEXT("other hierarchy untouched"), Stash.HasTag(E, Burn));
+    TestEqual(TEXT("explicit tags left"), Stash.GetTags(E).Num(), 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktStashFullStateTagRemapTest, "HktCore.Stash.FullStateTagRemap",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktStashFullStateTagRemapTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag Skill = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill"));
+    const FGameplayTag Fireball = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Fireball"));
+    const FGameplayTag Heal = FGameplayTag::RequestGameplayTag(TEXT("Ability.Skill.Heal"));
+    const FGameplayTag Burn = FGameplayTag::RequestGameplayTag(TEXT("Effect.Burn"));
+
+    // 기대 상태 - 이 프로세스의 등록 순서로 직접 구성
+    FHktMasterStash Expected;
+    const FHktEntityId E = Expected.AllocateEntity();
+    Expected.SetProperty(E, PropertyId::Health, 250);
+    Expected.AddTag(E, Heal);
+    Expected.AddTag(E, Burn);
+    Expected.MarkFrameCompleted(5);
+
+    // 다른 순서로 태그를 등록한 프로세스가 쓴 전체 상태 (SerializeFullState 포맷)
+    // 테이블 0번이 자식 태그 - 로컬 레지스트리는 부모를 먼저 등록하므로 인덱스가 같을 수 없음
+    const FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    TestTrue(TEXT("table order differs from the local registry"), Registry.FindIndex(Heal) != 0);
+
+    TArray<uint8> Data;
+    FMemoryWriter Writer(Data);
+    uint32 Magic = FHktMasterStash::FullStateMagic;
+    uint16 Version = FHktMasterStash::FullStateVersion;
+    uint16 TagBitsSize = sizeof(FHktTagBits::Words);
+    int32 Frame = 5;
+    int32 NextId = 1;
+    int32 NumValid = 1;
+    Writer << Magic << Version << TagBitsSize << Frame << NextId << NumValid;
+
+    TArray<FString> TagNames = { Heal.ToString(), Fireball.ToString(), Burn.ToString() };
+    int32 NumTags = TagNames.Num();
+    Writer << NumTags;
+    for (FString& TagName : TagNames)
+    {
+        Writer << TagName;
+    }
+
+    // 할당된 열 = Health, 엔티티 하나 (Heal = 0번, Burn = 2번 비트)
+    uint64 Columns[FHktStashLayout::MaxProperties / 64] = {};
+    Columns[PropertyId::Health >> 6] |= 1ull << (PropertyId::Health & 63);
+    for (uint64& Word : Columns)
+    {
+        Writer << Word;
+    }
+    int32 EntityInt = E.RawValue;
+    int32 Health = 250;
+    Writer << EntityInt << Health;
+    FHktTagBits Tags;
+    Tags.Set(0);
+    Tags.Set(2);
+    Writer.Serialize(Tags.Words, sizeof(Tags.Words));
+
+    int32 Generation = 0;
+    int32 NumFree = 0;
+    Writer << Generation << NumFree;
+
+    // 이름으로 비트를 옮기고 매칭 비트를 다시 전개
+    FHktMasterStash Restored;
+    Restored.DeserializeFullState(Data);
+    TestEqual(TEXT("entity count"), Restored.GetEntityCount(), 1);
+    TestEqual(TEXT("health"), Restored.GetProperty(E, PropertyId::Health), 250);
+    TestTrue(TEXT("heal remapped"), Restored.HasTagExact(E, Heal));
+    TestTrue(TEXT("burn remapped"), Restored.HasTagExact(E, Burn));
+    TestFalse(TEXT("fireball not set"), Restored.HasTagExact(E, Fireball));
+    TestTrue(TEXT("parent match rebuilt"), Restored.HasTag(E, Skill));
+    TestEqual(TEXT("explicit tags"), Restored.GetTags(E).Num(), 2);
+    TestEqual(TEXT("state hash"), Restored.GetStateHash(), Expected.GetStateHash());
+    TestEqual(TEXT("full checksum"), Restored.CalculateFullChecksum(), Expected.CalculateFullChecksum());
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,164 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HktCoreTestScene.h"
+#include "HktVMTrace.h"
+#include "VM/HktVMInterpreter.h"
+#include "VM/HktVMNative.h"
+#include "VM/HktVMStore.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ============================================================================
+// 네이티브/바이트코드 차등 테스트
+//
+// 네이티브 진입점이 연결된 모든 프로그램을 같은 장면에서 두 경로로 나란히 실행하고
+// 멈출 때마다 FHktVMInterpreter::FindExecutionMismatch로 비교합니다.
+// 예산을 여러 값으로 바꿔 임의의 PC에서 멈췄다 재개하는 경로까지 확인합니다.
+// ============================================================================
+
+namespace
+{
+    /** 한 실행 경로 - 인터프리터/아레나/Runtime/Store를 경로마다 따로 둠 */
+    struct FNativeTestLane
+    {
+        FHktVMInterpreter VM;
+        FHktVMQueryArena Arena;
+        FHktVMRuntime Runtime;
+        FHktVMStore Store;
+
+        void Init(FHktMasterStash& Stash, FHktVMSpatialIndex& Index, const FHktVMProgram& Program,
+            const FHktIntentEvent& Event, bool bNative)
+        {
+            VM.Initialize(&Stash);
+            VM.SetQueryArena(&Arena);
+            VM.SetSpatialIndex(&Index);
+            VM.bEnableNative = bNative;
+
+            // FHktVMProcessor::TryCreateVM과 같은 초기 상태
+            Store.Stash.Bind(&Stash);
+            Store.SourceEntity = Event.SourceEntity;
+            Store.TargetEntity = Event.TargetEntity;
+            Store.Write(PropertyId::TargetPosX, FMath::RoundToInt(Event.Location.X));
+            Store.Write(PropertyId::TargetPosY, FMath::RoundToInt(Event.Location.Y));
+            Store.Write(PropertyId::TargetPosZ, FMath::RoundToInt(Event.Location.Z));
+
+            Runtime.Program = &Program;
+            Runtime.Store = &Store;
+            Runtime.SlotIndex = 0;
+            Runtime.SetRegEntity(Reg::Self, Event.SourceEntity);
+            Runtime.SetRegEntity(Reg::Target, Event.TargetEntity);
+        }
+
+        /** 멈춘 이유를 프로세서처럼 해소 (생성 ID는 호출 측이 두 경로에 같은 값을 줌) */
+        void Resume(EVMStatus Status, FHktEntityId Spawned, FHktEntityId Hit)
+        {
+            if (Status == EVMStatus::PendingSpawn)
+            {
+                Runtime.SetRegEntity(Reg::Spawned, Spawned);
+                Store.WriteEntity(Spawned, PropertyId::OwnerEntity, Runtime.PendingSpawn.Owner);
+                Store.WriteEntity(Spawned, PropertyId::EntityType, Runtime.PendingSpawn.EntityType);
+                Runtime.PendingSpawn.Reset();
+            }
+            else if (Status == EVMStatus::WaitingEvent && Runtime.EventWait.Type == EWaitEventType::Collision)
+            {
+                Runtime.SetRegEntity(Reg::Hit, Hit);
+            }
+            Runtime.WaitFrames = 0;
+            Runtime.EventWait.Reset();
+        }
+    };
+
+    /** 프로그램 하나를 두 경로로 끝까지 실행 - 불일치면 설명을 OutError에 */
+    bool RunDifferential(const FHktVMProgram& Program, int32 BudgetPerStep, FString& OutError)
+    {
+        FHktMasterStash Stash;
+        const TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Stash, 16);
+        const FHktIntentEvent Event = HktCoreTest::MakeIntent(Units, 0, { Program.Tag }, 1);
+
+        FHktVMSpatialIndex Index;
+        Index.Initialize(&Stash);
+
+        TUniquePtr<FNativeTestLane> Native = MakeUnique<FNativeTestLane>();
+        TUniquePtr<FNativeTestLane> Bytecode = MakeUnique<FNativeTestLane>();
+        Native->Init(Stash, Index, Program, Event, true);
+        Bytecode->Init(Stash, Index, Program, Event, false);
+
+        // 재개 횟수 상한 - 무한 루프 Flow도 유한하게
+        constexpr int32 MaxSteps = 4096;
+        for (int32 Step = 0; Step < MaxSteps; ++Step)
+        {
+            int32 NativeBudget = BudgetPerStep;
+            int32 BytecodeBudget = BudgetPerStep;
+            const EVMStatus NativeStatus = Native->VM.Execute(Native->Runtime, NativeBudget);
+            const EVMStatus BytecodeStatus = Bytecode->VM.Execute(Bytecode->Runtime, BytecodeBudget);
+
+            if (const TCHAR* Mismatch = FHktVMInterpreter::FindExecutionMismatch(
+                NativeStatus, Native->Runtime, NativeBudget, BytecodeStatus, Bytecode->Runtime, BytecodeBudget))
+            {
+                OutError = FString::Printf(TEXT("%s (budget %d): %s differs at step %d (native PC %d, bytecode PC %d)"),
+                    *Program.Tag.ToString(), BudgetPerStep, Mismatch, Step, Native->Runtime.PC, Bytecode->Runtime.PC);
+                return false;
+            }
+
+            if (NativeStatus == EVMStatus::Completed || NativeStatus == EVMStatus::Failed)
+                return true;
+
+            FHktEntityId Spawned = InvalidEntityId;
+            if (NativeStatus == EVMStatus::PendingSpawn)
+            {
+                Spawned = Stash.AllocateEntity();
+                Index.AddEntity(Spawned);
+            }
+            Native->Resume(NativeStatus, Spawned, Units[1]);
+            Bytecode->Resume(BytecodeStatus, Spawned, Units[1]);
+        }
+        return true;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMNativeDifferentialTest, "HktCore.VM.NativeDifferential",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktVMNativeDifferentialTest::RunTest(const FString& Parameters)
+{
+    HktCoreTest::EnsureFlowsRegistered();
+
+    // 게임 타임라인에 테스트 실행이 섞이지 않도록
+    FHktVMTrace::FScopedSuppress SuppressTrace;
+
+    // 큰 예산 = 실제 프레임, 작은 예산 = 모든 PC에서 재개
+    const int32 Budgets[] = { FHktVMInterpreter::MaxInstructionsPerTick, 7, 3, 1 };
+
+    int32 NumCompared = 0;
+    for (const FGameplayTag& Tag : HktCoreTest::GetFlowTags())
+    {
+        const FHktVMProgram* Program = FHktVMProgramRegistry::Get().FindProgram(Tag);
+        if (!Program || !Program->bVerified)
+            continue;
+
+        if (!Program->NativeEntry)
+        {
+            AddInfo(FString::Printf(TEXT("%s: no native entry (not generated or bytecode changed)"), *Tag.ToString()));
+            continue;
+        }
+
+        for (int32 Budget : Budgets)
+        {
+            FString Error;
+            if (!RunDifferential(*Program, Budget, Error))
+            {
+                AddError(Error);
+            }
+        }
+        ++NumCompared;
+    }
+
+    if (NumCompared == 0)
+    {
+        AddWarning(TEXT("No native flows linked - regenerate HktVMNativeGenerated.cpp (hkt.VM.GenerateNative)"));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,221 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HktCoreTestScene.h"
+#include "HktVMTrace.h"
+#include "VM/HktVMInterpreter.h"
+#include "VM/HktVMStore.h"
+#include "Misc/ScopeExit.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ============================================================================
+// 빌드 시 최적화 차등 테스트
+//
+// 모든 기본 Flow를 bOptimizeOnBuild 켬/끔으로 각각 빌드해 같은 장면에서 끝까지 실행하고
+// 최종 Store 결과(합쳐진 PendingWrites, PendingDestroys)와 상태를 비교합니다.
+// 최적화는 명령어 수/PC를 바꾸므로 단계별이 아니라 완료 시점에 비교하고,
+// 예산을 여러 값으로 바꿔 융합된 명령어 앞뒤에서 멈췄다 재개하는 경로까지 확인합니다.
+// ============================================================================
+
+namespace
+{
+    /** Flow 한 번 실행 - Stash까지 실행마다 따로 두어 생성 ID가 두 빌드에서 같게 */
+    struct FOptimizerTestRun
+    {
+        FHktMasterStash Stash;
+        FHktVMSpatialIndex Index;
+        FHktVMInterpreter VM;
+        FHktVMQueryArena Arena;
+        FHktVMRuntime Runtime;
+        FHktVMStore Store;
+        EVMStatus Status = EVMStatus::Ready;
+
+        /** 완료/실패까지 실행 (멈출 때마다 프로세서처럼 생성/대기를 해소) - 상한 안에 끝나지 않으면 false */
+        bool Run(const FHktVMProgram& Program, int32 BudgetPerStep)
+        {
+            const TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Stash, 16);
+            const FHktIntentEvent Event = HktCoreTest::MakeIntent(Units, 0, { Program.Tag }, 1);
+
+            Index.Initialize(&Stash);
+            VM.Initialize(&Stash);
+            VM.SetQueryArena(&Arena);
+            VM.SetSpatialIndex(&Index);
+            VM.bEnableNative = false;
+
+            // FHktVMProcessor::TryCreateVM과 같은 초기 상태
+            Store.Stash.Bind(&Stash);
+            Store.SourceEntity = Event.SourceEntity;
+            Store.TargetEntity = Event.TargetEntity;
+            const int32* Params = reinterpret_cast<const int32*>(Event.Payload.GetData());
+            const int32 NumParams = FMath::Min((int32)(Event.Payload.Num() / sizeof(int32)), 4);
+            for (int32 i = 0; i < NumParams; ++i)
+            {
+                Store.Write(PropertyId::Param0 + i, Params[i]);
+            }
+            Store.Write(PropertyId::TargetPosX, FMath::RoundToInt(Event.Location.X));
+            Store.Write(PropertyId::TargetPosY, FMath::RoundToInt(Event.Location.Y));
+            Store.Write(PropertyId::TargetPosZ, FMath::RoundToInt(Event.Location.Z));
+
+            Runtime.Program = &Program;
+            Runtime.Store = &Store;
+            Runtime.SlotIndex = 0;
+            Runtime.SetRegEntity(Reg::Self, Event.SourceEntity);
+            Runtime.SetRegEntity(Reg::Target, Event.TargetEntity);
+
+            // 재개 횟수 상한 - 기본 Flow는 예산 1에서도 이 안에 끝남
+            constexpr int32 MaxSteps = 4096;
+            for (int32 Step = 0; Step < MaxSteps; ++Step)
+            {
+                int32 Budget = BudgetPerStep;
+                Status = VM.Execute(Runtime, Budget);
+                if (Status == EVMStatus::Completed || Status == EVMStatus::Failed)
+                    return true;
+
+                if (Status == EVMStatus::PendingSpawn)
+                {
+                    const FHktEntityId Spawned = Stash.AllocateEntity();
+                    Index.AddEntity(Spawned);
+                    Runtime.SetRegEntity(Reg::Spawned, Spawned);
+                    Store.WriteEntity(Spawned, PropertyId::OwnerEntity, Runtime.PendingSpawn.Owner);
+                    Store.WriteEntity(Spawned, PropertyId::EntityType, Runtime.PendingSpawn.EntityType);
+                    Runtime.PendingSpawn.Reset();
+                }
+                else if (Status == EVMStatus::WaitingEvent && Runtime.EventWait.Type == EWaitEventType::Collision)
+                {
+                    Runtime.SetRegEntity(Reg::Hit, Units[1]);
+                }
+                Runtime.WaitFrames = 0;
+                Runtime.EventWait.Reset();
+            }
+            return false;
+        }
+
+        /** 커밋 순서 (PropertyId, EntityId)로 정렬한 쓰기 - 처음 쓴 순서는 최적화로 바뀔 수 있음 */
+        TArray<FHktPropertyWrite> GetSortedWrites() const
+        {
+            TArray<FHktPropertyWrite> Writes = Store.PendingWrites;
+            Writes.Sort([](const FHktPropertyWrite& A, const FHktPropertyWrite& B)
+            {
+                return A.PropertyId != B.PropertyId ? A.PropertyId < B.PropertyId : A.Entity.RawValue < B.Entity.RawValue;
+            });
+            return Writes;
+        }
+    };
+
+    /** 같은 Flow의 두 빌드를 끝까지 실행해 비교 - 다르면 설명을 OutError에 */
+    bool CompareBuilds(const FHktVMProgram& Optimized, const FHktVMProgram& Unoptimized, int32 BudgetPerStep, FString& OutError)
+    {
+        TUniquePtr<FOptimizerTestRun> A = MakeUnique<FOptimizerTestRun>();
+        TUniquePtr<FOptimizerTestRun> B = MakeUnique<FOptimizerTestRun>();
+        const bool bFinishedA = A->Run(Optimized, BudgetPerStep);
+        const bool bFinishedB = B->Run(Unoptimized, BudgetPerStep);
+
+        const TCHAR* Mismatch = nullptr;
+        if (!bFinishedA || !bFinishedB)
+        {
+            Mismatch = TEXT("did not finish");
+        }
+        else if (A->Status != B->Status)
+        {
+            Mismatch = TEXT("status");
+        }
+        else if (A->Store.PendingDestroys != B->Store.PendingDestroys)
+        {
+            Mismatch = TEXT("pending destroys");
+        }
+        else
+        {
+            const TArray<FHktPropertyWrite> WritesA = A->GetSortedWrites();
+            const TArray<FHktPropertyWrite> WritesB = B->GetSortedWrites();
+            if (WritesA.Num() != WritesB.Num())
+            {
+                Mismatch = TEXT("pending write count");
+            }
+            for (int32 i = 0; !Mismatch && i < WritesA.Num(); ++i)
+            {
+                if (WritesA[i].Entity != WritesB[i].Entity || WritesA[i].PropertyId != WritesB[i].PropertyId || WritesA[i].Value != WritesB[i].Value)
+                {
+                    Mismatch = TEXT("pending writes");
+                }
+            }
+        }
+
+        if (Mismatch)
+        {
+            OutError = FString::Printf(TEXT("%s (budget %d): optimized/unoptimized %s differs (optimized PC %d, unoptimized PC %d)"),
+                *Optimized.Tag.ToString(), BudgetPerStep, Mismatch, A->Runtime.PC, B->Runtime.PC);
+            return false;
+        }
+        return true;
+    }
+
+    /** 기본 Flow를 지정한 최적화 설정으로 다시 등록하고 복사해 둠 (Tag → Program) */
+    TMap<FGameplayTag, FHktVMProgram> BuildFlows(bool bOptimize)
+    {
+        FFlowBuilder::bOptimizeOnBuild = bOptimize;
+        FlowDefinitions::RegisterAllFlows();
+
+        TMap<FGameplayTag, FHktVMProgram> Programs;
+        FHktVMProgramRegistry::Get().ForEachProgram([&Programs](const FHktVMProgram& Program)
+        {
+            Programs.Add(Program.Tag, Program);
+        });
+        return Programs;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMOptimizerDifferentialTest, "HktCore.VM.OptimizerDifferential",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktVMOptimizerDifferentialTest::RunTest(const FString& Parameters)
+{
+    HktCoreTest::EnsureFlowsRegistered();
+
+    // 게임 타임라인에 테스트 실행이 섞이지 않도록
+    FHktVMTrace::FScopedSuppress SuppressTrace;
+
+    // 끝나면 원래 설정으로 다시 등록 (다른 테스트/게임이 보는 레지스트리 복원)
+    const bool bWasOptimizing = FFlowBuilder::bOptimizeOnBuild;
+    ON_SCOPE_EXIT
+    {
+        FFlowBuilder::bOptimizeOnBuild = bWasOptimizing;
+        FlowDefinitions::RegisterAllFlows();
+    };
+
+    const TMap<FGameplayTag, FHktVMProgram> Optimized = BuildFlows(true);
+    const TMap<FGameplayTag, FHktVMProgram> Unoptimized = BuildFlows(false);
+
+    // 큰 예산 = 실제 프레임, 작은 예산 = 융합된 명령어 앞뒤 모든 지점에서 재개
+    const int32 Budgets[] = { FHktVMInterpreter::MaxInstructionsPerTick, 7, 3, 1 };
+
+    int32 NumChanged = 0;
+    for (const FGameplayTag& Tag : HktCoreTest::GetFlowTags())
+    {
+        const FHktVMProgram* A = Optimized.Find(Tag);
+        const FHktVMProgram* B = Unoptimized.Find(Tag);
+        if (!A || !B)
+            continue;
+
+        if (!TestTrue(FString::Printf(TEXT("%s verified in both builds"), *Tag.ToString()), A->bVerified && B->bVerified))
+            continue;
+
+        const bool bChanged = A->Code.Num() != B->Code.Num()
+            || FMemory::Memcmp(A->Code.GetData(), B->Code.GetData(), A->Code.Num() * sizeof(FInstruction)) != 0;
+        NumChanged += bChanged ? 1 : 0;
+        for (int32 Budget : Budgets)
+        {
+            FString Error;
+            if (!CompareBuilds(*A, *B, Budget, Error))
+            {
+                AddError(Error);
+            }
+        }
+    }
+
+    // 최적화가 아무 Flow도 바꾸지 않으면 이 테스트는 아무것도 확인하지 못함
+    TestTrue(TEXT("optimizer rewrote at least one flow"), NumChanged > 0);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,122 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HktCoreTestScene.h"
+#include "HktVMTrace.h"
+#include "VM/HktVMProcessor.h"
+#include "Misc/ScopeExit.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** 같은 장면/Intent를 주어진 설정으로 실행하고 프레임별 체크섬 기록 */
+    TArray<uint32> RunScenario(bool bParallel, bool bWide, int32 NumUnits, int32 NumFrames)
+    {
+        FHktMasterStash Stash;
+        const TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Stash, NumUnits);
+        const TArray<FGameplayTag> Tags = HktCoreTest::GetFlowTags();
+
+        FHktVMProcessor Processor;
+        Processor.Initialize(&Stash);
+        Processor.bEnableParallelExecution = bParallel;
+        Processor.bEnableWideExecution = bWide;
+
+        TArray<uint32> Checksums;
+        int32 EventId = 1;
+        for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+        {
+            // 처음 몇 프레임은 유닛마다 Intent, 이후 대기 중인 VM을 이벤트로 깨움
+            if (Frame <= 3)
+            {
+                for (int32 i = 0; i < Units.Num(); ++i)
+                {
+                    Processor.NotifyIntentEvent(HktCoreTest::MakeIntent(Units, (i + Frame) % Units.Num(), Tags, EventId++));
+                }
+            }
+            else if (Frame % 5 == 0)
+            {
+                for (int32 i = 0; i < Units.Num(); ++i)
+                {
+                    Processor.NotifyAnimEnd(Units[i]);
+                    Processor.NotifyMoveEnd(Units[i]);
+                    Processor.NotifyCollision(Units[i], Units[(i + 3) % Units.Num()]);
+                }
+            }
+
+            Processor.Tick(Frame, 1.0f / 30.0f);
+            Stash.MarkFrameCompleted(Frame);
+            Checksums.Add(Stash.CalculateChecksum());
+        }
+
+        // 증분 해시가 전체 재계산과 같은지도 확인
+        Checksums.Add(Stash.CalculateFullChecksum());
+        return Checksums;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMProcessorParallelDeterminismTest, "HktCore.VM.ParallelDeterminism",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktVMProcessorParallelDeterminismTest::RunTest(const FString& Parameters)
+{
+    HktCoreTest::EnsureFlowsRegistered();
+
+    // 워커 스레드도 기록하므로 스레드 억제 대신 전역으로 끔
+    const bool bTraceWasEnabled = FHktVMTrace::IsEnabled();
+    FHktVMTrace::SetEnabled(false);
+    ON_SCOPE_EXIT { FHktVMTrace::SetEnabled(bTraceWasEnabled); };
+
+    // 라운드당 VM이 MinParallelVMs보다 많아야 워커 스레드로 나뉨
+    constexpr int32 NumUnits = 512;
+    constexpr int32 NumFrames = 60;
+    static_assert(NumUnits >= FHktVMProcessor::MinParallelVMs * 4, "Scenario must be large enough to run in parallel");
+
+    const TArray<uint32> Serial = RunScenario(false, true, NumUnits, NumFrames);
+    const TArray<uint32> Parallel = RunScenario(true, true, NumUnits, NumFrames);
+
+    TestEqual(TEXT("Frame count"), Parallel.Num(), Serial.Num());
+    for (int32 i = 0; i < FMath::Min(Serial.Num(), Parallel.Num()); ++i)
+    {
+        if (Serial[i] != Parallel[i])
+        {
+            AddError(FString::Printf(TEXT("Checksum diverged at frame %d: serial 0x%08X, parallel 0x%08X"), i + 1, Serial[i], Parallel[i]));
+            break;
+        }
+    }
+
+    TestEqual(TEXT("Incremental checksum matches full recompute"), Serial.Last(), Serial[NumFrames - 1]);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMProcessorWideDeterminismTest, "HktCore.VM.WideDeterminism",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktVMProcessorWideDeterminismTest::RunTest(const FString& Parameters)
+{
+    HktCoreTest::EnsureFlowsRegistered();
+
+    const bool bTraceWasEnabled = FHktVMTrace::IsEnabled();
+    FHktVMTrace::SetEnabled(false);
+    ON_SCOPE_EXIT { FHktVMTrace::SetEnabled(bTraceWasEnabled); };
+
+    // Flow당 VM이 MinWideLanes보다 훨씬 많아야 같은 Program/PC 그룹이 광역 실행됨
+    constexpr int32 NumUnits = 512;
+    constexpr int32 NumFrames = 60;
+
+    const TArray<uint32> Scalar = RunScenario(true, false, NumUnits, NumFrames);
+    const TArray<uint32> Wide = RunScenario(true, true, NumUnits, NumFrames);
+
+    TestEqual(TEXT("Frame count"), Wide.Num(), Scalar.Num());
+    for (int32 i = 0; i < FMath::Min(Scalar.Num(), Wide.Num()); ++i)
+    {
+        if (Scalar[i] != Wide[i])
+        {
+            AddError(FString::Printf(TEXT("Checksum diverged at frame %d: scalar 0x%08X, wide 0x%08X"), i + 1, Scalar[i], Wide[i]));
+            break;
+        }
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
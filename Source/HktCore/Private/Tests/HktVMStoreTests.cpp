@@ -0,0 +1,85 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HktCoreTestScene.h"
+#include "VM/HktVMStore.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHktVMStoreWriteCoalescingTest, "HktCore.VM.StoreWriteCoalescing",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FHktVMStoreWriteCoalescingTest::RunTest(const FString& Parameters)
+{
+    FHktMasterStash Stash;
+    const TArray<FHktEntityId> Units = HktCoreTest::SpawnUnits(Stash, 40);
+
+    FHktVMStore Store;
+    Store.Stash.Bind(&Stash);
+
+    // 서로 다른 (엔티티, Property) 80개 - 인라인 캐시(48)를 넘어 OverflowCache까지 사용
+    const uint16 Props[] = { PropertyId::Health, PropertyId::Defense };
+    auto ForEachKey = [&Units, &Props](TFunctionRef<void(int32, FHktEntityId, uint16)> Func)
+    {
+        int32 Key = 0;
+        for (FHktEntityId E : Units)
+        {
+            for (uint16 Prop : Props)
+            {
+                Func(Key++, E, Prop);
+            }
+        }
+    };
+    const int32 NumKeys = Units.Num() * static_cast<int32>(UE_ARRAY_COUNT(Props));
+
+    ForEachKey([&Store](int32 Key, FHktEntityId E, uint16 Prop) { Store.WriteEntity(E, Prop, Key * 10 + 1); });
+    TestTrue(TEXT("more keys than the inline cache holds"), NumKeys > FHktVMStore::CacheCapacity);
+    TestEqual(TEXT("cache entries"), Store.GetCacheNum(), NumKeys);
+    TestEqual(TEXT("pending writes"), Store.PendingWrites.Num(), NumKeys);
+
+    // 같은 키 다시 쓰기 - 인라인/오버플로 모두 기존 항목에 합침 (처음 쓴 순서, 마지막 값)
+    ForEachKey([&Store](int32 Key, FHktEntityId E, uint16 Prop) { Store.WriteEntity(E, Prop, Key * 10 + 2); });
+    if (!TestEqual(TEXT("one pending write per key"), Store.PendingWrites.Num(), NumKeys))
+    {
+        return false;
+    }
+
+    int32 NumMismatches = 0;
+    ForEachKey([&Store, &NumMismatches](int32 Key, FHktEntityId E, uint16 Prop)
+    {
+        const FHktVMStore::FPendingWrite& W = Store.PendingWrites[Key];
+        const bool bMatches = W.Entity == E && W.PropertyId == Prop && W.Value == Key * 10 + 2
+            && Store.ReadEntity(E, Prop) == Key * 10 + 2;
+        NumMismatches += bMatches ? 0 : 1;
+    });
+    TestEqual(TEXT("pending writes and read-back hold the last value"), NumMismatches, 0);
+
+    // 커밋 전용 쓰기 - 같은 VM의 ReadEntity에는 보이지 않고 PendingWrites에만 (오버플로 구간)
+    const FHktEntityId DeferredOnly = Units[0];
+    const int32 StashAttack = Stash.GetProperty(DeferredOnly, PropertyId::AttackPower);
+    Store.WriteEntityDeferred(DeferredOnly, PropertyId::AttackPower, StashAttack + 500);
+    TestEqual(TEXT("deferred write hidden from ReadEntity"), Store.ReadEntity(DeferredOnly, PropertyId::AttackPower), StashAttack);
+    TestEqual(TEXT("deferred write pending"), Store.PendingWrites.Last().Value, StashAttack + 500);
+
+    // 보이는 쓰기 뒤의 커밋 전용 쓰기 - 읽기는 보이는 값 그대로, 커밋은 마지막 값
+    const FHktEntityId Visible = Units[1];
+    Store.WriteEntity(Visible, PropertyId::Health, 7);
+    Store.WriteEntityDeferred(Visible, PropertyId::Health, 8);
+    TestEqual(TEXT("visible value kept for reads"), Store.ReadEntity(Visible, PropertyId::Health), 7);
+    TestEqual(TEXT("still one pending write per key"), Store.PendingWrites.Num(), NumKeys + 1);
+
+    // 커밋 후 Stash에는 마지막 값
+    Stash.ApplyWrites(Store.PendingWrites);
+    TestEqual(TEXT("committed deferred value"), Stash.GetProperty(DeferredOnly, PropertyId::AttackPower), StashAttack + 500);
+    TestEqual(TEXT("committed last value"), Stash.GetProperty(Visible, PropertyId::Health), 8);
+    TestEqual(TEXT("committed rewritten value"), Stash.GetProperty(Units.Last(), PropertyId::Defense), (NumKeys - 1) * 10 + 2);
+
+    // 초기화하면 캐시도 비고 읽기는 Stash로
+    Store.ClearPendingWrites();
+    TestEqual(TEXT("cache cleared"), Store.GetCacheNum(), 0);
+    TestEqual(TEXT("reads fall back to the stash"), Store.ReadEntity(Visible, PropertyId::Health), 8);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -8,36 +8,48 @@
 FHktMasterStash::FHktMasterStash()
     : FHktStashBase()
 {
-    EntityCreationFrame.SetNumZeroed(MaxEntities);
-    EntityCells.Init(InvalidCell, MaxEntities);
+}
+
+void FHktMasterStash::OnCapacityGrown(int32 NewCapacity)
+{
+    EntityCreationFrame.SetNumZeroed(NewCapacity);
+    while (EntityCells.Num() < NewCapacity)
+    {
+        EntityCells.Add(InvalidCell);
+    }
 }
 
 void FHktMasterStash::ApplyWrites(const TArray<FPendingWrite>& Writes)
 {
-    // 위치 변경된 엔티티 추적
-    TSet<FHktEntityId> PositionChangedEntities;
+    FHktStashBase::ApplyWrites(Writes);
 
-    for (const auto& W : Writes)
+    // PosX, PosY, PosZ 중 하나라도 쓰인 엔티티의 슬롯 수집 (슬롯 전체를 초기화/순회하지 않음)
+    PositionWrittenSlots.Reset();
+    for (const FPendingWrite& W : Writes)
     {
-        SetProperty(W.Entity, W.PropertyId, W.Value);
-
-        // PosX, PosY, PosZ 중 하나라도 변경되면 셀 업데이트 필요
-        if (W.PropertyId == PropertyId::PosX ||
-            W.PropertyId == PropertyId::PosY ||
-            W.PropertyId == PropertyId::PosZ)
+        if (W.PropertyId <= PropertyId::PosZ && IsValidEntity(W.Entity))
         {
-            PositionChangedEntities.Add(W.Entity);
+            PositionWrittenSlots.Add(W.Entity.GetIndex());
         }
     }
 
-    // 위치 변경된 엔티티들의 셀 업데이트
-    for (FHktEntityId Entity : PositionChangedEntities)
+    if (PositionWrittenSlots.Num() == 0)
+        return;
+
+    // 슬롯 순 + 엔티티당 한 번 (셀 변경 이벤트 순서가 쓰기 순서와 무관) - 쓰인 엔티티 수에만 비례
+    PositionWrittenSlots.Sort();
+    int32 Previous = INDEX_NONE;
+    for (int32 Index : PositionWrittenSlots)
     {
+        if (Index == Previous)
+            continue;
+        Previous = Index;
+
+        const FHktEntityId Entity(SlotEntities[Index]);
         FVector Position;
         if (TryGetPosition(Entity, Position))
         {
-            FIntPoint NewCell = PositionToCell(Position);
-            UpdateEntityCell(Entity, NewCell);
+            UpdateEntityCell(Entity, PositionToCell(Position));
         }
     }
 }
@@ -46,7 +58,7 @@ bool FHktMasterStash::ValidateEntityFrame(FHktEntityId Entity, int32 FrameNumber
 {
     if (!IsValidEntity(Entity))
         return false;
-    return EntityCreationFrame[Entity] <= FrameNumber;
+    return EntityCreationFrame[Entity.GetIndex()] <= FrameNumber;
 }
 
 FHktEntitySnapshot FHktMasterStash::CreateEntitySnapshot(FHktEntityId Entity) const
@@ -57,16 +69,17 @@ FHktEntitySnapshot FHktMasterStash::CreateEntitySnapshot(FHktEntityId Entity) co
         return Snapshot;
     
     Snapshot.EntityId = Entity;
-    Snapshot.Properties.SetNum(MaxProperties);
     
-    // Property 복사
-    for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
+    // Property 복사 - 할당된 적 있는 가장 큰 열까지만 (나머지는 0, 적용 측에서 0으로 초기화)
+    const int32 NumProps = PopulatedColumns.GetEnd();
+    Snapshot.Properties.SetNum(NumProps);
+    for (int32 PropId = 0; PropId < NumProps; ++PropId)
     {
-        Snapshot.Properties[PropId] = Properties[PropId][Entity.RawValue];
+        Snapshot.Properties[PropId] = PropertyAt(Entity.GetIndex(), PropId);
     }
     
     // Tag 복사
-    Snapshot.Tags = EntityTags[Entity.RawValue];
+    Snapshot.Tags = FHktTagRegistry::Get().MakeContainer(SlotTags[Entity.GetIndex()]);
     
     return Snapshot;
 }
@@ -93,6 +106,14 @@ TArray<uint8> FHktMasterStash::SerializeFullState() const
     TArray<uint8> Data;
     FMemoryWriter Writer(Data);
     
+    // [Magic:4][Version:2][TagBitsSize:2] - 엔티티 태그 비트셋을 그대로 쓰므로 크기도 기록
+    uint32 Magic = FullStateMagic;
+    uint16 Version = FullStateVersion;
+    uint16 TagBitsSize = sizeof(FHktTagBits::Words);
+    Writer << Magic;
+    Writer << Version;
+    Writer << TagBitsSize;
+    
     int32 Frame = CompletedFrameNumber;
     int32 NextId = NextEntityId;
     Writer << Frame;
@@ -102,25 +123,54 @@ TArray<uint8> FHktMasterStash::SerializeFullState() const
     int32 NumValid = GetEntityCount();
     Writer << NumValid;
     
-    for (int32 E = 0; E < MaxEntities; ++E)
+    // 태그 테이블 (인덱스 → 이름) - 엔티티 태그는 비트셋 그대로 기록하고 읽는 쪽이 인덱스를 맞춤
+    const FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    int32 NumTags = Registry.Num();
+    Writer << NumTags;
+    for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
     {
-        if (ValidEntities[E])
+        FString TagName = Registry.GetTag(TagIndex).ToString();
+        Writer << TagName;
+    }
+    
+    // 할당된 열 마스크 - 엔티티마다 이 열들만 기록
+    FPropertyMask Columns = PopulatedColumns;
+    for (uint64& Word : Columns.Bits)
+    {
+        Writer << Word;
+    }
+    
+    ForEachLiveSlot([&](int32 Index)
+    {
+        int32 EntityInt = SlotEntities[Index];
+        Writer << EntityInt;
+        
+        // Properties
+        for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
         {
-            int32 EntityInt = E;
-            Writer << EntityInt;
-            
-            // Properties
-            for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
+            if (Columns.Test(PropId))
             {
-                int32 PropValue = Properties[PropId][E];
+                int32 PropValue = PropertyAt(Index, PropId);
                 Writer << PropValue;
             }
-            
-            // Tags (FGameplayTagContainer는 자체 직렬화 지원)
-            FGameplayTagContainer Tags = EntityTags[E];
-            bool bSerializeSuccess = false;
-            Tags.NetSerialize(Writer, nullptr, bSerializeSuccess);
         }
+        
+        // Tags - 비트셋 워드 그대로
+        FHktTagBits Tags = SlotTags[Index];
+        Writer.Serialize(Tags.Words, sizeof(Tags.Words));
+    });
+    
+    // 빈 슬롯의 다음 세대와 FreeList (복원 후 할당 순서/ID가 원본과 같도록)
+    for (int32 Index = 0; Index < NextEntityId; ++Index)
+    {
+        int32 Generation = SlotGenerations[Index];
+        Writer << Generation;
+    }
+    int32 NumFree = FreeList.Num();
+    Writer << NumFree;
+    for (int32 Index : FreeList)
+    {
+        Writer << Index;
     }
     
     return Data;
@@ -133,41 +183,126 @@ void FHktMasterStash::DeserializeFullState(const TArray<uint8>& Data)
     
     FMemoryReader Reader(Data);
     
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    uint16 TagBitsSize = 0;
+    Reader << Magic;
+    Reader << Version;
+    Reader << TagBitsSize;
+    
+    // 다른 포맷이면 현재 상태를 지우기 전에 거부
+    if (Reader.IsError() || Magic != FullStateMagic || Version != FullStateVersion || TagBitsSize != sizeof(FHktTagBits::Words))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[MasterStash] DeserializeFullState: unsupported format (magic 0x%08X, version %d, tag bits %d bytes)"),
+            Magic, Version, TagBitsSize);
+        return;
+    }
+    
     int32 Frame, NextId;
     Reader << Frame;
     Reader << NextId;
     
+    // Clear all
+    ResetStorage();
+    EntityCells.Reset();
+    EntityCreationFrame.Reset();
+    CellToEntities.Reset();
+    
     CompletedFrameNumber = Frame;
+    if (NextId > 0)
+    {
+        EnsureCapacity(NextId - 1);
+    }
     NextEntityId = NextId;
     
-    // Clear all
-    ValidEntities.Init(false, MaxEntities);
-    FreeList.Reset();
-    
     int32 NumValid = 0;
     Reader << NumValid;
     
+    // 태그 테이블 - 저장한 프로세스와 인덱스가 같으면 비트셋을 그대로 쓰고, 다르면 비트를 옮김
+    FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    int32 NumTags = 0;
+    Reader << NumTags;
+    TArray<int32> TagRemap;
+    bool bSameTagIndices = true;
+    for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+    {
+        FString TagName;
+        Reader << TagName;
+        const int32 LocalIndex = Registry.FindOrAddIndex(FGameplayTag::RequestGameplayTag(FName(*TagName), false));
+        TagRemap.Add(LocalIndex);
+        bSameTagIndices &= (LocalIndex == TagIndex);
+    }
+    
+    FPropertyMask Columns;
+    for (uint64& Word : Columns.Bits)
+    {
+        Reader << Word;
+    }
+    
     for (int32 i = 0; i < NumValid; ++i)
     {
         int32 EntityInt;
         Reader << EntityInt;
         
         FHktEntityId E(EntityInt);
-        ValidEntities[E.RawValue] = true;
+        ActivateSlot(E);
         
         // Properties
         for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
         {
-            int32 PropValue;
-            Reader << PropValue;
-            Properties[PropId][E.RawValue] = PropValue;
+            if (Columns.Test(PropId))
+            {
+                int32 PropValue;
+                Reader << PropValue;
+                WritePropertyAt(E.GetIndex(), PropId, PropValue);
+            }
         }
         
         // Tags
-        bool bSerializeSuccess = false;
-        EntityTags[E.RawValue].NetSerialize(Reader, nullptr, bSerializeSuccess);
+        FHktTagBits Tags;
+        Reader.Serialize(Tags.Words, sizeof(Tags.Words));
+        if (!bSameTagIndices)
+        {
+            FHktTagBits Remapped;
+            Tags.ForEachSetBit([&TagRemap, &Remapped](int32 TagIndex)
+            {
+                if (TagRemap.IsValidIndex(TagIndex) && TagRemap[TagIndex] != INDEX_NONE)
+                {
+                    Remapped.Set(TagRemap[TagIndex]);
+                }
+            });
+            Tags = Remapped;
+        }
+        SetSlotTagBits(E.GetIndex(), Tags);
     }
     
+    for (int32 Index = 0; Index < NextEntityId; ++Index)
+    {
+        int32 Generation = 0;
+        Reader << Generation;
+        SlotGenerations[Index] = static_cast<uint16>(Generation);
+    }
+    int32 NumFree = 0;
+    Reader << NumFree;
+    for (int32 i = 0; i < NumFree; ++i)
+    {
+        int32 Index = 0;
+        Reader << Index;
+        FreeList.Add(Index);
+    }
+    
+    // 셀 인덱스 재구축
+    ForEachEntity([this](FHktEntityId Entity)
+    {
+        FVector Pos;
+        if (TryGetPosition(Entity, Pos))
+        {
+            const FIntPoint Cell = PositionToCell(Pos);
+            EntityCells[Entity.GetIndex()] = Cell;
+            CellToEntities.FindOrAdd(Cell).Add(Entity);
+        }
+    });
+    
     UE_LOG(LogTemp, Log, TEXT("[MasterStash] Deserialized: Frame=%d, Entities=%d"), 
         CompletedFrameNumber, NumValid);
 }
@@ -205,29 +340,16 @@ void FHktMasterStash::SetPosition(FHktEntityId Entity, const FVector& Position)
 
 uint32 FHktMasterStash::CalculatePartialChecksum(const TArray<FHktEntityId>& Entities) const
 {
-    uint32 Checksum = 0;
-    
+    // 엔티티별 상태 해시의 합 - VisibleStash에서 같은 집합으로 계산한 값과 비교 가능
+    uint64 Hash = 0;
     for (FHktEntityId E : Entities)
     {
-        if (!IsValidEntity(E))
-            continue;
-        
-        for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
-        {
-            Checksum ^= Properties[PropId][E.RawValue];
-            Checksum = (Checksum << 1) | (Checksum >> 31);
-        }
-        
-        for (const FGameplayTag& Tag : EntityTags[E.RawValue])
+        if (IsValidEntity(E))
         {
-            Checksum ^= GetTypeHash(Tag);
-            Checksum = (Checksum << 1) | (Checksum >> 31);
+            Hash += HashSlot(E.GetIndex());
         }
-        
-        Checksum ^= E.RawValue;
     }
-    
-    return Checksum;
+    return static_cast<uint32>(Hash) ^ static_cast<uint32>(Hash >> 32);
 }
 
 void FHktMasterStash::ForEachEntityInRadius(FHktEntityId Center, int32 RadiusCm, TFunctionRef<void(FHktEntityId)> Callback) const
@@ -235,28 +357,34 @@ void FHktMasterStash::ForEachEntityInRadius(FHktEntityId Center, int32 RadiusCm,
     if (!IsValidEntity(Center))
         return;
 
-    int32 CX = GetProperty(Center, PropertyId::PosX);
-    int32 CY = GetProperty(Center, PropertyId::PosY);
-    int32 CZ = GetProperty(Center, PropertyId::PosZ);
+    const int32 CenterIndex = Center.GetIndex();
+    int32 CX = PropertyAt(CenterIndex, PropertyId::PosX);
+    int32 CY = PropertyAt(CenterIndex, PropertyId::PosY);
+    int32 CZ = PropertyAt(CenterIndex, PropertyId::PosZ);
     int64 RadiusSq = static_cast<int64>(RadiusCm) * RadiusCm;
 
-    ForEachEntity([&](FHktEntityId E)
+    // 밀집 배열을 훑어 후보 수집 → 슬롯 순 정렬 후 콜백 (결과 순서는 할당/해제 이력과 무관)
+    TArray<int32> Hits;
+    for (FHktEntityId E : LiveEntities)
     {
-        if (E.RawValue == Center.RawValue) return;
+        const int32 Index = E.GetIndex();
+        if (Index == CenterIndex) continue;
 
-        int32 EX = GetProperty(E, PropertyId::PosX);
-        int32 EY = GetProperty(E, PropertyId::PosY);
-        int32 EZ = GetProperty(E, PropertyId::PosZ);
-
-        int64 DX = EX - CX;
-        int64 DY = EY - CY;
-        int64 DZ = EZ - CZ;
+        int64 DX = PropertyAt(Index, PropertyId::PosX) - CX;
+        int64 DY = PropertyAt(Index, PropertyId::PosY) - CY;
+        int64 DZ = PropertyAt(Index, PropertyId::PosZ) - CZ;
 
         if (DX*DX + DY*DY + DZ*DZ <= RadiusSq)
         {
-            Callback(E);
+            Hits.Add(Index);
         }
-    });
+    }
+
+    Hits.Sort();
+    for (int32 Index : Hits)
+    {
+        Callback(FHktEntityId(SlotEntities[Index]));
+    }
 }
 
 // ========== Cell-based Spatial Indexing ==========
@@ -267,7 +395,7 @@ FHktEntityId FHktMasterStash::AllocateEntity()
     if (Entity != InvalidEntityId)
     {
         // 새 엔티티는 아직 위치가 없으므로 InvalidCell
-        EntityCells[Entity.RawValue] = InvalidCell;
+        EntityCells[Entity.GetIndex()] = InvalidCell;
     }
     return Entity;
 }
@@ -276,7 +404,7 @@ void FHktMasterStash::FreeEntity(FHktEntityId Entity)
 {
     if (IsValidEntity(Entity))
     {
-        FIntPoint OldCell = EntityCells[Entity.RawValue];
+        FIntPoint OldCell = EntityCells[Entity.GetIndex()];
 
         // 셀에서 제거
         if (OldCell != InvalidCell)
@@ -298,7 +426,7 @@ void FHktMasterStash::FreeEntity(FHktEntityId Entity)
             PendingCellChangeEvents.Add(Event);
         }
 
-        EntityCells[Entity.RawValue] = InvalidCell;
+        EntityCells[Entity.GetIndex()] = InvalidCell;
     }
 
     FHktStashBase::FreeEntity(Entity);
@@ -320,7 +448,7 @@ void FHktMasterStash::SetCellSize(float InCellSize)
             if (TryGetPosition(Entity, Pos))
             {
                 FIntPoint NewCell = PositionToCell(Pos);
-                EntityCells[Entity.RawValue] = NewCell;
+                EntityCells[Entity.GetIndex()] = NewCell;
                 CellToEntities.FindOrAdd(NewCell).Add(Entity);
             }
         });
@@ -335,7 +463,7 @@ FIntPoint FHktMasterStash::GetEntityCell(FHktEntityId Entity) const
     {
         return InvalidCell;
     }
-    return EntityCells[Entity.RawValue];
+    return EntityCells[Entity.GetIndex()];
 }
 
 const TSet<FHktEntityId>* FHktMasterStash::GetEntitiesInCell(FIntPoint Cell) const
@@ -371,7 +499,7 @@ FIntPoint FHktMasterStash::PositionToCell(const FVector& Position) const
 
 void FHktMasterStash::UpdateEntityCell(FHktEntityId Entity, FIntPoint NewCell)
 {
-    FIntPoint OldCell = EntityCells[Entity.RawValue];
+    FIntPoint OldCell = EntityCells[Entity.GetIndex()];
 
     if (OldCell == NewCell)
     {
@@ -398,7 +526,7 @@ void FHktMasterStash::UpdateEntityCell(FHktEntityId Entity, FIntPoint NewCell)
     }
 
     // 셀 업데이트
-    EntityCells[Entity.RawValue] = NewCell;
+    EntityCells[Entity.GetIndex()] = NewCell;
 
     // 변경 이벤트 발생
     FHktCellChangeEvent Event;
@@ -18,6 +18,10 @@ public:
     FHktMasterStash();
     virtual ~FHktMasterStash() override = default;
 
+    /** 전체 상태 포맷 (SerializeFullState) - 레이아웃이 바뀌면 버전을 올림 */
+    static constexpr uint32 FullStateMagic = 0x53544B48;    // 'HKTS'
+    static constexpr uint16 FullStateVersion = 1;
+
     // ========== IHktStashInterface Implementation ==========
     virtual FHktEntityId AllocateEntity() override;
     virtual void FreeEntity(FHktEntityId Entity) override;
@@ -27,11 +31,15 @@ public:
     virtual int32 GetEntityCount() const override { return FHktStashBase::GetEntityCount(); }
     virtual int32 GetCompletedFrameNumber() const override { return FHktStashBase::GetCompletedFrameNumber(); }
     virtual void MarkFrameCompleted(int32 FrameNumber) override { FHktStashBase::MarkFrameCompleted(FrameNumber); }
+    virtual const TArray<FHktEntityChange>& GetFrameChanges() const override { return FHktStashBase::GetFrameChanges(); }
     virtual void ForEachEntity(TFunctionRef<void(FHktEntityId)> Callback) const override { FHktStashBase::ForEachEntity(Callback); }
     virtual uint32 CalculateChecksum() const override { return FHktStashBase::CalculateChecksum(); }
+    virtual uint32 CalculateFullChecksum() const override { return FHktStashBase::CalculateFullChecksum(); }
+    virtual void GetEntityGroupHashes(FHktEntityId Entity, uint64 (&OutHashes)[HktHashGroup::Num]) const override { FHktStashBase::GetEntityGroupHashes(Entity, OutHashes); }
+    virtual const FHktStashBase* GetStorage() const override { return this; }
 
     // ========== Tag API Implementation ==========
-    virtual const FGameplayTagContainer& GetTags(FHktEntityId Entity) const override { return FHktStashBase::GetTags(Entity); }
+    virtual FGameplayTagContainer GetTags(FHktEntityId Entity) const override { return FHktStashBase::GetTags(Entity); }
     virtual void SetTags(FHktEntityId Entity, const FGameplayTagContainer& Tags) override { FHktStashBase::SetTags(Entity, Tags); }
     virtual void AddTag(FHktEntityId Entity, const FGameplayTag& Tag) override { FHktStashBase::AddTag(Entity, Tag); }
     virtual void RemoveTag(FHktEntityId Entity, const FGameplayTag& Tag) override { FHktStashBase::RemoveTag(Entity, Tag); }
@@ -62,6 +70,10 @@ public:
     virtual TArray<FHktCellChangeEvent> ConsumeCellChangeEvents() override;
     virtual void GetEntitiesInCells(const TSet<FIntPoint>& Cells, TSet<FHktEntityId>& OutEntities) const override;
 
+protected:
+    /** 슬롯별 배열(생성 프레임, 셀)을 Stash 용량에 맞춤 */
+    virtual void OnCapacityGrown(int32 NewCapacity) override;
+
 private:
     /** 위치 → 셀 변환 */
     FIntPoint PositionToCell(const FVector& Position) const;
@@ -69,7 +81,7 @@ private:
     /** 엔티티의 셀 변경 처리 (내부용) */
     void UpdateEntityCell(FHktEntityId Entity, FIntPoint NewCell);
 
-    /** 엔티티 생성 프레임 (Validation용) */
+    /** 엔티티 생성 프레임 (Validation용, 슬롯 인덱스) */
     TArray<int32> EntityCreationFrame;
 
     // ========== Cell Spatial Index ==========
@@ -80,9 +92,12 @@ private:
     /** 셀 → 엔티티 Set 매핑 */
     TMap<FIntPoint, TSet<FHktEntityId>> CellToEntities;
 
-    /** 엔티티 → 현재 셀 매핑 */
+    /** 엔티티 → 현재 셀 매핑 (슬롯 인덱스) */
     TArray<FIntPoint> EntityCells;
 
     /** 이번 프레임의 셀 변경 이벤트 */
     TArray<FHktCellChangeEvent> PendingCellChangeEvents;
+
+    /** ApplyWrites 중 위치가 쓰인 엔티티의 슬롯 인덱스 (재사용 버퍼, 중복 가능) */
+    TArray<int32> PositionWrittenSlots;
 };
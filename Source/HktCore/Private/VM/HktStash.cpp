@@ -2,31 +2,88 @@
 
 #include "HktStash.h"
 
-const FGameplayTagContainer FHktStashBase::EmptyTagContainer;
+// ============================================================================
+// 상태 해시 믹스 - 항목별 64비트 값을 더하므로 빼서 되돌릴 수 있음
+// ============================================================================
+
+namespace
+{
+    FORCEINLINE uint64 Mix64(uint64 X)
+    {
+        X ^= X >> 30; X *= 0xBF58476D1CE4E5B9ull;
+        X ^= X >> 27; X *= 0x94D049BB133111EBull;
+        X ^= X >> 31;
+        return X;
+    }
+
+    FORCEINLINE uint64 MixEntity(int32 RawId)
+    {
+        return Mix64(static_cast<uint64>(static_cast<uint32>(RawId)) ^ 0xE7037ED1A0B428DBull);
+    }
+
+    /** 0 값은 기여 없음 (빈 열/초기화가 해시를 건드리지 않도록) - 분기 없이 마스크 */
+    FORCEINLINE uint64 MixProperty(int32 RawId, int32 PropId, int32 Value)
+    {
+        const uint64 Key = Mix64((static_cast<uint64>(static_cast<uint32>(RawId)) << 8) | static_cast<uint64>(PropId));
+        return Mix64(Key + static_cast<uint32>(Value)) & (0ull - static_cast<uint64>(Value != 0));
+    }
+
+    /** TagHash는 FHktTagRegistry::GetStableHash (태그 문자열 해시 - FName 인덱스와 달리 프로세스 간 동일) */
+    FORCEINLINE uint64 MixTag(int32 RawId, uint64 TagHash)
+    {
+        return Mix64((static_cast<uint64>(static_cast<uint32>(RawId)) << 32) ^ Mix64(TagHash ^ 0x8EBC6AF09C88C6E3ull));
+    }
+
+    FORCEINLINE uint32 FoldChecksum(uint64 Hash, int32 FrameNumber)
+    {
+        return static_cast<uint32>(Hash) ^ static_cast<uint32>(Hash >> 32) ^ static_cast<uint32>(FrameNumber);
+    }
+}
 
 FHktStashBase::FHktStashBase()
 {
-    Properties.SetNum(MaxProperties);
-    for (int32 i = 0; i < MaxProperties; ++i)
+    // 청크는 첫 할당 시 생성
+}
+
+void FHktStashBase::EnsureCapacity(int32 Index)
+{
+    if (Index < GetCapacity())
+        return;
+    
+    while (Index >= GetCapacity())
     {
-        Properties[i].SetNumZeroed(MaxEntities);
+        Chunks.AddDefaulted();
     }
     
-    EntityTags.SetNum(MaxEntities);
-    ValidEntities.Init(false, MaxEntities);
+    const int32 NewCapacity = GetCapacity();
+    SlotTags.SetNum(NewCapacity);
+    SlotTagMatches.SetNum(NewCapacity);
+    DirtyWords.SetNumZeroed(NewCapacity / 64);
+    LiveWords.SetNumZeroed(NewCapacity / 64);
+    SlotChangeFlags.SetNumZeroed(NewCapacity);
+    SlotChangeGroups.SetNumZeroed(NewCapacity);
+    while (SlotEntities.Num() < NewCapacity)
+    {
+        SlotEntities.Add(INDEX_NONE);
+        SlotGenerations.Add(0);
+        SlotLiveIndex.Add(INDEX_NONE);
+    }
+    
+    OnCapacityGrown(NewCapacity);
 }
 
 FHktEntityId FHktStashBase::AllocateEntity()
 {
-    FHktEntityId Id;
+    int32 Index;
     
     if (FreeList.Num() > 0)
     {
-        Id = FreeList.Pop();
+        Index = FreeList.Pop();
     }
     else if (NextEntityId < MaxEntities)
     {
-        Id = NextEntityId++;
+        Index = NextEntityId++;
+        EnsureCapacity(Index);
     }
     else
     {
@@ -34,108 +91,273 @@ FHktEntityId FHktStashBase::AllocateEntity()
         return InvalidEntityId;
     }
     
-    ValidEntities[Id] = true;
+    const FHktEntityId Id = FHktEntityId::Make(Index, SlotGenerations[Index]);
+    AddLiveSlot(Index, Id);
+    StateHash += MixEntity(Id.RawValue);
     
-    // 속성 초기화
-    for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
-    {
-        Properties[PropId][Id] = 0;
-    }
+    // 속성 초기화 (할당된 열만)
+    ClearSlotProperties(Index);
     
     // 태그 초기화
-    EntityTags[Id].Reset();
+    SlotTags[Index].Reset();
+    SlotTagMatches[Index].Reset();
     
-    OnEntityDirty(Id);
+    MarkChanged(Index, FHktEntityChange::Created);
     
-    UE_LOG(LogTemp, Verbose, TEXT("[Stash] Entity %d allocated"), Id.RawValue);
+    UE_LOG(LogTemp, Verbose, TEXT("[Stash] Entity %d allocated (slot %d, gen %d)"), Id.RawValue, Index, Id.GetGeneration());
     return Id;
 }
 
 void FHktStashBase::FreeEntity(FHktEntityId Entity)
 {
-    if (Entity.RawValue >= 0 && Entity.RawValue < MaxEntities && ValidEntities[Entity.RawValue])
+    if (IsValidEntity(Entity))
     {
-        ValidEntities[Entity.RawValue] = false;
-        EntityTags[Entity.RawValue].Reset();
-        FreeList.Add(Entity);
-        OnEntityDirty(Entity);
+        const int32 Index = Entity.GetIndex();
+        StateHash -= HashSlot(Index);
+        RemoveLiveSlot(Index);
+        SlotGenerations[Index] = static_cast<uint16>((Entity.GetGeneration() + 1) & FHktEntityId::GenerationMask);
+        SlotTags[Index].Reset();
+        SlotTagMatches[Index].Reset();
+        FreeList.Add(Index);
+        MarkChanged(Index, FHktEntityChange::Destroyed);
         
         UE_LOG(LogTemp, Verbose, TEXT("[Stash] Entity %d freed"), Entity.RawValue);
     }
 }
 
-bool FHktStashBase::IsValidEntity(FHktEntityId Entity) const
+void FHktStashBase::SetProperty(FHktEntityId Entity, uint16 PropertyId, int32 Value)
 {
-    return Entity.RawValue >= 0 && Entity.RawValue < MaxEntities && ValidEntities[Entity.RawValue];
+    if (Entity.RawValue < 0 || PropertyId >= MaxProperties)
+        return;
+    
+    // 자동 생성 모드 (VisibleStash용)
+    AutoCreateEntity(Entity);
+    
+    if (!IsValidEntity(Entity))
+        return;
+    
+    if (WritePropertyAt(Entity.GetIndex(), PropertyId, Value))
+    {
+        MarkChanged(Entity.GetIndex(), FHktEntityChange::Properties, FHktEntityChange::GetPropertyGroupBit(PropertyId));
+    }
 }
 
-int32 FHktStashBase::GetProperty(FHktEntityId Entity, uint16 PropertyId) const
+bool FHktStashBase::WritePropertyAt(int32 Index, uint16 PropertyId, int32 Value)
 {
-    if (!IsValidEntity(Entity) || PropertyId >= MaxProperties)
-        return 0;
-    return Properties[PropertyId][Entity.RawValue];
+    FChunk& Chunk = Chunks[Index >> ChunkShift];
+    int32* Column = Chunk.Columns[PropertyId];
+    if (!Column)
+    {
+        // 빈 열은 모두 0 - 0을 쓰면 변화 없음
+        if (Value == 0)
+            return false;
+        Column = AllocateComponent(Chunk, PropertyId);
+    }
+    
+    int32& Slot = Column[Index & ChunkMask];
+    if (Slot == Value)
+        return false;
+    
+    const int32 RawId = SlotEntities[Index];
+    StateHash += MixProperty(RawId, PropertyId, Value) - MixProperty(RawId, PropertyId, Slot);
+    Slot = Value;
+    return true;
 }
 
-void FHktStashBase::SetProperty(FHktEntityId Entity, uint16 PropertyId, int32 Value)
+void FHktStashBase::ClearSlotProperties(int32 Index)
 {
-    if (Entity.RawValue < 0 || Entity.RawValue >= MaxEntities || PropertyId >= MaxProperties)
-        return;
+    FChunk& Chunk = Chunks[Index >> ChunkShift];
+    const int32 End = PopulatedColumns.GetEnd();
+    for (int32 PropId = 0; PropId < End; ++PropId)
+    {
+        if (Chunk.Columns[PropId])
+        {
+            Chunk.Columns[PropId][Index & ChunkMask] = 0;
+        }
+    }
+}
+
+int32* FHktStashBase::AllocateComponent(FChunk& Chunk, uint16 PropertyId)
+{
+    const FHktStashLayout& Layout = FHktStashLayout::Get();
+    const int32 Component = Layout.PropertyComponent[PropertyId];
+    const int32 First = Layout.ComponentFirst[Component];
+    const int32 Size = Layout.ComponentSize[Component];
     
-    // 자동 생성 모드 (VisibleStash용)
-    if (bAutoCreateOnSet && !ValidEntities[Entity.RawValue])
+    TArray<int32>& Block = Chunk.Components[Component];
+    Block.SetNumZeroed(Size * ChunkSize);
+    for (int32 Lane = 0; Lane < Size; ++Lane)
+    {
+        Chunk.Columns[First + Lane] = Block.GetData() + Lane * ChunkSize;
+        PopulatedColumns.Set(First + Lane);
+    }
+    return Chunk.Columns[PropertyId];
+}
+
+int32 FHktStashBase::GetNumAllocatedColumns() const
+{
+    int32 Count = 0;
+    for (const FChunk& Chunk : Chunks)
     {
-        ValidEntities[Entity.RawValue] = true;
-        if (Entity.RawValue >= NextEntityId)
-            NextEntityId = Entity.RawValue + 1;
-        
         for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
         {
-            Properties[PropId][Entity.RawValue] = 0;
+            Count += Chunk.Columns[PropId] ? 1 : 0;
+        }
+    }
+    return Count;
+}
+
+void FHktStashBase::ApplyWrites(const TArray<FHktPropertyWrite>& Writes)
+{
+    // 자동 생성은 열을 쓰기 전에 모두 처리 (생성 시 모든 열을 0으로 초기화하므로 먼저 쓴 열을 덮지 않도록)
+    if (bAutoCreateOnSet)
+    {
+        for (const FHktPropertyWrite& W : Writes)
+        {
+            if (W.Entity.RawValue >= 0 && W.PropertyId < MaxProperties)
+            {
+                AutoCreateEntity(W.Entity);
+            }
         }
-        EntityTags[Entity.RawValue].Reset();
     }
     
-    if (!ValidEntities[Entity.RawValue])
+    // 정렬된 입력이면 (PropertyId, 청크)가 바뀔 때만 열 포인터를 다시 찾음
+    int32* Column = nullptr;
+    uint16 ColumnId = 0xFFFF;
+    int32 ColumnChunk = INDEX_NONE;
+    uint8 ColumnGroup = 0;
+    
+    for (const FHktPropertyWrite& W : Writes)
+    {
+        if (W.PropertyId >= MaxProperties || !IsValidEntity(W.Entity))
+            continue;
+        
+        const int32 Index = W.Entity.GetIndex();
+        const int32 ChunkIndex = Index >> ChunkShift;
+        if (W.PropertyId != ColumnId || ChunkIndex != ColumnChunk)
+        {
+            ColumnId = W.PropertyId;
+            ColumnChunk = ChunkIndex;
+            ColumnGroup = FHktEntityChange::GetPropertyGroupBit(ColumnId);
+            Column = Chunks[ChunkIndex].Columns[ColumnId];
+        }
+        
+        if (!Column)
+        {
+            // 빈 열: 0이 아닌 첫 값에서 컴포넌트 블록 할당
+            if (W.Value == 0)
+                continue;
+            Column = AllocateComponent(Chunks[ChunkIndex], ColumnId);
+        }
+        
+        int32& Slot = Column[Index & ChunkMask];
+        if (Slot != W.Value)
+        {
+            StateHash += MixProperty(W.Entity.RawValue, ColumnId, W.Value) - MixProperty(W.Entity.RawValue, ColumnId, Slot);
+            Slot = W.Value;
+            MarkChanged(Index, FHktEntityChange::Properties, ColumnGroup);
+        }
+    }
+}
+
+void FHktStashBase::AutoCreateEntity(FHktEntityId Entity)
+{
+    if (!bAutoCreateOnSet || IsValidEntity(Entity))
         return;
     
-    if (Properties[PropertyId][Entity.RawValue] != Value)
+    ActivateSlot(Entity);
+}
+
+void FHktStashBase::ActivateSlot(FHktEntityId Entity)
+{
+    const int32 Index = Entity.GetIndex();
+    EnsureCapacity(Index);
+    
+    // 같은 슬롯의 다른 세대가 남아 있으면 (해제 통지를 못 받은 경우) 새 엔티티로 교체
+    if (SlotEntities[Index] != INDEX_NONE)
+    {
+        StateHash -= HashSlot(Index);
+    }
+    AddLiveSlot(Index, Entity);
+    StateHash += MixEntity(Entity.RawValue);
+    SlotGenerations[Index] = static_cast<uint16>(Entity.GetGeneration());
+    if (Index >= NextEntityId)
+        NextEntityId = Index + 1;
+    
+    ClearSlotProperties(Index);
+    SlotTags[Index].Reset();
+    SlotTagMatches[Index].Reset();
+    MarkChanged(Index, FHktEntityChange::Created);
+}
+
+void FHktStashBase::ResetStorage()
+{
+    Chunks.Reset();
+    PopulatedColumns = FPropertyMask();
+    DirtyWords.Reset();
+    SlotChangeFlags.Reset();
+    SlotChangeGroups.Reset();
+    FrameChanges.Reset();
+    StateHash = 0;
+    SlotTags.Reset();
+    SlotTagMatches.Reset();
+    SlotEntities.Reset();
+    SlotGenerations.Reset();
+    LiveWords.Reset();
+    LiveEntities.Reset();
+    SlotLiveIndex.Reset();
+    FreeList.Reset();
+    NextEntityId = 0;
+}
+
+void FHktStashBase::AddLiveSlot(int32 Index, FHktEntityId Entity)
+{
+    SlotEntities[Index] = Entity.RawValue;
+    if (SlotLiveIndex[Index] != INDEX_NONE)
     {
-        Properties[PropertyId][Entity.RawValue] = Value;
-        OnEntityDirty(Entity);
+        // 같은 슬롯의 세대 교체 - 밀집 위치 유지
+        LiveEntities[SlotLiveIndex[Index]] = Entity;
+        return;
     }
+    LiveWords[Index >> 6] |= 1ull << (Index & 63);
+    SlotLiveIndex[Index] = LiveEntities.Add(Entity);
+}
+
+void FHktStashBase::RemoveLiveSlot(int32 Index)
+{
+    SlotEntities[Index] = INDEX_NONE;
+    LiveWords[Index >> 6] &= ~(1ull << (Index & 63));
+    
+    // swap-remove - 마지막 엔티티를 빈 자리로 옮김
+    const int32 LiveIndex = SlotLiveIndex[Index];
+    const FHktEntityId Moved = LiveEntities.Last();
+    LiveEntities[LiveIndex] = Moved;
+    SlotLiveIndex[Moved.GetIndex()] = LiveIndex;
+    LiveEntities.Pop();
+    SlotLiveIndex[Index] = INDEX_NONE;
 }
 
 // ========== Tag API ==========
 
-const FGameplayTagContainer& FHktStashBase::GetTags(FHktEntityId Entity) const
+FGameplayTagContainer FHktStashBase::GetTags(FHktEntityId Entity) const
 {
     if (!IsValidEntity(Entity))
-        return EmptyTagContainer;
-    return EntityTags[Entity.RawValue];
+        return FGameplayTagContainer();
+    return FHktTagRegistry::Get().MakeContainer(SlotTags[Entity.GetIndex()]);
 }
 
 void FHktStashBase::SetTags(FHktEntityId Entity, const FGameplayTagContainer& Tags)
 {
-    if (Entity.RawValue < 0 || Entity.RawValue >= MaxEntities)
+    if (Entity.RawValue < 0)
         return;
     
-    if (bAutoCreateOnSet && !ValidEntities[Entity.RawValue])
-    {
-        ValidEntities[Entity.RawValue] = true;
-        if (Entity.RawValue >= NextEntityId)
-            NextEntityId = Entity.RawValue + 1;
-        
-        for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
-        {
-            Properties[PropId][Entity.RawValue] = 0;
-        }
-    }
+    AutoCreateEntity(Entity);
     
-    if (!ValidEntities[Entity.RawValue])
+    if (!IsValidEntity(Entity))
         return;
     
-    EntityTags[Entity.RawValue] = Tags;
-    OnEntityDirty(Entity);
+    SetSlotTagBits(Entity.GetIndex(), FHktTagRegistry::Get().MakeBits(Tags));
+    MarkChanged(Entity.GetIndex(), FHktEntityChange::Tags);
 }
 
 void FHktStashBase::AddTag(FHktEntityId Entity, const FGameplayTag& Tag)
@@ -143,10 +365,15 @@ void FHktStashBase::AddTag(FHktEntityId Entity, const FGameplayTag& Tag)
     if (!IsValidEntity(Entity) || !Tag.IsValid())
         return;
     
-    if (!EntityTags[Entity.RawValue].HasTagExact(Tag))
+    FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    const int32 TagIndex = Registry.FindOrAddIndex(Tag);
+    const int32 Index = Entity.GetIndex();
+    if (TagIndex != INDEX_NONE && !SlotTags[Index].Test(TagIndex))
     {
-        EntityTags[Entity.RawValue].AddTag(Tag);
-        OnEntityDirty(Entity);
+        SlotTags[Index].Set(TagIndex);
+        SlotTagMatches[Index] |= Registry.GetMatchMask(TagIndex);
+        StateHash += MixTag(Entity.RawValue, Registry.GetStableHash(TagIndex));
+        MarkChanged(Index, FHktEntityChange::Tags);
     }
 }
 
@@ -155,10 +382,16 @@ void FHktStashBase::RemoveTag(FHktEntityId Entity, const FGameplayTag& Tag)
     if (!IsValidEntity(Entity) || !Tag.IsValid())
         return;
     
-    if (EntityTags[Entity.RawValue].HasTagExact(Tag))
+    const FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    const int32 TagIndex = Registry.FindIndex(Tag);
+    const int32 Index = Entity.GetIndex();
+    if (TagIndex != INDEX_NONE && SlotTags[Index].Test(TagIndex))
     {
-        EntityTags[Entity.RawValue].RemoveTag(Tag);
-        OnEntityDirty(Entity);
+        // 다른 명시 태그가 같은 조상을 공유할 수 있으므로 매칭 비트는 다시 펼침
+        SlotTags[Index].Clear(TagIndex);
+        SlotTagMatches[Index] = Registry.ExpandMatches(SlotTags[Index]);
+        StateHash -= MixTag(Entity.RawValue, Registry.GetStableHash(TagIndex));
+        MarkChanged(Index, FHktEntityChange::Tags);
     }
 }
 
@@ -166,28 +399,38 @@ bool FHktStashBase::HasTag(FHktEntityId Entity, const FGameplayTag& Tag) const
 {
     if (!IsValidEntity(Entity))
         return false;
-    return EntityTags[Entity.RawValue].HasTag(Tag);
+    const int32 TagIndex = FHktTagRegistry::Get().FindIndex(Tag);
+    return TagIndex != INDEX_NONE && SlotTagMatches[Entity.GetIndex()].Test(TagIndex);
 }
 
 bool FHktStashBase::HasTagExact(FHktEntityId Entity, const FGameplayTag& Tag) const
 {
     if (!IsValidEntity(Entity))
         return false;
-    return EntityTags[Entity.RawValue].HasTagExact(Tag);
+    const int32 TagIndex = FHktTagRegistry::Get().FindIndex(Tag);
+    return TagIndex != INDEX_NONE && SlotTags[Entity.GetIndex()].Test(TagIndex);
 }
 
 bool FHktStashBase::HasAnyTags(FHktEntityId Entity, const FGameplayTagContainer& Tags) const
 {
     if (!IsValidEntity(Entity))
         return false;
-    return EntityTags[Entity.RawValue].HasAny(Tags);
+    
+    // 등록 안 된 태그는 어떤 엔티티도 갖지 않으므로 무시
+    FHktTagBits Query;
+    FHktTagRegistry::Get().FindBits(Tags, Query);
+    return SlotTagMatches[Entity.GetIndex()].HasAny(Query);
 }
 
 bool FHktStashBase::HasAllTags(FHktEntityId Entity, const FGameplayTagContainer& Tags) const
 {
     if (!IsValidEntity(Entity))
         return false;
-    return EntityTags[Entity.RawValue].HasAll(Tags);
+    
+    FHktTagBits Query;
+    if (!FHktTagRegistry::Get().FindBits(Tags, Query))
+        return false;
+    return SlotTagMatches[Entity.GetIndex()].HasAll(Query);
 }
 
 FGameplayTag FHktStashBase::GetFirstTagWithParent(FHktEntityId Entity, const FGameplayTag& ParentTag) const
@@ -195,80 +438,199 @@ FGameplayTag FHktStashBase::GetFirstTagWithParent(FHktEntityId Entity, const FGa
     if (!IsValidEntity(Entity) || !ParentTag.IsValid())
         return FGameplayTag();
     
-    for (const FGameplayTag& Tag : EntityTags[Entity.RawValue])
+    const FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    const int32 ParentIndex = Registry.FindIndex(ParentTag);
+    if (ParentIndex == INDEX_NONE)
+        return FGameplayTag();
+    
+    // 이름 순 첫 태그 - 레지스트리 인덱스는 등록 순서라 프로세스마다 다를 수 있음
+    const FHktTagBits Children = SlotTags[Entity.GetIndex()] & Registry.GetChildMask(ParentIndex);
+    FGameplayTag First;
+    Children.ForEachSetBit([&Registry, &First](int32 TagIndex)
     {
-        if (Tag.MatchesTag(ParentTag))
-        {
-            return Tag;
-        }
-    }
-    return FGameplayTag();
+        const FGameplayTag& Tag = Registry.GetTag(TagIndex);
+        if (!First.IsValid() || Tag.GetTagName().Compare(First.GetTagName()) < 0)
+            First = Tag;
+    });
+    return First;
 }
 
 FGameplayTagContainer FHktStashBase::GetTagsWithParent(FHktEntityId Entity, const FGameplayTag& ParentTag) const
 {
-    FGameplayTagContainer Result;
     if (!IsValidEntity(Entity) || !ParentTag.IsValid())
-        return Result;
+        return FGameplayTagContainer();
+    
+    const FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    const int32 ParentIndex = Registry.FindIndex(ParentTag);
+    if (ParentIndex == INDEX_NONE)
+        return FGameplayTagContainer();
+    
+    return Registry.MakeContainer(SlotTags[Entity.GetIndex()] & Registry.GetChildMask(ParentIndex));
+}
+
+void FHktStashBase::MarkFrameCompleted(int32 FrameNumber)
+{
+    CompletedFrameNumber = FrameNumber;
     
-    for (const FGameplayTag& Tag : EntityTags[Entity.RawValue])
+    // 더티 비트셋을 슬롯 순으로 훑어 변경 피드 게시 + 비트 초기화 (바뀐 슬롯만 방문)
+    FrameChanges.Reset();
+    const int32 NumWords = FMath::Min(DirtyWords.Num(), (NextEntityId + 63) >> 6);
+    for (int32 Word = 0; Word < NumWords; ++Word)
     {
-        if (Tag.MatchesTag(ParentTag))
+        uint64 Bits = DirtyWords[Word];
+        if (Bits == 0)
+            continue;
+        DirtyWords[Word] = 0;
+        
+        while (Bits != 0)
         {
-            Result.AddTag(Tag);
+            const int32 Index = (Word << 6) + static_cast<int32>(FMath::CountTrailingZeros64(Bits));
+            Bits &= Bits - 1;
+            
+            FHktEntityChange& Change = FrameChanges.AddDefaulted_GetRef();
+            // 해제된 슬롯은 세대가 이미 올라가 있으므로 해제된 ID를 복원
+            Change.Entity = SlotEntities[Index] != INDEX_NONE
+                ? FHktEntityId(SlotEntities[Index])
+                : FHktEntityId::Make(Index, SlotGenerations[Index] - 1);
+            Change.Flags = SlotChangeFlags[Index];
+            Change.PropertyGroups = SlotChangeGroups[Index];
+            SlotChangeFlags[Index] = 0;
+            SlotChangeGroups[Index] = 0;
         }
     }
-    return Result;
 }
 
-int32 FHktStashBase::GetEntityCount() const
+bool FHktStashBase::IsEntityDirty(FHktEntityId Entity) const
 {
-    int32 Count = 0;
-    for (int32 i = 0; i < MaxEntities; ++i)
+    if (!IsValidEntity(Entity))
+        return false;
+    const int32 Index = Entity.GetIndex();
+    return (DirtyWords[Index >> 6] >> (Index & 63)) & 1;
+}
+
+void FHktStashBase::ForEachEntity(TFunctionRef<void(FHktEntityId)> Callback) const
+{
+    ForEachLiveSlot([this, &Callback](int32 Index)
     {
-        if (ValidEntities[i])
-            Count++;
-    }
-    return Count;
+        Callback(FHktEntityId(SlotEntities[Index]));
+    });
 }
 
-void FHktStashBase::MarkFrameCompleted(int32 FrameNumber)
+uint32 FHktStashBase::CalculateChecksum() const
 {
-    CompletedFrameNumber = FrameNumber;
+    return FoldChecksum(StateHash, CompletedFrameNumber);
 }
 
-void FHktStashBase::ForEachEntity(TFunctionRef<void(FHktEntityId)> Callback) const
+uint32 FHktStashBase::CalculateFullChecksum() const
+{
+    return FoldChecksum(RecomputeStateHash(), CompletedFrameNumber);
+}
+
+// ========== 상태 해시 ==========
+
+uint64 FHktStashBase::HashSlotTags(int32 Index) const
 {
-    for (int32 E = 0; E < MaxEntities; ++E)
+    const FHktTagRegistry& Registry = FHktTagRegistry::Get();
+    const int32 RawId = SlotEntities[Index];
+    uint64 Hash = 0;
+    SlotTags[Index].ForEachSetBit([&Registry, RawId, &Hash](int32 TagIndex)
     {
-        if (ValidEntities[E])
+        Hash += MixTag(RawId, Registry.GetStableHash(TagIndex));
+    });
+    return Hash;
+}
+
+void FHktStashBase::HashSlotGroups(int32 Index, uint64 (&OutHashes)[HktHashGroup::Num]) const
+{
+    const int32 RawId = SlotEntities[Index];
+    const FChunk& Chunk = Chunks[Index >> ChunkShift];
+    
+    for (uint64& Hash : OutHashes)
+    {
+        Hash = 0;
+    }
+    for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
+    {
+        if (Chunk.Columns[PropId])
         {
-            Callback(FHktEntityId(E));
+            OutHashes[PropId >> FHktEntityChange::PropertyGroupShift] += MixProperty(RawId, PropId, Chunk.Columns[PropId][Index & ChunkMask]);
         }
     }
+    OutHashes[HktHashGroup::Tags] = MixEntity(RawId) + HashSlotTags(Index);
 }
 
-uint32 FHktStashBase::CalculateChecksum() const
+uint64 FHktStashBase::HashSlot(int32 Index) const
 {
-    uint32 Checksum = 0;
+    uint64 Groups[HktHashGroup::Num];
+    HashSlotGroups(Index, Groups);
     
-    ForEachEntity([&](FHktEntityId E)
+    uint64 Hash = 0;
+    for (uint64 GroupHash : Groups)
     {
-        for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
+        Hash += GroupHash;
+    }
+    return Hash;
+}
+
+void FHktStashBase::GetEntityGroupHashes(FHktEntityId Entity, uint64 (&OutHashes)[HktHashGroup::Num]) const
+{
+    if (!IsValidEntity(Entity))
+    {
+        for (uint64& Hash : OutHashes)
         {
-            Checksum ^= Properties[PropId][E.RawValue];
-            Checksum = (Checksum << 1) | (Checksum >> 31);
+            Hash = 0;
         }
+        return;
+    }
+    HashSlotGroups(Entity.GetIndex(), OutHashes);
+}
+
+void FHktStashBase::SetSlotTagBits(int32 Index, const FHktTagBits& Tags)
+{
+    StateHash -= HashSlotTags(Index);
+    SlotTags[Index] = Tags;
+    SlotTagMatches[Index] = FHktTagRegistry::Get().ExpandMatches(Tags);
+    StateHash += HashSlotTags(Index);
+}
+
+uint64 FHktStashBase::RecomputeStateHash() const
+{
+    uint64 Hash = 0;
+    
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        const int32 Base = ChunkIndex << ChunkShift;
+        if (Base >= NextEntityId)
+            break;
+        
+        const int32* RawIds = SlotEntities.GetData() + Base;
         
-        for (const FGameplayTag& Tag : EntityTags[E.RawValue])
+        // 존재 + 태그
+        for (int32 i = 0; i < ChunkSize; ++i)
         {
-            Checksum ^= GetTypeHash(Tag);
-            Checksum = (Checksum << 1) | (Checksum >> 31);
+            if (RawIds[i] != INDEX_NONE)
+            {
+                Hash += MixEntity(RawIds[i]) + HashSlotTags(Base + i);
+            }
         }
         
-        Checksum ^= E.RawValue;
-    });
+        // 열 단위 - 분기 없는 고정 길이 루프 (빈 슬롯은 마스크, 0 값은 MixProperty가 0)
+        const FChunk& Chunk = Chunks[ChunkIndex];
+        for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
+        {
+            if (!Chunk.Columns[PropId])
+                continue;
+            
+            const int32* Values = Chunk.Columns[PropId];
+            uint64 ColumnHash = 0;
+            for (int32 i = 0; i < ChunkSize; ++i)
+            {
+                const uint64 LiveMask = 0ull - static_cast<uint64>(RawIds[i] != INDEX_NONE);
+                ColumnHash += MixProperty(RawIds[i], PropId, Values[i]) & LiveMask;
+            }
+            Hash += ColumnHash;
+        }
+    }
     
-    Checksum ^= CompletedFrameNumber;
-    return Checksum;
+    return Hash;
 }
@@ -5,13 +5,24 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "HktCoreInterfaces.h"
+#include "HktTagRegistry.h"
+#include "HktStashLayout.h"
 
 /**
  * FHktStashBase - Stash 공통 기능 구현
  * 
- * SOA 레이아웃으로 엔티티 데이터 저장
- * - Properties: 숫자 데이터 배열
- * - EntityTags: GameplayTagContainer 배열
+ * 청크 단위 SOA 레이아웃으로 엔티티 데이터 저장
+ * - Chunks: ChunkSize 엔티티 블록, 블록 안은 컴포넌트(FHktStashLayout) 단위 [레인][Slot] 블록 (AoSoA)
+ * - SlotTags: 슬롯별 고정 폭 태그 비트셋 (FHktTagRegistry 인덱스)
+ * 
+ * 용량은 필요할 때 청크 단위로 늘어나며 (최대 FHktEntityId::MaxIndex), 기존 열 데이터는 옮기지 않습니다.
+ * 컴포넌트 블록은 청크마다 그 컴포넌트의 Property에 처음 0이 아닌 값이 쓰일 때 할당되고,
+ * 할당되지 않은 열은 모두 0으로 읽힙니다.
+ * 엔티티 초기화/스냅샷/체크섬/직렬화는 할당된 열만 다룹니다.
+ * 
+ * 상태 해시(StateHash)는 살아있는 엔티티의 (존재, 0이 아닌 Property 값, 태그)마다
+ * 64비트 믹스를 더한 합으로, 쓰기/할당/해제 때 증분 갱신되어 체크섬이 O(1)입니다.
+ * 슬롯마다 세대를 두어 해제 후 재사용된 슬롯을 이전 ID로 접근할 수 없습니다.
  */
 class FHktStashBase
 {
@@ -22,17 +33,49 @@ public:
     // ========== IHktStashInterface 공통 구현 ==========
     FHktEntityId AllocateEntity();
     void FreeEntity(FHktEntityId Entity);
-    bool IsValidEntity(FHktEntityId Entity) const;
-    int32 GetProperty(FHktEntityId Entity, uint16 PropertyId) const;
+    
+    /** 인라인 (FHktStashBase로 직접 호출하면 가상 호출 없이 열 인덱싱으로 컴파일됨) */
+    FORCEINLINE bool IsValidEntity(FHktEntityId Entity) const;
+    FORCEINLINE int32 GetProperty(FHktEntityId Entity, uint16 PropertyId) const;
+    
     void SetProperty(FHktEntityId Entity, uint16 PropertyId, int32 Value);
-    int32 GetEntityCount() const;
+    
+    /** 일괄 쓰기 - 같은 (PropertyId, 청크)가 이어지는 동안 열을 한 번만 찾음 (정렬된 입력이면 열 단위 커밋) */
+    void ApplyWrites(const TArray<FHktPropertyWrite>& Writes);
+    
+    int32 GetEntityCount() const { return LiveEntities.Num(); }
+    
+    /** 살아있는 엔티티 밀집 배열 - 순서는 할당/해제 이력에 따름 (순서 무관 스캔용, 슬롯 순이 필요하면 ForEachEntity) */
+    const TArray<FHktEntityId>& GetLiveEntities() const { return LiveEntities; }
     int32 GetCompletedFrameNumber() const { return CompletedFrameNumber; }
     void MarkFrameCompleted(int32 FrameNumber);
+    const TArray<FHktEntityChange>& GetFrameChanges() const { return FrameChanges; }
+    
+    /** 이번 프레임(아직 게시 전)에 바뀐 엔티티인지 */
+    bool IsEntityDirty(FHktEntityId Entity) const;
+    /** 슬롯 순 (할당/해제 이력과 무관하게 같은 순서) - 살아있는 슬롯 비트셋을 워드 단위로 훑음 */
     void ForEachEntity(TFunctionRef<void(FHktEntityId)> Callback) const;
     uint32 CalculateChecksum() const;
+    uint32 CalculateFullChecksum() const;
+    
+    /** 증분 상태 해시 (엔티티 집합/값/태그가 같으면 연산 순서와 무관하게 같음) */
+    uint64 GetStateHash() const { return StateHash; }
+    
+    /** 상태 해시 전체 재계산 - 열 단위 분기 없는 루프 (증분 해시 검증용) */
+    uint64 RecomputeStateHash() const;
+    
+    /** 엔티티의 해시 그룹별 상태 해시 (없으면 0) */
+    void GetEntityGroupHashes(FHktEntityId Entity, uint64 (&OutHashes)[HktHashGroup::Num]) const;
+    
+    /** 현재 할당된 슬롯 수 (ChunkSize 배수) */
+    int32 GetCapacity() const { return Chunks.Num() * ChunkSize; }
+    
+    /** 할당된 열 수 (모든 청크의 컴포넌트 블록 레인 합계, 통계용) */
+    int32 GetNumAllocatedColumns() const;
     
     // ========== Tag API ==========
-    const FGameplayTagContainer& GetTags(FHktEntityId Entity) const;
+    /** 태그 API는 슬롯 비트셋 연산 - 계층 HasTag는 비트 하나, 컨테이너는 GetTags/GetTagsWithParent에서만 생성 */
+    FGameplayTagContainer GetTags(FHktEntityId Entity) const;
     void SetTags(FHktEntityId Entity, const FGameplayTagContainer& Tags);
     void AddTag(FHktEntityId Entity, const FGameplayTag& Tag);
     void RemoveTag(FHktEntityId Entity, const FGameplayTag& Tag);
@@ -47,23 +90,175 @@ protected:
     /** SetProperty 시 자동 엔티티 생성 여부 (VisibleStash에서 사용) */
     bool bAutoCreateOnSet = false;
     
-    /** 변경 추적 (파생 클래스에서 오버라이드) */
-    virtual void OnEntityDirty(FHktEntityId Entity) {}
+    /** bAutoCreateOnSet일 때 없는 엔티티를 활성화하고 모든 값을 0으로 */
+    void AutoCreateEntity(FHktEntityId Entity);
+    
+    /** 주어진 ID(인덱스 + 세대)로 슬롯을 활성화하고 모든 값을 0으로 (스냅샷/역직렬화/자동 생성) */
+    void ActivateSlot(FHktEntityId Entity);
+    
+    /** 살아있는 집합 갱신 - SlotEntities를 바꾸는 경로는 모두 이것으로 */
+    void AddLiveSlot(int32 Index, FHktEntityId Entity);
+    void RemoveLiveSlot(int32 Index);
+    
+    /** 태그 교체 (매칭 비트/상태 해시 갱신 포함) - 태그를 통째로 바꾸는 경로는 모두 이것으로 */
+    void SetSlotTagBits(int32 Index, const FHktTagBits& Tags);
+    
+    /** 슬롯의 상태 해시 기여 (존재 + Property + 태그) */
+    uint64 HashSlot(int32 Index) const;
+    uint64 HashSlotTags(int32 Index) const;
+    void HashSlotGroups(int32 Index, uint64 (&OutHashes)[HktHashGroup::Num]) const;
+    
+    /** 모든 엔티티와 청크 해제 */
+    void ResetStorage();
+    
+    /** 살아있는 슬롯을 슬롯 순으로 방문 - Func(int32 Index), 빈 워드는 한 번에 건너뜀 */
+    template<typename FuncType>
+    FORCEINLINE void ForEachLiveSlot(FuncType&& Func) const
+    {
+        const int32 NumWords = FMath::Min(LiveWords.Num(), (NextEntityId + 63) >> 6);
+        for (int32 w = 0; w < NumWords; ++w)
+        {
+            uint64 Word = LiveWords[w];
+            while (Word != 0)
+            {
+                Func(w * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word)));
+                Word &= Word - 1;
+            }
+        }
+    }
+    
+    /** Index가 들어갈 때까지 청크 추가 */
+    void EnsureCapacity(int32 Index);
+    
+    /** 변경 추적 - 슬롯의 더티 비트와 변경 종류/Property 그룹 누적 */
+    FORCEINLINE void MarkChanged(int32 Index, uint8 Flags, uint8 PropertyGroups = 0)
+    {
+        DirtyWords[Index >> 6] |= 1ull << (Index & 63);
+        SlotChangeFlags[Index] |= Flags;
+        SlotChangeGroups[Index] |= PropertyGroups;
+    }
+    
+    /** 용량이 늘어날 때 (파생 클래스의 슬롯별 배열도 같이 늘림) */
+    virtual void OnCapacityGrown(int32 NewCapacity) {}
+
+    static constexpr int32 ChunkShift = 8;
+    static constexpr int32 ChunkSize = 1 << ChunkShift;    // 청크당 엔티티 수
+    static constexpr int32 ChunkMask = ChunkSize - 1;
+    static constexpr int32 MaxEntities = FHktEntityId::MaxIndex;
+    static constexpr int32 MaxProperties = FHktStashLayout::MaxProperties;  // 숫자 Property 수 축소 (태그로 대체)
+
+    /**
+     * ChunkSize 엔티티 블록 - 컴포넌트 블록은 필요할 때 할당 (비어 있으면 모두 0)
+     * Columns는 블록 안 열 시작을 가리키므로 복사하지 않음 (이동은 블록 버퍼를 그대로 넘김)
+     */
+    struct FChunk
+    {
+        /** 컴포넌트별 [레인][Slot] 블록 (ComponentSize × ChunkSize) */
+        TArray<int32> Components[FHktStashLayout::MaxComponents];
+        
+        /** PropertyId → 열 시작 (컴포넌트 블록이 없으면 nullptr) */
+        int32* Columns[MaxProperties] = {};
 
-    static constexpr int32 MaxEntities = 1024;
-    static constexpr int32 MaxProperties = 128;  // 숫자 Property 수 축소 (태그로 대체)
+        FChunk() = default;
+        FChunk(FChunk&&) = default;
+        FChunk& operator=(FChunk&&) = default;
+        FChunk(const FChunk&) = delete;
+        FChunk& operator=(const FChunk&) = delete;
+    };
 
-    /** SOA 레이아웃: Properties[PropertyId][EntityId] */
-    TArray<TArray<int32>> Properties;
+    /** Property 집합 비트마스크 */
+    struct FPropertyMask
+    {
+        uint64 Bits[MaxProperties / 64] = {};
+
+        void Set(int32 PropId) { Bits[PropId >> 6] |= 1ull << (PropId & 63); }
+        bool Test(int32 PropId) const { return (Bits[PropId >> 6] >> (PropId & 63)) & 1; }
+
+        /** 가장 큰 PropertyId + 1 (비어 있으면 0) */
+        int32 GetEnd() const
+        {
+            for (int32 w = MaxProperties / 64 - 1; w >= 0; --w)
+            {
+                if (Bits[w] != 0)
+                    return w * 64 + 64 - static_cast<int32>(FMath::CountLeadingZeros64(Bits[w]));
+            }
+            return 0;
+        }
+    };
+
+    FORCEINLINE int32 PropertyAt(int32 Index, uint16 PropertyId) const
+    {
+        const int32* Column = Chunks[Index >> ChunkShift].Columns[PropertyId];
+        return Column ? Column[Index & ChunkMask] : 0;
+    }
+
+    /** PropertyId가 속한 컴포넌트 블록 할당 (0으로 초기화) - 해당 열 시작 반환 */
+    int32* AllocateComponent(FChunk& Chunk, uint16 PropertyId);
+
+    /** 값 쓰기 - 열이 없고 Value가 0이면 할당하지 않음. 값이 바뀌었으면 true */
+    bool WritePropertyAt(int32 Index, uint16 PropertyId, int32 Value);
+
+    /** 슬롯의 할당된 열 값을 모두 0으로 */
+    void ClearSlotProperties(int32 Index);
+
+
+    /** 청크 AoSoA: Chunks[Index >> ChunkShift].Columns[PropertyId][Index & ChunkMask] */
+    TArray<FChunk> Chunks;
+    
+    /** 어느 청크에서든 할당된 적 있는 열 (스냅샷/직렬화 범위) */
+    FPropertyMask PopulatedColumns;
+    
+    /** 슬롯별 명시 태그 비트 */
+    TArray<FHktTagBits> SlotTags;
+    
+    /** 슬롯별 매칭 비트 (명시 태그 + 조상) - 계층 HasTag/HasAny/HasAll 용 */
+    TArray<FHktTagBits> SlotTagMatches;
+    
+    /** 슬롯별 살아있는 엔티티 ID (RawValue, 없으면 INDEX_NONE) - 유효성 + 세대 검사를 한 번에 */
+    TArray<int32> SlotEntities;
     
-    /** 엔티티별 태그 컨테이너 */
-    TArray<FGameplayTagContainer> EntityTags;
+    /** 슬롯별 세대 (살아있으면 현재, 비어 있으면 다음 할당의 세대) */
+    TArray<uint16> SlotGenerations;
     
-    /** 빈 태그 컨테이너 (Invalid Entity 반환용) */
-    static const FGameplayTagContainer EmptyTagContainer;
+    /** 빈 슬롯 인덱스 (LIFO) */
+    TArray<int32> FreeList;
     
-    TBitArray<> ValidEntities;
-    TArray<FHktEntityId> FreeList;
+    /** 살아있는 슬롯 비트셋 (슬롯 64개당 한 워드) */
+    TArray<uint64> LiveWords;
+    
+    /** 살아있는 엔티티 밀집 배열 + 슬롯 → 밀집 위치 (없으면 INDEX_NONE) - 해제는 swap-remove */
+    TArray<FHktEntityId> LiveEntities;
+    TArray<int32> SlotLiveIndex;
+    
+    /** 한 번이라도 사용된 슬롯 수 (순회 상한) */
     int32 NextEntityId = 0;
     int32 CompletedFrameNumber = 0;
+    
+    // ========== 변경 추적 (프레임 단위) ==========
+    
+    /** 이번 프레임에 바뀐 슬롯 비트셋 (슬롯 64개당 한 워드) */
+    TArray<uint64> DirtyWords;
+    
+    /** 슬롯별 FHktEntityChange::EFlags / Property 그룹 비트 (이번 프레임) */
+    TArray<uint8> SlotChangeFlags;
+    TArray<uint8> SlotChangeGroups;
+    
+    /** 직전 완료 프레임의 변경 피드 */
+    TArray<FHktEntityChange> FrameChanges;
+    
+    /** 증분 상태 해시 (mod 2^64 합) */
+    uint64 StateHash = 0;
 };
+
+FORCEINLINE bool FHktStashBase::IsValidEntity(FHktEntityId Entity) const
+{
+    const int32 Index = Entity.GetIndex();
+    return Entity.RawValue >= 0 && Index < SlotEntities.Num() && SlotEntities[Index] == Entity.RawValue;
+}
+
+FORCEINLINE int32 FHktStashBase::GetProperty(FHktEntityId Entity, uint16 PropertyId) const
+{
+    if (!IsValidEntity(Entity) || PropertyId >= MaxProperties)
+        return 0;
+    return PropertyAt(Entity.GetIndex(), PropertyId);
+}
@@ -0,0 +1,189 @@
+#include "HktStashHashTree.h"
+#include "Algo/BinarySearch.h"
+
+// ============================================================================
+// 빌드
+// ============================================================================
+
+void FHktStashHashTree::Reset()
+{
+    LeafIndices.Reset();
+    LeafEntities.Reset();
+    LeafGroupHashes.Reset();
+    PrefixHashes.Reset();
+    PrefixHashes.Add(0);
+}
+
+void FHktStashHashTree::Build(const IHktStashInterface& Stash, const TArray<FHktEntityId>& Entities)
+{
+    Reset();
+    
+    TArray<FHktEntityId> Sorted;
+    Sorted.Reserve(Entities.Num());
+    for (FHktEntityId E : Entities)
+    {
+        if (Stash.IsValidEntity(E))
+        {
+            Sorted.Add(E);
+        }
+    }
+    Sorted.Sort([](FHktEntityId A, FHktEntityId B) { return A.GetIndex() < B.GetIndex(); });
+    
+    LeafIndices.Reserve(Sorted.Num());
+    LeafEntities.Reserve(Sorted.Num());
+    LeafGroupHashes.Reserve(Sorted.Num() * HktHashGroup::Num);
+    PrefixHashes.Reserve(Sorted.Num() + 1);
+    
+    uint64 Prefix = 0;
+    for (FHktEntityId E : Sorted)
+    {
+        // 같은 엔티티가 두 번 들어오면 한 번만 (유효 엔티티는 슬롯당 하나)
+        if (LeafIndices.Num() > 0 && LeafIndices.Last() == E.GetIndex())
+        {
+            continue;
+        }
+        
+        uint64 Groups[HktHashGroup::Num];
+        Stash.GetEntityGroupHashes(E, Groups);
+        
+        LeafIndices.Add(E.GetIndex());
+        LeafEntities.Add(E.RawValue);
+        for (uint64 GroupHash : Groups)
+        {
+            LeafGroupHashes.Add(GroupHash);
+            Prefix += GroupHash;
+        }
+        PrefixHashes.Add(Prefix);
+    }
+}
+
+void FHktStashHashTree::BuildAll(const IHktStashInterface& Stash)
+{
+    TArray<FHktEntityId> Entities;
+    Entities.Reserve(Stash.GetEntityCount());
+    Stash.ForEachEntity([&Entities](FHktEntityId E) { Entities.Add(E); });
+    Build(Stash, Entities);
+}
+
+// ============================================================================
+// 노드 해시
+// ============================================================================
+
+int32 FHktStashHashTree::FindLeaf(int32 SlotIndex) const
+{
+    return Algo::LowerBound(LeafIndices, SlotIndex);
+}
+
+uint64 FHktStashHashTree::GetNodeHash(const FHktHashNodeId& Node) const
+{
+    if (PrefixHashes.Num() == 0 || Node.Level > MaxLevel)
+    {
+        return 0;
+    }
+    
+    if (Node.Level == GroupLevel)
+    {
+        const int32 Leaf = FindLeaf(Node.Index);
+        if (Leaf == LeafIndices.Num() || LeafIndices[Leaf] != Node.Index || Node.Group >= HktHashGroup::Num)
+        {
+            return 0;
+        }
+        return LeafGroupHashes[Leaf * HktHashGroup::Num + Node.Group];
+    }
+    
+    // 범위 노드 - [Begin, End) 리프 해시 합 = 누적합 차 (wrap 포함)
+    const int32 Shift = GetLevelShift(Node.Level);
+    const int64 Begin = static_cast<int64>(Node.Index) << Shift;
+    const int64 End = Begin + (int64(1) << Shift);
+    
+    const int32 First = FindLeaf(static_cast<int32>(FMath::Min<int64>(Begin, INT32_MAX)));
+    const int32 Last = FindLeaf(static_cast<int32>(FMath::Min<int64>(End, INT32_MAX)));
+    return PrefixHashes[Last] - PrefixHashes[First];
+}
+
+void FHktStashHashTree::AnswerQuery(const TArray<FHktHashNodeId>& Query, TArray<uint64>& OutHashes) const
+{
+    OutHashes.SetNumUninitialized(Query.Num());
+    for (int32 i = 0; i < Query.Num(); ++i)
+    {
+        OutHashes[i] = GetNodeHash(Query[i]);
+    }
+}
+
+// ============================================================================
+// 비교
+// ============================================================================
+
+void FHktStashHashTree::Compare(const TArray<FHktHashNodeId>& Query, const TArray<uint64>& RemoteHashes,
+                                TArray<FHktHashNodeId>& OutNextQuery, TArray<FHktEntityDesync>& OutDesyncs) const
+{
+    OutNextQuery.Reset();
+    
+    if (Query.Num() != RemoteHashes.Num())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[StashHashTree] Query/Answer size mismatch (%d vs %d)"), Query.Num(), RemoteHashes.Num());
+        return;
+    }
+    
+    // 같은 슬롯의 그룹 노드는 한 왕복에 함께 오므로 마지막 Desync에 합침
+    for (int32 i = 0; i < Query.Num(); ++i)
+    {
+        const FHktHashNodeId& Node = Query[i];
+        if (GetNodeHash(Node) == RemoteHashes[i])
+        {
+            continue;
+        }
+        
+        if (Node.Level < EntityLevel)
+        {
+            for (int32 Child = 0; Child < Fanout; ++Child)
+            {
+                FHktHashNodeId& ChildNode = OutNextQuery.AddDefaulted_GetRef();
+                ChildNode.Index = (Node.Index << FanoutBits) | Child;
+                ChildNode.Level = Node.Level + 1;
+            }
+        }
+        else if (Node.Level == EntityLevel)
+        {
+            for (int32 Group = 0; Group < HktHashGroup::Num; ++Group)
+            {
+                FHktHashNodeId& GroupNode = OutNextQuery.AddDefaulted_GetRef();
+                GroupNode.Index = Node.Index;
+                GroupNode.Level = GroupLevel;
+                GroupNode.Group = static_cast<uint8>(Group);
+            }
+        }
+        else if (Node.Level == GroupLevel)
+        {
+            if (OutDesyncs.Num() == 0 || OutDesyncs.Last().SlotIndex != Node.Index)
+            {
+                FHktEntityDesync& Desync = OutDesyncs.AddDefaulted_GetRef();
+                Desync.SlotIndex = Node.Index;
+                
+                const int32 Leaf = FindLeaf(Node.Index);
+                if (Leaf < LeafIndices.Num() && LeafIndices[Leaf] == Node.Index)
+                {
+                    Desync.LocalEntity = FHktEntityId(LeafEntities[Leaf]);
+                }
+            }
+            OutDesyncs.Last().GroupMask |= 1u << Node.Group;
+        }
+    }
+}
+
+void FHktStashHashTree::FindDesyncs(const FHktStashHashTree& Local, const FHktStashHashTree& Remote, TArray<FHktEntityDesync>& OutDesyncs)
+{
+    OutDesyncs.Reset();
+    
+    TArray<FHktHashNodeId> Query;
+    TArray<FHktHashNodeId> NextQuery;
+    TArray<uint64> Answer;
+    Query.Add(GetRootNode());
+    
+    while (Query.Num() > 0)
+    {
+        Remote.AnswerQuery(Query, Answer);
+        Local.Compare(Query, Answer, NextQuery, OutDesyncs);
+        Swap(Query, NextQuery);
+    }
+}
@@ -0,0 +1,53 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "HktStashLayout.h"
+
+const FHktStashLayout& FHktStashLayout::Get()
+{
+    static const FHktStashLayout Instance;
+    return Instance;
+}
+
+FHktStashLayout::FHktStashLayout()
+{
+    bool bAssigned[MaxProperties] = {};
+
+    auto AddComponent = [this, &bAssigned](uint16 First, uint16 Size)
+    {
+        const int32 Component = NumComponents++;
+        ComponentFirst[Component] = First;
+        ComponentSize[Component] = Size;
+        for (int32 Lane = 0; Lane < Size; ++Lane)
+        {
+            PropertyComponent[First + Lane] = static_cast<uint8>(Component);
+            PropertyLane[First + Lane] = static_cast<uint8>(Lane);
+            bAssigned[First + Lane] = true;
+        }
+    };
+
+    for (const FHktStashComponentDef& Def : HktStashComponents::Defaults)
+    {
+        bool bValid = Def.NumProperties > 0 && Def.FirstProperty + Def.NumProperties <= MaxProperties;
+        for (int32 PropId = Def.FirstProperty; bValid && PropId < Def.FirstProperty + Def.NumProperties; ++PropId)
+        {
+            bValid = !bAssigned[PropId];
+        }
+
+        if (!bValid)
+        {
+            UE_LOG(LogTemp, Error, TEXT("[StashLayout] Component %s [%d, +%d) overlaps or exceeds MaxProperties, ignored"),
+                Def.Name, Def.FirstProperty, Def.NumProperties);
+            continue;
+        }
+        AddComponent(Def.FirstProperty, Def.NumProperties);
+    }
+
+    // 나머지는 단일 열
+    for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
+    {
+        if (!bAssigned[PropId])
+        {
+            AddComponent(static_cast<uint16>(PropId), 1);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktPropertyIds.h"
+#include "Physics/HktPhysicsTypes.h"
+
+// ============================================================================
+// 컴포넌트 구성 - 함께 읽히는 Property 묶음
+// ============================================================================
+
+/** 연속 PropertyId 범위 [FirstProperty, FirstProperty + NumProperties) */
+struct FHktStashComponentDef
+{
+    const TCHAR* Name;
+    uint16 FirstProperty;
+    uint16 NumProperties;
+};
+
+namespace HktStashComponents
+{
+    /**
+     * 기본 구성 - 시스템별로 항상 같이 읽고 쓰는 Property
+     * 여기 없는 Property는 각자 단일 열 컴포넌트가 됩니다.
+     * 묶음이 크면 그중 하나만 쓰는 청크도 묶음 전체를 할당하므로, 실제로 같이 쓰이는 것만 묶습니다.
+     */
+    inline constexpr FHktStashComponentDef Defaults[] =
+    {
+        { TEXT("Movement"),     PropertyId::PosX,           PropertyId::IsMoving - PropertyId::PosX + 1 },
+        { TEXT("Combat"),       PropertyId::Health,         PropertyId::MaxMana - PropertyId::Health + 1 },
+        { TEXT("Ownership"),    PropertyId::OwnerEntity,    PropertyId::EntityType - PropertyId::OwnerEntity + 1 },
+        { TEXT("EventParams"),  PropertyId::TargetPosX,     PropertyId::Param3 - PropertyId::TargetPosX + 1 },
+        { TEXT("Visual"),       PropertyId::AnimState,      PropertyId::VisualState - PropertyId::AnimState + 1 },
+        { TEXT("Collider"),     PropertyId::ColliderType,   PropertyId::CollisionMask - PropertyId::ColliderType + 1 },
+    };
+}
+
+// ============================================================================
+// FHktStashLayout - PropertyId → (컴포넌트, 레인)
+// ============================================================================
+
+/**
+ * 청크 안에서 컴포넌트는 [레인][슬롯] 블록 하나 (AoSoA)
+ * - 레인 = 컴포넌트 안 Property 순서, 레인마다 ChunkSize개 연속
+ * - 이동/충돌/전투 루프는 청크당 블록 하나만 스트리밍
+ *
+ * Defaults에서 한 번 만들며, 겹치거나 범위를 벗어난 정의는 로그를 남기고 건너뜁니다.
+ */
+struct FHktStashLayout
+{
+    static constexpr int32 MaxProperties = 128;
+    static constexpr int32 MaxComponents = MaxProperties;   // 모두 단일 열일 때
+
+    /** PropertyId → 컴포넌트 인덱스 */
+    uint8 PropertyComponent[MaxProperties] = {};
+
+    /** PropertyId → 컴포넌트 안 레인 */
+    uint8 PropertyLane[MaxProperties] = {};
+
+    /** 컴포넌트 → 첫 PropertyId / 레인 수 */
+    uint16 ComponentFirst[MaxComponents] = {};
+    uint16 ComponentSize[MaxComponents] = {};
+
+    int32 NumComponents = 0;
+
+    static const FHktStashLayout& Get();
+
+private:
+    FHktStashLayout();
+};
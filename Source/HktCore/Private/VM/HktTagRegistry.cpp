@@ -0,0 +1,120 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#include "HktTagRegistry.h"
+#include "Hash/CityHash.h"
+
+FHktTagRegistry& FHktTagRegistry::Get()
+{
+    static FHktTagRegistry Instance;
+    return Instance;
+}
+
+int32 FHktTagRegistry::FindIndex(const FGameplayTag& Tag) const
+{
+    const int32* Found = TagToIndex.Find(Tag);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 FHktTagRegistry::FindOrAddIndex(const FGameplayTag& Tag)
+{
+    if (!Tag.IsValid())
+        return INDEX_NONE;
+    
+    if (const int32* Found = TagToIndex.Find(Tag))
+        return *Found;
+    
+    // 부모 먼저 - 조상 마스크를 부모에서 물려받음
+    FHktTagBits Ancestors;
+    const FGameplayTag Parent = Tag.RequestDirectParent();
+    if (Parent.IsValid())
+    {
+        const int32 ParentIndex = FindOrAddIndex(Parent);
+        if (ParentIndex != INDEX_NONE)
+        {
+            Ancestors = MatchMasks[ParentIndex];
+        }
+    }
+    
+    // 여기서 INDEX_NONE을 돌려주면 엔티티 상태에서 태그가 빠지므로 모든 빌드에서 중단
+    if (Tags.Num() >= MaxTags)
+    {
+        UE_LOG(LogTemp, Fatal, TEXT("[TagRegistry] Tag limit (%d) reached while registering %s - raise FHktTagBits::NumWords"), MaxTags, *Tag.ToString());
+        return INDEX_NONE;
+    }
+    
+    const int32 Index = Tags.Num();
+    Tags.Add(Tag);
+    TagToIndex.Add(Tag, Index);
+    
+    // GetTypeHash(FGameplayTag)는 FName 인덱스라 프로세스마다 다름 - 이름 문자열(UTF-8)로 해시
+    const FTCHARToUTF8 Name(*Tag.GetTagName().ToString());
+    StableHashes.Add(CityHash64(Name.Get(), Name.Length()));
+    
+    FHktTagBits& Match = MatchMasks.Add_GetRef(Ancestors);
+    Match.Set(Index);
+    
+    ChildMasks.AddDefaulted_GetRef().Set(Index);
+    Ancestors.ForEachSetBit([this, Index](int32 AncestorIndex)
+    {
+        ChildMasks[AncestorIndex].Set(Index);
+    });
+    
+    return Index;
+}
+
+// ============================================================================
+// 변환
+// ============================================================================
+
+FHktTagBits FHktTagRegistry::MakeBits(const FGameplayTagContainer& Container)
+{
+    FHktTagBits Bits;
+    for (const FGameplayTag& Tag : Container)
+    {
+        const int32 Index = FindOrAddIndex(Tag);
+        if (Index != INDEX_NONE)
+        {
+            Bits.Set(Index);
+        }
+    }
+    return Bits;
+}
+
+bool FHktTagRegistry::FindBits(const FGameplayTagContainer& Container, FHktTagBits& OutBits) const
+{
+    OutBits.Reset();
+    bool bAllFound = true;
+    for (const FGameplayTag& Tag : Container)
+    {
+        const int32 Index = FindIndex(Tag);
+        if (Index != INDEX_NONE)
+        {
+            OutBits.Set(Index);
+        }
+        else
+        {
+            bAllFound = false;
+        }
+    }
+    return bAllFound;
+}
+
+FHktTagBits FHktTagRegistry::ExpandMatches(const FHktTagBits& Explicit) const
+{
+    FHktTagBits Matches;
+    Explicit.ForEachSetBit([this, &Matches](int32 Index)
+    {
+        Matches |= MatchMasks[Index];
+    });
+    return Matches;
+}
+
+FGameplayTagContainer FHktTagRegistry::MakeContainer(const FHktTagBits& Explicit) const
+{
+    FGameplayTagContainer Container;
+    Explicit.ForEachSetBit([this, &Container](int32 Index)
+    {
+        Container.AddTagFast(Tags[Index]);
+    });
+    return Container;
+}
@@ -0,0 +1,174 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+// ============================================================================
+// FHktTagBits - 엔티티 태그 비트셋
+// ============================================================================
+
+/**
+ * FHktTagBits - 고정 폭 태그 비트셋 (비트 = FHktTagRegistry 인덱스)
+ *
+ * 힙 할당 없는 POD라 슬롯 배열에 그대로 두고 memcpy로 복사/직렬화합니다.
+ */
+struct FHktTagBits
+{
+    static constexpr int32 NumWords = 4;
+    static constexpr int32 NumBits = NumWords * 64;    // 등록 가능한 최대 태그 수
+
+    uint64 Words[NumWords] = {};
+
+    FORCEINLINE void Set(int32 Index) { Words[Index >> 6] |= 1ull << (Index & 63); }
+    FORCEINLINE void Clear(int32 Index) { Words[Index >> 6] &= ~(1ull << (Index & 63)); }
+    FORCEINLINE bool Test(int32 Index) const { return (Words[Index >> 6] >> (Index & 63)) & 1; }
+
+    FORCEINLINE void Reset()
+    {
+        for (uint64& Word : Words)
+        {
+            Word = 0;
+        }
+    }
+
+    FORCEINLINE bool IsEmpty() const
+    {
+        uint64 Any = 0;
+        for (uint64 Word : Words)
+        {
+            Any |= Word;
+        }
+        return Any == 0;
+    }
+
+    /** 겹치는 비트가 있는지 */
+    FORCEINLINE bool HasAny(const FHktTagBits& Other) const
+    {
+        uint64 Any = 0;
+        for (int32 w = 0; w < NumWords; ++w)
+        {
+            Any |= Words[w] & Other.Words[w];
+        }
+        return Any != 0;
+    }
+
+    /** Other의 비트를 모두 가지는지 */
+    FORCEINLINE bool HasAll(const FHktTagBits& Other) const
+    {
+        uint64 Missing = 0;
+        for (int32 w = 0; w < NumWords; ++w)
+        {
+            Missing |= Other.Words[w] & ~Words[w];
+        }
+        return Missing == 0;
+    }
+
+    FORCEINLINE FHktTagBits& operator|=(const FHktTagBits& Other)
+    {
+        for (int32 w = 0; w < NumWords; ++w)
+        {
+            Words[w] |= Other.Words[w];
+        }
+        return *this;
+    }
+
+    FORCEINLINE FHktTagBits operator&(const FHktTagBits& Other) const
+    {
+        FHktTagBits Result;
+        for (int32 w = 0; w < NumWords; ++w)
+        {
+            Result.Words[w] = Words[w] & Other.Words[w];
+        }
+        return Result;
+    }
+
+    bool operator==(const FHktTagBits& Other) const
+    {
+        for (int32 w = 0; w < NumWords; ++w)
+        {
+            if (Words[w] != Other.Words[w])
+                return false;
+        }
+        return true;
+    }
+
+    /** 세트 비트를 인덱스 오름차순으로 */
+    template<typename FuncType>
+    FORCEINLINE void ForEachSetBit(FuncType&& Func) const
+    {
+        for (int32 w = 0; w < NumWords; ++w)
+        {
+            uint64 Word = Words[w];
+            while (Word != 0)
+            {
+                Func(w * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word)));
+                Word &= Word - 1;
+            }
+        }
+    }
+};
+
+// ============================================================================
+// FHktTagRegistry - GameplayTag → 밀집 인덱스
+// ============================================================================
+
+/**
+ * FHktTagRegistry - GameplayTag ↔ 밀집 인덱스 (프로세스 전역)
+ *
+ * 태그는 엔티티 상태에 처음 쓰일 때 등록되며 (부모가 항상 자식보다 먼저),
+ * 비트셋 폭은 프로젝트 태그 수가 아니라 실제로 쓰이는 태그 수만큼만 필요합니다.
+ * 인덱스는 프로세스마다 다를 수 있으므로 프로세스 밖으로 나가는 값은 인덱스를 쓰지 않습니다
+ * (직렬화는 태그 이름 테이블로 옮기고, 상태 해시는 GetStableHash, 스냅샷은 컨테이너).
+ *
+ * 태그마다 두 마스크를 미리 계산합니다:
+ * - MatchMask: 자신 + 등록된 조상 → 엔티티 비트에 OR해 두면 계층 HasTag가 비트 하나 검사
+ * - ChildMask: 자신 + 등록된 자손 → GetTagsWithParent가 비트 AND 한 번
+ *
+ * 등록(FindOrAddIndex)은 Stash 쓰기 경로(게임 스레드)에서만 일어나고,
+ * 조회 전용 함수는 등록이 없는 동안 여러 스레드에서 호출해도 됩니다.
+ */
+class FHktTagRegistry
+{
+public:
+    static constexpr int32 MaxTags = FHktTagBits::NumBits;
+
+    static FHktTagRegistry& Get();
+
+    /** 등록된 인덱스 (없으면 INDEX_NONE) */
+    int32 FindIndex(const FGameplayTag& Tag) const;
+
+    /** 없으면 부모부터 등록 - 무효 태그면 INDEX_NONE, MaxTags를 넘으면 Fatal (태그를 조용히 잃지 않도록) */
+    int32 FindOrAddIndex(const FGameplayTag& Tag);
+
+    int32 Num() const { return Tags.Num(); }
+    const FGameplayTag& GetTag(int32 Index) const { return Tags[Index]; }
+    const FHktTagBits& GetMatchMask(int32 Index) const { return MatchMasks[Index]; }
+    
+    /** 태그 문자열의 64비트 해시 (등록 시 한 번 계산) - 체크섬/상태 해시용, 프로세스와 무관하게 같음 */
+    uint64 GetStableHash(int32 Index) const { return StableHashes[Index]; }
+    const FHktTagBits& GetChildMask(int32 Index) const { return ChildMasks[Index]; }
+
+    // ========== 변환 ==========
+
+    /** 컨테이너 → 명시 태그 비트 (없는 태그는 등록) */
+    FHktTagBits MakeBits(const FGameplayTagContainer& Container);
+
+    /** 질의용 - 등록된 태그만 비트로. 등록 안 된 태그가 있으면 false (어떤 엔티티도 갖지 않음) */
+    bool FindBits(const FGameplayTagContainer& Container, FHktTagBits& OutBits) const;
+
+    /** 명시 태그 비트 → 조상까지 펼친 매칭 비트 */
+    FHktTagBits ExpandMatches(const FHktTagBits& Explicit) const;
+
+    FGameplayTagContainer MakeContainer(const FHktTagBits& Explicit) const;
+
+private:
+    FHktTagRegistry() = default;
+
+    TArray<FGameplayTag> Tags;
+    TArray<FHktTagBits> MatchMasks;
+    TArray<FHktTagBits> ChildMasks;
+    TArray<uint64> StableHashes;
+    TMap<FGameplayTag, int32> TagToIndex;
+};
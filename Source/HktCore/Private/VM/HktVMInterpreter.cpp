@@ -2,117 +2,356 @@
 #include "HktVMProgram.h"
 #include "HktVMStore.h"
 #include "HktCoreInterfaces.h"
+#include "HktVMNative.h"
+#include "HktVMTrace.h"
 
 void FHktVMInterpreter::Initialize(IHktStashInterface* InStash)
 {
-    Stash = InStash;
+    Stash.Bind(InStash);
 }
 
-EVMStatus FHktVMInterpreter::Execute(FHktVMRuntime& Runtime)
+// ============================================================================
+// Dispatch
+//
+// 핸들러 목록은 EOpCode 선언 순서와 정확히 일치해야 함 (아래 static_assert로 검증)
+// - GCC/Clang: computed-goto 기반 direct-threaded 디스패치
+// - 그 외(MSVC): 함수 포인터 핸들러 테이블
+//
+// STEP(Name, Stmt): 실행 후 다음 명령어로 진행
+// STOP(Name, Expr): Expr의 상태를 반환하며 실행 중단
+// ============================================================================
+
+#ifndef HKT_VM_COMPUTED_GOTO
+    #if defined(__GNUC__) || defined(__clang__)
+        #define HKT_VM_COMPUTED_GOTO 1
+    #else
+        #define HKT_VM_COMPUTED_GOTO 0
+    #endif
+#endif
+
+#define HKT_VM_OPCODE_HANDLERS(STEP, STOP) \
+    STEP(Nop,                 VM.Op_Nop(Runtime)) \
+    STOP(Halt,                VM.Op_Halt(Runtime)) \
+    STOP(Yield,               VM.Op_Yield(Runtime, Inst.Imm12)) \
+    STOP(YieldSeconds,        VM.Op_YieldSeconds(Runtime, Inst.GetSignedImm20())) \
+    STEP(Jump,                VM.Op_Jump(Runtime, Inst.Imm20)) \
+    STEP(JumpIf,              VM.Op_JumpIf(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(JumpIfNot,           VM.Op_JumpIfNot(Runtime, Inst.Src1, Inst.Imm12)) \
+    STOP(WaitCollision,       VM.Op_WaitCollision(Runtime, Inst.Src1)) \
+    STOP(WaitMoveEnd,         VM.Op_WaitEvent(Runtime, EWaitEventType::MoveEnd, Inst.Src1)) \
+    STOP(WaitAnimEnd,         VM.Op_WaitEvent(Runtime, EWaitEventType::AnimEnd, Inst.Src1)) \
+    STEP(LoadConst,           VM.Op_LoadConst(Runtime, Inst._Dst, Inst.GetSignedImm20())) \
+    STEP(LoadConstHigh,       VM.Op_LoadConstHigh(Runtime, Inst.Dst, Inst.Imm12)) \
+    STEP(LoadConstPool,       VM.Op_LoadConstPool(Runtime, Inst._Dst, Inst.Imm20)) \
+    STEP(LoadStore,           VM.Op_LoadStore(Runtime, Inst.Dst, Inst.Imm12)) \
+    STEP(LoadStoreEntity,     VM.Op_LoadStoreEntity(Runtime, Inst.Dst, Inst.Src1, Inst.Imm12)) \
+    STEP(SaveStore,           VM.Op_SaveStore(Runtime, Inst.Imm12, Inst.Src1)) \
+    STEP(SaveStoreEntity,     VM.Op_SaveStoreEntity(Runtime, Inst.Src1, Inst.Imm12, Inst.Src2)) \
+    STEP(Move,                VM.Op_Move(Runtime, Inst.Dst, Inst.Src1)) \
+    STEP(Add,                 VM.Op_Add(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Sub,                 VM.Op_Sub(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Mul,                 VM.Op_Mul(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Div,                 VM.Op_Div(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Mod,                 VM.Op_Mod(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(AddImm,              VM.Op_AddImm(Runtime, Inst.Dst, Inst.Src1, Inst.GetSignedImm12())) \
+    STEP(AddImmWide,          VM.Op_AddImm(Runtime, Inst._Dst, Inst._Dst, Inst.GetSignedImm20())) \
+    STEP(CmpEq,               VM.Op_CmpEq(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(CmpNe,               VM.Op_CmpNe(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(CmpLt,               VM.Op_CmpLt(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(CmpLe,               VM.Op_CmpLe(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(CmpGt,               VM.Op_CmpGt(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(CmpGe,               VM.Op_CmpGe(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STOP(SpawnEntity,         VM.Op_SpawnEntity(Runtime, Inst.GetSignedImm20())) \
+    STEP(DestroyEntity,       VM.Op_DestroyEntity(Runtime, Inst.Src1)) \
+    STEP(GetPosition,         VM.Op_GetPosition(Runtime, Inst.Dst, Inst.Src1)) \
+    STEP(SetPosition,         VM.Op_SetPosition(Runtime, Inst.Dst, Inst.Src1)) \
+    STEP(GetDistance,         VM.Op_GetDistance(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(MoveToward,          VM.Op_MoveToward(Runtime, Inst.Dst, Inst.Src1, Inst.Imm12)) \
+    STEP(MoveForward,         VM.Op_MoveForward(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(StopMovement,        VM.Op_StopMovement(Runtime, Inst.Src1)) \
+    STEP(Vec3Add,             VM.Op_Vec3Add(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Vec3Sub,             VM.Op_Vec3Sub(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Vec3Scale,           VM.Op_Vec3Scale(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Vec3DistSq,          VM.Op_Vec3DistSq(Runtime, Inst.Dst, Inst.Src1, Inst.Src2)) \
+    STEP(Vec3Toward,          VM.Op_Vec3Toward(Runtime, Inst.Dst, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(FindInRadius,        VM.Op_FindInRadius(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(FindNearest,         VM.Op_FindNearest(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(NextFound,           VM.Op_NextFound(Runtime)) \
+    STEP(ApplyDamage,         VM.Op_ApplyDamage(Runtime, Inst.Src1, Inst.Src2)) \
+    STEP(ApplyEffect,         VM.Op_ApplyEffect(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(RemoveEffect,        VM.Op_RemoveEffect(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(PlayAnim,            VM.Op_PlayAnim(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(PlayAnimMontage,     VM.Op_PlayAnimMontage(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(StopAnim,            VM.Op_StopAnim(Runtime, Inst.Src1)) \
+    STEP(PlayVFX,             VM.Op_PlayVFX(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(PlayVFXAttached,     VM.Op_PlayVFXAttached(Runtime, Inst.Src1, Inst.Imm12)) \
+    STEP(PlaySound,           VM.Op_PlaySound(Runtime, Inst.GetSignedImm20())) \
+    STEP(PlaySoundAtLocation, VM.Op_PlaySoundAtLocation(Runtime, Inst.Src1, Inst.Imm12)) \
+    STOP(SpawnEquipment,      VM.Op_SpawnEquipment(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(Log,                 VM.Op_Log(Runtime, Inst.GetSignedImm20())) \
+    STEP(SaveStoreConst,      VM.Op_SaveStoreConst(Runtime, Inst.GetPackedPropertyId(), Inst.GetPackedValue())) \
+    STEP(SaveStoreEntityConst, VM.Op_SaveStoreEntityConst(Runtime, Inst._Dst, Inst.GetPackedPropertyId(), Inst.GetPackedValue())) \
+    STEP(ApplyDamageConst,    VM.Op_ApplyDamageConst(Runtime, Inst.Src1, Inst.GetSignedImm12())) \
+    STEP(JumpIfEq,            VM.Op_JumpIfEq(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(JumpIfNe,            VM.Op_JumpIfNe(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(JumpIfLt,            VM.Op_JumpIfLt(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(JumpIfLe,            VM.Op_JumpIfLe(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(JumpIfGt,            VM.Op_JumpIfGt(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12)) \
+    STEP(JumpIfGe,            VM.Op_JumpIfGe(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12))
+
+namespace HktVMDispatch
 {
-    if (!Runtime.Program || !Runtime.Program->IsValid())
+    #define HKT_VM_ORDER_ENTRY(Name, Body) EOpCode::Name,
+    constexpr EOpCode HandlerOrder[] = { HKT_VM_OPCODE_HANDLERS(HKT_VM_ORDER_ENTRY, HKT_VM_ORDER_ENTRY) };
+    #undef HKT_VM_ORDER_ENTRY
+
+    constexpr uint32 NumOpCodes = static_cast<uint32>(EOpCode::Max);
+
+    constexpr bool IsHandlerOrderValid()
+    {
+        for (uint32 i = 0; i < UE_ARRAY_COUNT(HandlerOrder); ++i)
+        {
+            if (static_cast<uint32>(HandlerOrder[i]) != i)
+                return false;
+        }
+        return UE_ARRAY_COUNT(HandlerOrder) == NumOpCodes;
+    }
+
+    static_assert(IsHandlerOrderValid(), "HKT_VM_OPCODE_HANDLERS must list every EOpCode in declaration order");
+
+    /** 범위 밖 OpCode는 마지막 엔트리(Invalid)로 매핑 */
+    FORCEINLINE uint32 HandlerIndex(const FInstruction& Inst)
+    {
+        return FMath::Min<uint32>(Inst.OpCode, NumOpCodes);
+    }
+}
+
+const FHktVMInterpreter::FOpHandler* FHktVMInterpreter::GetHandlerTable()
+{
+    #define HKT_VM_TABLE_STEP(Name, Stmt) \
+        [](FHktVMInterpreter& VM, FHktVMRuntime& Runtime, FInstruction Inst) -> EVMStatus { Stmt; return EVMStatus::Running; },
+    #define HKT_VM_TABLE_STOP(Name, Expr) \
+        [](FHktVMInterpreter& VM, FHktVMRuntime& Runtime, FInstruction Inst) -> EVMStatus { return Expr; },
+
+    static const FOpHandler Table[HktVMDispatch::NumOpCodes + 1] =
+    {
+        HKT_VM_OPCODE_HANDLERS(HKT_VM_TABLE_STEP, HKT_VM_TABLE_STOP)
+        [](FHktVMInterpreter&, FHktVMRuntime&, FInstruction) -> EVMStatus { return EVMStatus::Failed; }
+    };
+
+    #undef HKT_VM_TABLE_STEP
+    #undef HKT_VM_TABLE_STOP
+    return Table;
+}
+
+bool FHktVMInterpreter::IsStopOp(EOpCode Op)
+{
+    #define HKT_VM_IS_STOP_STEP(Name, Body) false,
+    #define HKT_VM_IS_STOP_STOP(Name, Body) true,
+    static constexpr bool Table[HktVMDispatch::NumOpCodes + 1] =
+    {
+        HKT_VM_OPCODE_HANDLERS(HKT_VM_IS_STOP_STEP, HKT_VM_IS_STOP_STOP)
+        true
+    };
+    #undef HKT_VM_IS_STOP_STEP
+    #undef HKT_VM_IS_STOP_STOP
+    return Table[FMath::Min<uint32>(static_cast<uint32>(Op), HktVMDispatch::NumOpCodes)];
+}
+
+const TCHAR* FHktVMInterpreter::GetOpName(EOpCode Op)
+{
+    #define HKT_VM_OP_NAME(Name, Body) TEXT(#Name),
+    static const TCHAR* const Table[HktVMDispatch::NumOpCodes + 1] =
+    {
+        HKT_VM_OPCODE_HANDLERS(HKT_VM_OP_NAME, HKT_VM_OP_NAME)
+        TEXT("Invalid")
+    };
+    #undef HKT_VM_OP_NAME
+    return Table[FMath::Min<uint32>(static_cast<uint32>(Op), HktVMDispatch::NumOpCodes)];
+}
+
+EVMStatus FHktVMInterpreter::Execute(FHktVMRuntime& Runtime, int32& Budget)
+{
+    // 검증된 프로그램만 실행: 점프 대상/레지스터 인덱스가 보장되므로
+    // 명령어마다 PC 범위를 검사하지 않음 (FHktVMVerifier)
+    if (!Runtime.Program || !Runtime.Program->bVerified)
         return EVMStatus::Failed;
     
-    if (Runtime.Status == EVMStatus::WaitingEvent)
-        return EVMStatus::WaitingEvent;
+    // AOT 네이티브 진입점 (바이트코드 해시가 일치할 때만 연결됨)
+    if (Runtime.Program->NativeEntry && bEnableNative)
+    {
+#if !UE_BUILD_SHIPPING
+        if (bVerifyNative)
+            return ExecuteNativeVerified(Runtime, Budget);
+#endif
+        return Runtime.Program->NativeEntry(*this, Runtime, Budget);
+    }
     
-    const FHktVMProgram& Program = *Runtime.Program;
-    int32 InstructionCount = 0;
+    return ExecuteBytecode(Runtime, Budget);
+}
+
+#if !UE_BUILD_SHIPPING
+EVMStatus FHktVMInterpreter::ExecuteNativeVerified(FHktVMRuntime& Runtime, int32& Budget)
+{
+    // 기준: 복사본(Runtime + Store)에서 바이트코드 실행
+    // 게임 상태에 남지 않도록 전용 아레나 + 트레이스 억제 (공유 QueryArena/트레이스 링을 건드리지 않음)
+    FHktVMRuntime RefRuntime = Runtime;
+    FHktVMStore RefStore;
+    if (Runtime.Store)
+    {
+        RefStore = *Runtime.Store;
+        RefRuntime.Store = &RefStore;
+    }
     
-    while (InstructionCount < MaxInstructionsPerTick)
+    FHktVMQueryArena RefArena;
+    FHktVMInterpreter RefVM;
+    RefVM.Stash = Stash;
+    RefVM.SpatialIndex = SpatialIndex;
+    RefVM.QueryArena = &RefArena;
+    
+    int32 RefBudget = Budget;
+    EVMStatus RefStatus;
     {
-        if (Runtime.PC < 0 || Runtime.PC >= Program.CodeSize())
-            return EVMStatus::Completed;
-        
-        const FInstruction& Inst = Program.Code[Runtime.PC];
-        Runtime.PC++;
-        InstructionCount++;
+        FHktVMTrace::FScopedSuppress SuppressTrace;
+        RefStatus = RefVM.ExecuteBytecode(RefRuntime, RefBudget);
+    }
+    
+    const EVMStatus Status = Runtime.Program->NativeEntry(*this, Runtime, Budget);
+    
+    if (const TCHAR* Mismatch = FindExecutionMismatch(Status, Runtime, Budget, RefStatus, RefRuntime, RefBudget))
+    {
+        NativeMismatchCount.fetch_add(1, std::memory_order_relaxed);
+        UE_LOG(LogTemp, Error, TEXT("[VM Native] %s: native/bytecode mismatch (%s) at PC %d (bytecode PC %d)"),
+            *Runtime.Program->Tag.ToString(), Mismatch, Runtime.PC, RefRuntime.PC);
+    }
+    return Status;
+}
+#endif
+
+const TCHAR* FHktVMInterpreter::FindExecutionMismatch(
+    EVMStatus Status, const FHktVMRuntime& Runtime, int32 Budget,
+    EVMStatus RefStatus, const FHktVMRuntime& RefRuntime, int32 RefBudget)
+{
+    if (Status != RefStatus)
+        return TEXT("status");
+    if (Runtime.PC != RefRuntime.PC)
+        return TEXT("PC");
+    if (Budget != RefBudget)
+        return TEXT("budget");
+    if (FMemory::Memcmp(Runtime.Registers, RefRuntime.Registers, sizeof(Runtime.Registers)) != 0)
+        return TEXT("registers");
+    if (Runtime.WaitFrames != RefRuntime.WaitFrames
+        || Runtime.EventWait.Type != RefRuntime.EventWait.Type
+        || Runtime.EventWait.WatchedEntity != RefRuntime.EventWait.WatchedEntity)
+        return TEXT("wait state");
+    if (Runtime.PendingSpawn.Owner != RefRuntime.PendingSpawn.Owner
+        || Runtime.PendingSpawn.EntityType != RefRuntime.PendingSpawn.EntityType)
+        return TEXT("pending spawn");
+    
+    // 검색 결과는 서로 다른 아레나에 있을 수 있으므로 내용 비교
+    const FSpatialQueryResult& Query = Runtime.SpatialQuery;
+    const FSpatialQueryResult& RefQuery = RefRuntime.SpatialQuery;
+    if (Query.Num != RefQuery.Num || Query.CurrentIndex != RefQuery.CurrentIndex
+        || (Query.Entities != RefQuery.Entities && Query.Num > 0
+            && FMemory::Memcmp(Query.Entities, RefQuery.Entities, Query.Num * sizeof(EntityId)) != 0))
+        return TEXT("spatial query");
+    
+    if ((Runtime.Store != nullptr) != (RefRuntime.Store != nullptr))
+        return TEXT("store");
+    if (Runtime.Store)
+    {
+        const TArray<FHktVMStore::FPendingWrite>& A = Runtime.Store->PendingWrites;
+        const TArray<FHktVMStore::FPendingWrite>& B = RefRuntime.Store->PendingWrites;
+        if (A.Num() != B.Num() || Runtime.Store->PendingDestroys != RefRuntime.Store->PendingDestroys)
+            return TEXT("store writes");
+        for (int32 i = 0; i < A.Num(); ++i)
+        {
+            if (A[i].Entity != B[i].Entity || A[i].PropertyId != B[i].PropertyId || A[i].Value != B[i].Value)
+                return TEXT("store writes");
+        }
+    }
+    return nullptr;
+}
+
+EVMStatus FHktVMInterpreter::ExecuteBytecode(FHktVMRuntime& Runtime, int32& Budget)
+{
+    const FInstruction* const Code = Runtime.Program->Code.GetData();
+    checkSlow(Runtime.PC >= 0 && Runtime.PC < Runtime.Program->CodeSize());
+    FInstruction Inst;
+
+#if HKT_VM_COMPUTED_GOTO
+    FHktVMInterpreter& VM = *this;
+
+    #define HKT_VM_LABEL_ADDR(Name, Body) &&L_##Name,
+    static void* const DispatchTable[HktVMDispatch::NumOpCodes + 1] =
+    {
+        HKT_VM_OPCODE_HANDLERS(HKT_VM_LABEL_ADDR, HKT_VM_LABEL_ADDR)
+        &&L_Invalid
+    };
+    #undef HKT_VM_LABEL_ADDR
+
+    // 명령어 한도 → fetch → 핸들러로 직접 점프
+    #define HKT_VM_DISPATCH() \
+        do { \
+            if (Budget-- <= 0) return EVMStatus::Yielded; \
+            Inst = Code[Runtime.PC++]; \
+            goto *DispatchTable[HktVMDispatch::HandlerIndex(Inst)]; \
+        } while (0)
+
+    #define HKT_VM_GOTO_STEP(Name, Stmt) L_##Name: Stmt; HKT_VM_DISPATCH();
+    #define HKT_VM_GOTO_STOP(Name, Expr) L_##Name: return Expr;
+
+    HKT_VM_DISPATCH();
+    HKT_VM_OPCODE_HANDLERS(HKT_VM_GOTO_STEP, HKT_VM_GOTO_STOP)
+
+L_Invalid:
+    return EVMStatus::Failed;
+
+    #undef HKT_VM_GOTO_STEP
+    #undef HKT_VM_GOTO_STOP
+    #undef HKT_VM_DISPATCH
+#else
+    const FOpHandler* const Handlers = GetHandlerTable();
+    
+    while (Budget-- > 0)
+    {
+        Inst = Code[Runtime.PC++];
         
-        EVMStatus Status = ExecuteInstruction(Runtime, Inst);
+        EVMStatus Status = Handlers[HktVMDispatch::HandlerIndex(Inst)](*this, Runtime, Inst);
         if (Status != EVMStatus::Running)
             return Status;
     }
     
     return EVMStatus::Yielded;
+#endif
 }
 
 EVMStatus FHktVMInterpreter::ExecuteInstruction(FHktVMRuntime& Runtime, const FInstruction& Inst)
 {
-    switch (Inst.GetOpCode())
-    {
-    case EOpCode::Nop: break;
-    case EOpCode::Halt: return EVMStatus::Completed;
-    case EOpCode::Yield: return Op_Yield(Runtime, Inst.Imm12);
-    case EOpCode::YieldSeconds: return Op_YieldSeconds(Runtime, Inst.GetSignedImm20());
-    case EOpCode::Jump: Op_Jump(Runtime, Inst.Imm20); break;
-    case EOpCode::JumpIf: Op_JumpIf(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::JumpIfNot: Op_JumpIfNot(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::WaitCollision: return Op_WaitCollision(Runtime, Inst.Src1);
-    case EOpCode::LoadConst: Op_LoadConst(Runtime, Inst._Dst, Inst.GetSignedImm20()); break;
-    case EOpCode::LoadConstHigh: Op_LoadConstHigh(Runtime, Inst.Dst, Inst.Imm12); break;
-    case EOpCode::LoadStore: Op_LoadStore(Runtime, Inst.Dst, Inst.Imm12); break;
-    case EOpCode::LoadStoreEntity: Op_LoadStoreEntity(Runtime, Inst.Dst, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::SaveStore: Op_SaveStore(Runtime, Inst.Imm12, Inst.Src1); break;
-    case EOpCode::SaveStoreEntity: Op_SaveStoreEntity(Runtime, Inst.Src1, Inst.Imm12, Inst.Src2); break;
-    case EOpCode::Move: Op_Move(Runtime, Inst.Dst, Inst.Src1); break;
-    case EOpCode::Add: Op_Add(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::Sub: Op_Sub(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::Mul: Op_Mul(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::Div: Op_Div(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::Mod: Op_Mod(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::AddImm: Op_AddImm(Runtime, Inst.Dst, Inst.Src1, Inst.GetSignedImm12()); break;
-    case EOpCode::CmpEq: Op_CmpEq(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::CmpNe: Op_CmpNe(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::CmpLt: Op_CmpLt(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::CmpLe: Op_CmpLe(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::CmpGt: Op_CmpGt(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::CmpGe: Op_CmpGe(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::SpawnEntity: Op_SpawnEntity(Runtime, Inst.GetSignedImm20()); break;
-    case EOpCode::DestroyEntity: Op_DestroyEntity(Runtime, Inst.Src1); break;
-    case EOpCode::GetPosition: Op_GetPosition(Runtime, Inst.Dst, Inst.Src1); break;
-    case EOpCode::SetPosition: Op_SetPosition(Runtime, Inst.Dst, Inst.Src1); break;
-    case EOpCode::GetDistance: Op_GetDistance(Runtime, Inst.Dst, Inst.Src1, Inst.Src2); break;
-    case EOpCode::MoveToward: Op_MoveToward(Runtime, Inst.Dst, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::MoveForward: Op_MoveForward(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::StopMovement: Op_StopMovement(Runtime, Inst.Src1); break;
-    case EOpCode::FindInRadius: Op_FindInRadius(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::NextFound: Op_NextFound(Runtime); break;
-    case EOpCode::ApplyDamage: Op_ApplyDamage(Runtime, Inst.Src1, Inst.Src2); break;
-    case EOpCode::ApplyEffect: Op_ApplyEffect(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::RemoveEffect: Op_RemoveEffect(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::PlayAnim: Op_PlayAnim(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::PlayAnimMontage: Op_PlayAnimMontage(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::StopAnim: Op_StopAnim(Runtime, Inst.Src1); break;
-    case EOpCode::PlayVFX: Op_PlayVFX(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::PlayVFXAttached: Op_PlayVFXAttached(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::PlaySound: Op_PlaySound(Runtime, Inst.GetSignedImm20()); break;
-    case EOpCode::PlaySoundAtLocation: Op_PlaySoundAtLocation(Runtime, Inst.Src1, Inst.Imm12); break;
-    case EOpCode::SpawnEquipment: Op_SpawnEquipment(Runtime, Inst.Src1, Inst.Src2, Inst.Imm12); break;
-    case EOpCode::Log: Op_Log(Runtime, Inst.GetSignedImm20()); break;
-    default: return EVMStatus::Failed;
-    }
-    return EVMStatus::Running;
+    return GetHandlerTable()[HktVMDispatch::HandlerIndex(Inst)](*this, Runtime, Inst);
 }
 
 // Control Flow
 void FHktVMInterpreter::Op_Nop(FHktVMRuntime& Runtime) {}
 EVMStatus FHktVMInterpreter::Op_Halt(FHktVMRuntime& Runtime) { return EVMStatus::Completed; }
 EVMStatus FHktVMInterpreter::Op_Yield(FHktVMRuntime& Runtime, int32 Frames) { Runtime.WaitFrames = FMath::Max(1, Frames); return EVMStatus::Yielded; }
-EVMStatus FHktVMInterpreter::Op_YieldSeconds(FHktVMRuntime& Runtime, int32 DeciMillis) { Runtime.EventWait.Type = EWaitEventType::Timer; Runtime.EventWait.RemainingTime = DeciMillis / 100.0f; return EVMStatus::WaitingEvent; }
+EVMStatus FHktVMInterpreter::Op_YieldSeconds(FHktVMRuntime& Runtime, int32 DeciMillis) { Runtime.EventWait.Type = EWaitEventType::Timer; Runtime.WaitFrames = FMath::Max(1, (DeciMillis * LogicFramesPerSecond + 99) / 100); return EVMStatus::WaitingEvent; }
 void FHktVMInterpreter::Op_Jump(FHktVMRuntime& Runtime, int32 Target) { Runtime.PC = Target; }
 void FHktVMInterpreter::Op_JumpIf(FHktVMRuntime& Runtime, RegisterIndex Cond, int32 Target) { if (Runtime.GetReg(Cond) != 0) Runtime.PC = Target; }
 void FHktVMInterpreter::Op_JumpIfNot(FHktVMRuntime& Runtime, RegisterIndex Cond, int32 Target) { if (Runtime.GetReg(Cond) == 0) Runtime.PC = Target; }
 
 // Event Wait
-EVMStatus FHktVMInterpreter::Op_WaitCollision(FHktVMRuntime& Runtime, RegisterIndex WatchEntity) { Runtime.EventWait.Type = EWaitEventType::Collision; Runtime.EventWait.WatchedEntity = Runtime.GetRegEntity(WatchEntity); return EVMStatus::WaitingEvent; }
+EVMStatus FHktVMInterpreter::Op_WaitCollision(FHktVMRuntime& Runtime, RegisterIndex WatchEntity) { return Op_WaitEvent(Runtime, EWaitEventType::Collision, WatchEntity); }
+EVMStatus FHktVMInterpreter::Op_WaitEvent(FHktVMRuntime& Runtime, EWaitEventType Type, RegisterIndex WatchEntity) { Runtime.EventWait.Type = Type; Runtime.EventWait.WatchedEntity = Runtime.GetRegEntity(WatchEntity); return EVMStatus::WaitingEvent; }
 
 // Data
 void FHktVMInterpreter::Op_LoadConst(FHktVMRuntime& Runtime, RegisterIndex Dst, int32 Value) { Runtime.SetReg(Dst, Value); }
 void FHktVMInterpreter::Op_LoadConstHigh(FHktVMRuntime& Runtime, RegisterIndex Dst, int32 HighBits) { Runtime.SetReg(Dst, (Runtime.GetReg(Dst) & 0xFFFFF) | (HighBits << 20)); }
+void FHktVMInterpreter::Op_LoadConstPool(FHktVMRuntime& Runtime, RegisterIndex Dst, int32 Index) { Runtime.SetReg(Dst, Runtime.Program->Constants[Index]); }
 void FHktVMInterpreter::Op_LoadStore(FHktVMRuntime& Runtime, RegisterIndex Dst, uint16 PropertyId) { if (Runtime.Store) Runtime.SetReg(Dst, Runtime.Store->Read(PropertyId)); }
-void FHktVMInterpreter::Op_LoadStoreEntity(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Entity, uint16 PropertyId) { if (Stash) Runtime.SetReg(Dst, Stash->GetProperty(Runtime.GetRegEntity(Entity), PropertyId)); }
+void FHktVMInterpreter::Op_LoadStoreEntity(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Entity, uint16 PropertyId) { if (Stash) Runtime.SetReg(Dst, Stash.GetProperty(Runtime.GetRegEntity(Entity), PropertyId)); }
 void FHktVMInterpreter::Op_SaveStore(FHktVMRuntime& Runtime, uint16 PropertyId, RegisterIndex Src) { if (Runtime.Store) Runtime.Store->Write(PropertyId, Runtime.GetReg(Src)); }
-void FHktVMInterpreter::Op_SaveStoreEntity(FHktVMRuntime& Runtime, RegisterIndex Entity, uint16 PropertyId, RegisterIndex Src) { if (Runtime.Store) { FHktVMStore::FPendingWrite W; W.Entity = Runtime.GetRegEntity(Entity); W.PropertyId = PropertyId; W.Value = Runtime.GetReg(Src); Runtime.Store->PendingWrites.Add(W); } }
+void FHktVMInterpreter::Op_SaveStoreEntity(FHktVMRuntime& Runtime, RegisterIndex Entity, uint16 PropertyId, RegisterIndex Src) { if (Runtime.Store) Runtime.Store->WriteEntityDeferred(Runtime.GetRegEntity(Entity), PropertyId, Runtime.GetReg(Src)); }
 void FHktVMInterpreter::Op_Move(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Src) { Runtime.SetReg(Dst, Runtime.GetReg(Src)); }
 
 // Arithmetic
@@ -129,4 +368,14 @@ void FHktVMInterpreter::Op_CmpNe(FHktVMRuntime& Runtime, RegisterIndex Dst, Regi
 void FHktVMInterpreter::Op_CmpLt(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2) { Runtime.SetReg(Dst, Runtime.GetReg(Src1) < Runtime.GetReg(Src2) ? 1 : 0); }
 void FHktVMInterpreter::Op_CmpLe(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2) { Runtime.SetReg(Dst, Runtime.GetReg(Src1) <= Runtime.GetReg(Src2) ? 1 : 0); }
 void FHktVMInterpreter::Op_CmpGt(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2) { Runtime.SetReg(Dst, Runtime.GetReg(Src1) > Runtime.GetReg(Src2) ? 1 : 0); }
-void FHktVMInterpreter::Op_CmpGe(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2) { Runtime.SetReg(Dst, Runtime.GetReg(Src1) >= Runtime.GetReg(Src2) ? 1 : 0); }
\ No newline at end of file
+void FHktVMInterpreter::Op_CmpGe(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2) { Runtime.SetReg(Dst, Runtime.GetReg(Src1) >= Runtime.GetReg(Src2) ? 1 : 0); }
+
+// Superinstructions (각각 LoadConst/CmpXX와 후속 명령어를 합친 것과 동일한 효과)
+void FHktVMInterpreter::Op_SaveStoreConst(FHktVMRuntime& Runtime, uint16 PropertyId, int32 Value) { if (Runtime.Store) Runtime.Store->Write(PropertyId, Value); }
+void FHktVMInterpreter::Op_SaveStoreEntityConst(FHktVMRuntime& Runtime, RegisterIndex Entity, uint16 PropertyId, int32 Value) { if (Runtime.Store) Runtime.Store->WriteEntityDeferred(Runtime.GetRegEntity(Entity), PropertyId, Value); }
+void FHktVMInterpreter::Op_JumpIfEq(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target) { if (Runtime.GetReg(Src1) == Runtime.GetReg(Src2)) Runtime.PC = Target; }
+void FHktVMInterpreter::Op_JumpIfNe(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target) { if (Runtime.GetReg(Src1) != Runtime.GetReg(Src2)) Runtime.PC = Target; }
+void FHktVMInterpreter::Op_JumpIfLt(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target) { if (Runtime.GetReg(Src1) < Runtime.GetReg(Src2)) Runtime.PC = Target; }
+void FHktVMInterpreter::Op_JumpIfLe(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target) { if (Runtime.GetReg(Src1) <= Runtime.GetReg(Src2)) Runtime.PC = Target; }
+void FHktVMInterpreter::Op_JumpIfGt(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target) { if (Runtime.GetReg(Src1) > Runtime.GetReg(Src2)) Runtime.PC = Target; }
+void FHktVMInterpreter::Op_JumpIfGe(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target) { if (Runtime.GetReg(Src1) >= Runtime.GetReg(Src2)) Runtime.PC = Target; }
@@ -3,9 +3,9 @@
 #include "CoreMinimal.h"
 #include "HktVMTypes.h"
 #include "HktVMRuntime.h"
-
-// Forward declarations
-class IHktStashInterface;
+#include "HktVMSpatialIndex.h"
+#include "HktVMStashReader.h"
+#include <atomic>
 
 /**
  * FHktVMInterpreter - 바이트코드 인터프리터 (Pure C++)
@@ -18,12 +18,93 @@ class HKTCORE_API FHktVMInterpreter
 public:
     void Initialize(IHktStashInterface* InStash);
     
-    /** VM을 yield/완료/실패까지 실행 */
-    EVMStatus Execute(FHktVMRuntime& Runtime);
+    /** FindInRadius 결과를 저장할 아레나 (FHktVMProcessor가 프레임마다 교체) */
+    void SetQueryArena(FHktVMQueryArena* InQueryArena) { QueryArena = InQueryArena; }
+    
+    /** FindInRadius/FindNearest가 공유하는 공간 인덱스 (FHktVMProcessor 소유) */
+    void SetSpatialIndex(FHktVMSpatialIndex* InSpatialIndex) { SpatialIndex = InSpatialIndex; }
+    
+    /**
+     * VM을 yield/완료/실패/생성 대기까지 실행
+     * 
+     * 서로 다른 Runtime에 대해 여러 스레드에서 동시에 호출할 수 있습니다.
+     * (Stash는 읽기만 하고, 엔티티 생성/제거는 Runtime/Store에 요청으로 남김)
+     * 
+     * @param Budget 이번 틱에 남은 명령어 한도 (실행한 만큼 차감)
+     */
+    EVMStatus Execute(FHktVMRuntime& Runtime, int32& Budget);
+    
+    /**
+     * 광역(SPMD) 실행 - 같은 Program, 같은 PC의 VM들을 명령어 단위로 묶어서 실행
+     * 
+     * 레지스터를 SOA로 모아 레지스터 연산은 레인 전체에 한 번에 적용하고,
+     * 그 외 명령어는 레인별로 실행합니다. 분기가 레인마다 갈리거나 레인이 멈추면
+     * (Yield/Wait/생성 대기) 중단하고, 나머지는 Execute가 이어서 실행합니다.
+     * 
+     * @param Lanes        같은 Program/PC에 있는 실행 가능 VM (최대 MaxWideLanes)
+     * @param OutStatuses  레인별 결과 (Running이면 스칼라 실행으로 이어서 진행)
+     * @return 실행한 명령어 수 (모든 레인 공통)
+     */
+    int32 ExecuteWide(const TArray<FHktVMRuntime*>& Lanes, TArray<EVMStatus>& OutStatuses);
+    
+    /**
+     * AOT 네이티브 코드(FHktVMTranspiler 생성)에서 호출 - 명령어 하나를 핸들러로 실행
+     * 
+     * PC는 건드리지 않음 (분기는 생성 코드가 직접 처리)
+     */
+    FORCEINLINE EVMStatus ExecuteNativeOp(FHktVMRuntime& Runtime, FInstruction Inst)
+    {
+        return ExecuteInstruction(Runtime, Inst);
+    }
+    
+    /** 실행을 멈출 수 있는 명령어인지 (Halt/Yield/Wait/Spawn) */
+    static bool IsStopOp(EOpCode Op);
+    
+    /** OpCode 이름 (디버그/코드 생성용) */
+    static const TCHAR* GetOpName(EOpCode Op);
+    
+    /** 네이티브 진입점이 있는 프로그램을 네이티브로 실행할지 */
+    bool bEnableNative = true;
+    
+    /**
+     * 차등 검증: 네이티브 실행마다 같은 입력으로 바이트코드도 실행해 결과 비교 (개발 빌드 전용, 느림)
+     * 기준 실행은 Runtime/Store 복사본 + 전용 검색 아레나 + 트레이스 억제로 게임 상태에 남지 않음
+     * 불일치 시 Error 로그 + GetNativeMismatchCount 증가, 게임 상태는 네이티브 결과를 사용
+     * (정식 검증은 헤드리스 차등 테스트 HktCore.VM.NativeDifferential)
+     */
+    bool bVerifyNative = false;
+    
+    int32 GetNativeMismatchCount() const { return NativeMismatchCount.load(std::memory_order_relaxed); }
+    
+    /**
+     * 같은 입력에서 출발한 두 실행 결과 비교 (상태/PC/예산/레지스터/대기/생성 요청/검색 결과/Store 쓰기)
+     * @return 처음 다른 항목 이름, 같으면 nullptr
+     */
+    static const TCHAR* FindExecutionMismatch(
+        EVMStatus Status, const FHktVMRuntime& Runtime, int32 Budget,
+        EVMStatus RefStatus, const FHktVMRuntime& RefRuntime, int32 RefBudget);
+    
+    static constexpr int32 MaxWideLanes = 64;
+    static constexpr int32 MaxInstructionsPerTick = 10000;
 
 private:
+    /** 바이트코드 실행 (네이티브 진입점과 무관한 기준 구현) */
+    EVMStatus ExecuteBytecode(FHktVMRuntime& Runtime, int32& Budget);
+    
+#if !UE_BUILD_SHIPPING
+    /** 바이트코드와 네이티브를 모두 실행해 비교 */
+    EVMStatus ExecuteNativeVerified(FHktVMRuntime& Runtime, int32& Budget);
+#endif
+    
+    /** 단일 명령어 실행 (핸들러 테이블 경유) */
     EVMStatus ExecuteInstruction(FHktVMRuntime& Runtime, const FInstruction& Inst);
     
+    /** OpCode별 핸들러 (computed-goto 미지원 컴파일러용 디스패치 테이블) */
+    using FOpHandler = EVMStatus (*)(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, FInstruction Inst);
+    
+    /** EOpCode::Max + 1 크기의 핸들러 테이블 (마지막 엔트리 = 잘못된 OpCode) */
+    static const FOpHandler* GetHandlerTable();
+    
     // ===== Control Flow =====
     void Op_Nop(FHktVMRuntime& Runtime);
     EVMStatus Op_Halt(FHktVMRuntime& Runtime);
@@ -35,10 +116,12 @@ private:
     
     // ===== Event Wait =====
     EVMStatus Op_WaitCollision(FHktVMRuntime& Runtime, RegisterIndex WatchEntity);
+    EVMStatus Op_WaitEvent(FHktVMRuntime& Runtime, EWaitEventType Type, RegisterIndex WatchEntity);
     
     // ===== Data Operations =====
     void Op_LoadConst(FHktVMRuntime& Runtime, RegisterIndex Dst, int32 Value);
     void Op_LoadConstHigh(FHktVMRuntime& Runtime, RegisterIndex Dst, int32 HighBits);
+    void Op_LoadConstPool(FHktVMRuntime& Runtime, RegisterIndex Dst, int32 Index);
     void Op_LoadStore(FHktVMRuntime& Runtime, RegisterIndex Dst, uint16 PropertyId);
     void Op_LoadStoreEntity(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Entity, uint16 PropertyId);
     void Op_SaveStore(FHktVMRuntime& Runtime, uint16 PropertyId, RegisterIndex Src);
@@ -62,7 +145,7 @@ private:
     void Op_CmpGe(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2);
     
     // ===== Entity Management =====
-    void Op_SpawnEntity(FHktVMRuntime& Runtime, int32 StringIndex);
+    EVMStatus Op_SpawnEntity(FHktVMRuntime& Runtime, int32 StringIndex);
     void Op_DestroyEntity(FHktVMRuntime& Runtime, RegisterIndex Entity);
     
     // ===== Position & Movement =====
@@ -73,8 +156,16 @@ private:
     void Op_MoveForward(FHktVMRuntime& Runtime, RegisterIndex Entity, int32 Speed);
     void Op_StopMovement(FHktVMRuntime& Runtime, RegisterIndex Entity);
     
+    // ===== Vector =====
+    void Op_Vec3Add(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase);
+    void Op_Vec3Sub(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase);
+    void Op_Vec3Scale(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex Scalar);
+    void Op_Vec3DistSq(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex ABase, RegisterIndex BBase);
+    void Op_Vec3Toward(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex FromBase, RegisterIndex ToBase, int32 Length);
+    
     // ===== Spatial Query =====
     void Op_FindInRadius(FHktVMRuntime& Runtime, RegisterIndex CenterEntity, int32 RadiusCm);
+    void Op_FindNearest(FHktVMRuntime& Runtime, RegisterIndex CenterEntity, int32 K, int32 RadiusCm);
     void Op_NextFound(FHktVMRuntime& Runtime);
     
     // ===== Combat =====
@@ -94,16 +185,37 @@ private:
     void Op_PlaySoundAtLocation(FHktVMRuntime& Runtime, RegisterIndex PosBase, int32 StringIndex);
     
     // ===== Equipment =====
-    void Op_SpawnEquipment(FHktVMRuntime& Runtime, RegisterIndex Owner, int32 Slot, int32 StringIndex);
+    EVMStatus Op_SpawnEquipment(FHktVMRuntime& Runtime, RegisterIndex Owner, int32 Slot, int32 StringIndex);
     
     // ===== Utility =====
     void Op_Log(FHktVMRuntime& Runtime, int32 StringIndex);
     
+    // ===== Superinstructions =====
+    void Op_SaveStoreConst(FHktVMRuntime& Runtime, uint16 PropertyId, int32 Value);
+    void Op_SaveStoreEntityConst(FHktVMRuntime& Runtime, RegisterIndex Entity, uint16 PropertyId, int32 Value);
+    void Op_ApplyDamageConst(FHktVMRuntime& Runtime, RegisterIndex Target, int32 Amount);
+    void Op_JumpIfEq(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target);
+    void Op_JumpIfNe(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target);
+    void Op_JumpIfLt(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target);
+    void Op_JumpIfLe(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target);
+    void Op_JumpIfGt(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target);
+    void Op_JumpIfGe(FHktVMRuntime& Runtime, RegisterIndex Src1, RegisterIndex Src2, int32 Target);
+    
     // ===== Helper =====
     const FString& GetString(FHktVMRuntime& Runtime, int32 Index);
+    void ApplyDamageTo(FHktVMRuntime& Runtime, EntityId E, int32 Dmg);
+    
+    /** 검색 중심(Store 기준 위치)과 적 팀 필터 준비 - 인덱스가 없으면 false */
+    bool PrepareSpatialQuery(FHktVMRuntime& Runtime, RegisterIndex CenterEntity, FIntVector& OutCenter, FHktVMSpatialFilter& OutFilter);
+    
+    /** 검색 결과를 아레나로 복사하고 Reg::Count 설정 */
+    void StoreSpatialQuery(FHktVMRuntime& Runtime, const TArray<EntityId>& Found);
 
 private:
-    static constexpr int32 MaxInstructionsPerTick = 10000;
+    /** 읽기 전용 Stash 접근 (HktCore Stash면 가상 호출 없음) */
+    FHktVMStashReader Stash;
+    FHktVMQueryArena* QueryArena = nullptr;
+    FHktVMSpatialIndex* SpatialIndex = nullptr;
     
-    IHktStashInterface* Stash = nullptr;
+    std::atomic<int32> NativeMismatchCount{ 0 };
 };
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "HktVMProgram.h"
 #include "HktVMStore.h"
 #include "HktCoreInterfaces.h"
+#include "HktVMTrace.h"
+#include "HktFixedMath.h"
 
 // Helper
 const FString& FHktVMInterpreter::GetString(FHktVMRuntime& Runtime, int32 Index)
@@ -13,34 +15,29 @@ const FString& FHktVMInterpreter::GetString(FHktVMRuntime& Runtime, int32 Index)
 }
 
 // Entity Management
-void FHktVMInterpreter::Op_SpawnEntity(FHktVMRuntime& Runtime, int32 StringIndex)
+EVMStatus FHktVMInterpreter::Op_SpawnEntity(FHktVMRuntime& Runtime, int32 StringIndex)
 {
-    const FString& ClassPath = GetString(Runtime, StringIndex);
-    UE_LOG(LogTemp, Log, TEXT("[VM] SpawnEntity: %s"), *ClassPath);
+    HKT_VM_TRACE_EVENT(SpawnEntity, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Reg::Self), StringIndex);
     
-    if (Stash)
-    {
-        EntityId NewEntity = Stash->AllocateEntity();
-        Runtime.SetRegEntity(Reg::Spawned, NewEntity);
-        
-        // 소유자 설정 (Store를 통해 버퍼링)
-        if (Runtime.Store)
-        {
-            Runtime.Store->WriteEntity(NewEntity, PropertyId::OwnerEntity, Runtime.GetRegEntity(Reg::Self));
-            Runtime.Store->WriteEntity(NewEntity, PropertyId::EntityType, HktEntityType::Projectile);
-        }
-    }
+    if (!Stash)
+        return EVMStatus::Running;
+    
+    // 할당은 FHktVMProcessor가 라운드 사이에 순서대로 수행 (Reg::Spawned 기록 후 재개)
+    Runtime.PendingSpawn.Owner = Runtime.GetRegEntity(Reg::Self);
+    Runtime.PendingSpawn.EntityType = HktEntityType::Projectile;
+    return EVMStatus::PendingSpawn;
 }
 
 void FHktVMInterpreter::Op_DestroyEntity(FHktVMRuntime& Runtime, RegisterIndex Entity)
 {
     EntityId E = Runtime.GetRegEntity(Entity);
-    UE_LOG(LogTemp, Log, TEXT("[VM] DestroyEntity: %u"), E.RawValue);
+    HKT_VM_TRACE_EVENT(DestroyEntity, Runtime.SlotIndex, (int32)E, 0);
     
-    // 엔티티 제거는 즉시 적용 (다른 VM이 참조하지 못하게)
-    if (Stash)
+    // 엔티티 제거는 Execute 종료 시 적용 (같은 프레임의 모든 VM이 같은 엔티티 집합을 보도록)
+    if (Stash && Runtime.Store)
     {
-        Stash->FreeEntity(E);
+        Runtime.Store->DestroyEntity(E);
+        Runtime.bRecordedDestroy = true;
     }
 }
 
@@ -74,20 +71,17 @@ void FHktVMInterpreter::Op_GetDistance(FHktVMRuntime& Runtime, RegisterIndex Dst
         EntityId E1 = Runtime.GetRegEntity(Entity1);
         EntityId E2 = Runtime.GetRegEntity(Entity2);
         
-        int32 X1 = Runtime.Store->ReadEntity(E1, PropertyId::PosX);
-        int32 Y1 = Runtime.Store->ReadEntity(E1, PropertyId::PosY);
-        int32 Z1 = Runtime.Store->ReadEntity(E1, PropertyId::PosZ);
+        const FIntVector P1(
+            Runtime.Store->ReadEntity(E1, PropertyId::PosX),
+            Runtime.Store->ReadEntity(E1, PropertyId::PosY),
+            Runtime.Store->ReadEntity(E1, PropertyId::PosZ));
+        const FIntVector P2(
+            Runtime.Store->ReadEntity(E2, PropertyId::PosX),
+            Runtime.Store->ReadEntity(E2, PropertyId::PosY),
+            Runtime.Store->ReadEntity(E2, PropertyId::PosZ));
         
-        int32 X2 = Runtime.Store->ReadEntity(E2, PropertyId::PosX);
-        int32 Y2 = Runtime.Store->ReadEntity(E2, PropertyId::PosY);
-        int32 Z2 = Runtime.Store->ReadEntity(E2, PropertyId::PosZ);
-        
-        int64 DX = X2 - X1;
-        int64 DY = Y2 - Y1;
-        int64 DZ = Z2 - Z1;
-        
-        int32 DistSq = static_cast<int32>(FMath::Min((int64)INT32_MAX, DX*DX + DY*DY + DZ*DZ));
-        Runtime.SetReg(Dst, FMath::Sqrt(static_cast<float>(DistSq)));
+        // 정수 제곱근 (float Sqrt는 플랫폼/최적화에 따라 절사 결과가 달라질 수 있음)
+        Runtime.SetReg(Dst, HktMath::Distance(P1, P2));
     }
 }
 
@@ -102,7 +96,7 @@ void FHktVMInterpreter::Op_MoveToward(FHktVMRuntime& Runtime, RegisterIndex Enti
         Runtime.Store->WriteEntity(E, PropertyId::MoveSpeed, Speed);
         Runtime.Store->WriteEntity(E, PropertyId::IsMoving, 1);
     }
-    UE_LOG(LogTemp, Log, TEXT("[VM] MoveToward: Entity %u, Speed %d"), (int32)Runtime.GetRegEntity(Entity), Speed);
+    HKT_VM_TRACE_EVENT(MoveToward, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Entity), Speed);
 }
 
 void FHktVMInterpreter::Op_MoveForward(FHktVMRuntime& Runtime, RegisterIndex Entity, int32 Speed)
@@ -113,7 +107,7 @@ void FHktVMInterpreter::Op_MoveForward(FHktVMRuntime& Runtime, RegisterIndex Ent
         Runtime.Store->WriteEntity(E, PropertyId::MoveSpeed, Speed);
         Runtime.Store->WriteEntity(E, PropertyId::IsMoving, 1);
     }
-    UE_LOG(LogTemp, Log, TEXT("[VM] MoveForward: Entity %u, Speed %d"), (int32)Runtime.GetRegEntity(Entity), Speed);
+    HKT_VM_TRACE_EVENT(MoveForward, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Entity), Speed);
 }
 
 void FHktVMInterpreter::Op_StopMovement(FHktVMRuntime& Runtime, RegisterIndex Entity)
@@ -123,50 +117,131 @@ void FHktVMInterpreter::Op_StopMovement(FHktVMRuntime& Runtime, RegisterIndex En
         EntityId E = Runtime.GetRegEntity(Entity);
         Runtime.Store->WriteEntity(E, PropertyId::IsMoving, 0);
     }
-    UE_LOG(LogTemp, Log, TEXT("[VM] StopMovement: Entity %u"), (int32)Runtime.GetRegEntity(Entity));
+    HKT_VM_TRACE_EVENT(StopMovement, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Entity), 0);
+}
+
+// Vector
+// Add/Sub/Scale은 성분별로 바로 기록 (같은 레지스터를 겹쳐 쓰는 경우에도 스칼라 명령어 3개와 동일)
+void FHktVMInterpreter::Op_Vec3Add(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase)
+{
+    for (int32 i = 0; i < 3; ++i)
+    {
+        Runtime.SetReg(DstBase + i, Runtime.GetReg(ABase + i) + Runtime.GetReg(BBase + i));
+    }
+}
+
+void FHktVMInterpreter::Op_Vec3Sub(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase)
+{
+    for (int32 i = 0; i < 3; ++i)
+    {
+        Runtime.SetReg(DstBase + i, Runtime.GetReg(ABase + i) - Runtime.GetReg(BBase + i));
+    }
+}
+
+void FHktVMInterpreter::Op_Vec3Scale(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex Scalar)
+{
+    for (int32 i = 0; i < 3; ++i)
+    {
+        Runtime.SetReg(DstBase + i, Runtime.GetReg(ABase + i) * Runtime.GetReg(Scalar));
+    }
+}
+
+void FHktVMInterpreter::Op_Vec3DistSq(FHktVMRuntime& Runtime, RegisterIndex Dst, RegisterIndex ABase, RegisterIndex BBase)
+{
+    int64 DistSq = 0;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const int64 D = static_cast<int64>(Runtime.GetReg(BBase + i)) - Runtime.GetReg(ABase + i);
+        DistSq += D * D;
+    }
+    Runtime.SetReg(Dst, static_cast<int32>(FMath::Min(static_cast<int64>(INT32_MAX), DistSq)));
+}
+
+void FHktVMInterpreter::Op_Vec3Toward(FHktVMRuntime& Runtime, RegisterIndex DstBase, RegisterIndex FromBase, RegisterIndex ToBase, int32 Length)
+{
+    int64 Delta[3];
+    uint64 LenSq = 0;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        Delta[i] = static_cast<int64>(Runtime.GetReg(ToBase + i)) - Runtime.GetReg(FromBase + i);
+        LenSq += static_cast<uint64>(Delta[i] * Delta[i]);
+    }
+
+    // 같은 위치면 방향 없음 (0 벡터)
+    const int64 Len = static_cast<int64>(HktMath::SqrtU64(LenSq));
+    for (int32 i = 0; i < 3; ++i)
+    {
+        Runtime.SetReg(DstBase + i, Len > 0 ? static_cast<int32>(Delta[i] * Length / Len) : 0);
+    }
 }
 
 // Spatial Query
-void FHktVMInterpreter::Op_FindInRadius(FHktVMRuntime& Runtime, RegisterIndex CenterEntity, int32 RadiusCm)
+bool FHktVMInterpreter::PrepareSpatialQuery(FHktVMRuntime& Runtime, RegisterIndex CenterEntity, FIntVector& OutCenter, FHktVMSpatialFilter& OutFilter)
 {
     Runtime.SpatialQuery.Reset();
     
-    if (Stash && Runtime.Store)
+    if (!SpatialIndex || !Runtime.Store)
+        return false;
+    
+    SpatialIndex->EnsureBuilt();
+    
+    // 중심 위치/팀은 Store에서 읽기 (현재 VM의 로컬 캐시 반영), 다른 엔티티는 인덱스 (커밋된 상태)
+    const EntityId Center = Runtime.GetRegEntity(CenterEntity);
+    OutCenter.X = Runtime.Store->ReadEntity(Center, PropertyId::PosX);
+    OutCenter.Y = Runtime.Store->ReadEntity(Center, PropertyId::PosY);
+    OutCenter.Z = Runtime.Store->ReadEntity(Center, PropertyId::PosZ);
+    
+    OutFilter.ExcludeEntity = Center;
+    OutFilter.TeamMode = FHktVMSpatialFilter::ETeam::Enemies;
+    OutFilter.TeamValue = Runtime.Store->ReadEntity(Center, PropertyId::Team);
+    return true;
+}
+
+void FHktVMInterpreter::StoreSpatialQuery(FHktVMRuntime& Runtime, const TArray<EntityId>& Found)
+{
+    // 확정된 결과만 프레임 아레나에 복사
+    if (Found.Num() > 0 && QueryArena)
     {
-        EntityId Center = Runtime.GetRegEntity(CenterEntity);
-        
-        // 중심 위치는 Store에서 읽기 (현재 VM의 로컬 캐시 반영)
-        int32 CX = Runtime.Store->ReadEntity(Center, PropertyId::PosX);
-        int32 CY = Runtime.Store->ReadEntity(Center, PropertyId::PosY);
-        int32 CZ = Runtime.Store->ReadEntity(Center, PropertyId::PosZ);
-        int32 Team = Runtime.Store->ReadEntity(Center, PropertyId::Team);
-        
-        int64 RadiusSq = static_cast<int64>(RadiusCm) * RadiusCm;
-        
-        // 다른 엔티티는 Stash에서 직접 읽기 (커밋된 상태)
-        for (int32 E = 0; E < 1024; ++E)
-        {
-            if (!Stash->IsValidEntity(E) || E == Center)
-                continue;
-            
-            if (Stash->GetProperty(E, PropertyId::Team) == Team)
-                continue;
-            
-            int32 EX = Stash->GetProperty(E, PropertyId::PosX);
-            int32 EY = Stash->GetProperty(E, PropertyId::PosY);
-            int32 EZ = Stash->GetProperty(E, PropertyId::PosZ);
-            
-            int64 DX = EX - CX;
-            int64 DY = EY - CY;
-            int64 DZ = EZ - CZ;
-            
-            if (DX*DX + DY*DY + DZ*DZ <= RadiusSq)
-                Runtime.SpatialQuery.Entities.Add(E);
-        }
+        EntityId* Dest = QueryArena->Allocate(Found.Num());
+        FMemory::Memcpy(Dest, Found.GetData(), Found.Num() * sizeof(EntityId));
+        Runtime.SpatialQuery.Entities = Dest;
+        Runtime.SpatialQuery.Num = Found.Num();
+    }
+    
+    Runtime.SetReg(Reg::Count, Runtime.SpatialQuery.Num);
+}
+
+void FHktVMInterpreter::Op_FindInRadius(FHktVMRuntime& Runtime, RegisterIndex CenterEntity, int32 RadiusCm)
+{
+    // 스레드별 수집 버퍼 (재사용)
+    thread_local TArray<EntityId> Found;
+    Found.Reset();
+    
+    FIntVector Center;
+    FHktVMSpatialFilter Filter;
+    if (PrepareSpatialQuery(Runtime, CenterEntity, Center, Filter))
+    {
+        SpatialIndex->FindInRadius(Center, RadiusCm, Filter, Found);
     }
     
-    Runtime.SetReg(Reg::Count, Runtime.SpatialQuery.Entities.Num());
-    UE_LOG(LogTemp, Log, TEXT("[VM] FindInRadius: Found %d entities"), Runtime.SpatialQuery.Entities.Num());
+    StoreSpatialQuery(Runtime, Found);
+    HKT_VM_TRACE_EVENT(FindInRadius, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(CenterEntity), Runtime.SpatialQuery.Num);
+}
+
+void FHktVMInterpreter::Op_FindNearest(FHktVMRuntime& Runtime, RegisterIndex CenterEntity, int32 K, int32 RadiusCm)
+{
+    thread_local TArray<EntityId> Found;
+    Found.Reset();
+    
+    FIntVector Center;
+    FHktVMSpatialFilter Filter;
+    if (PrepareSpatialQuery(Runtime, CenterEntity, Center, Filter))
+    {
+        SpatialIndex->FindNearest(Center, RadiusCm, K, Filter, Found);
+    }
+    
+    StoreSpatialQuery(Runtime, Found);
+    HKT_VM_TRACE_EVENT(FindNearest, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(CenterEntity), Runtime.SpatialQuery.Num);
 }
 
 void FHktVMInterpreter::Op_NextFound(FHktVMRuntime& Runtime)
@@ -186,12 +261,19 @@ void FHktVMInterpreter::Op_NextFound(FHktVMRuntime& Runtime)
 // Combat
 void FHktVMInterpreter::Op_ApplyDamage(FHktVMRuntime& Runtime, RegisterIndex Target, RegisterIndex Amount)
 {
-    EntityId E = Runtime.GetRegEntity(Target);
-    int32 Dmg = Runtime.GetReg(Amount);
-    
-    UE_LOG(LogTemp, Log, TEXT("[VM] ApplyDamage: Entity %u takes %d damage"), (int32)E, Dmg);
+    ApplyDamageTo(Runtime, Runtime.GetRegEntity(Target), Runtime.GetReg(Amount));
+}
+
+void FHktVMInterpreter::Op_ApplyDamageConst(FHktVMRuntime& Runtime, RegisterIndex Target, int32 Amount)
+{
+    ApplyDamageTo(Runtime, Runtime.GetRegEntity(Target), Amount);
+}
+
+void FHktVMInterpreter::ApplyDamageTo(FHktVMRuntime& Runtime, EntityId E, int32 Dmg)
+{
+    HKT_VM_TRACE_EVENT(ApplyDamage, Runtime.SlotIndex, (int32)E, Dmg);
     
-    if (Runtime.Store && Stash && Stash->IsValidEntity(E))
+    if (Runtime.Store && Stash.IsValidEntity(E))
     {
         int32 Health = Runtime.Store->ReadEntity(E, PropertyId::Health);
         int32 Defense = Runtime.Store->ReadEntity(E, PropertyId::Defense);
@@ -205,81 +287,68 @@ void FHktVMInterpreter::Op_ApplyDamage(FHktVMRuntime& Runtime, RegisterIndex Tar
 
 void FHktVMInterpreter::Op_ApplyEffect(FHktVMRuntime& Runtime, RegisterIndex Target, int32 StringIndex)
 {
-    EntityId E = Runtime.GetRegEntity(Target);
-    const FString& Effect = GetString(Runtime, StringIndex);
-    UE_LOG(LogTemp, Log, TEXT("[VM] ApplyEffect: Entity %u, Effect %s"), (int32)E, *Effect);
+    HKT_VM_TRACE_EVENT(ApplyEffect, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Target), StringIndex);
 }
 
 void FHktVMInterpreter::Op_RemoveEffect(FHktVMRuntime& Runtime, RegisterIndex Target, int32 StringIndex)
 {
-    EntityId E = Runtime.GetRegEntity(Target);
-    const FString& Effect = GetString(Runtime, StringIndex);
-    UE_LOG(LogTemp, Log, TEXT("[VM] RemoveEffect: Entity %u, Effect %s"), (int32)E, *Effect);
+    HKT_VM_TRACE_EVENT(RemoveEffect, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Target), StringIndex);
 }
 
 // Animation & VFX
 void FHktVMInterpreter::Op_PlayAnim(FHktVMRuntime& Runtime, RegisterIndex Entity, int32 StringIndex)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM] PlayAnim: Entity %u, Anim %s"), 
-        (int32)Runtime.GetRegEntity(Entity), *GetString(Runtime, StringIndex));
+    HKT_VM_TRACE_EVENT(PlayAnim, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Entity), StringIndex);
 }
 
 void FHktVMInterpreter::Op_PlayAnimMontage(FHktVMRuntime& Runtime, RegisterIndex Entity, int32 StringIndex)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM] PlayAnimMontage: Entity %u, Montage %s"), 
-        (int32)Runtime.GetRegEntity(Entity), *GetString(Runtime, StringIndex));
+    HKT_VM_TRACE_EVENT(PlayAnimMontage, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Entity), StringIndex);
 }
 
 void FHktVMInterpreter::Op_StopAnim(FHktVMRuntime& Runtime, RegisterIndex Entity)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM] StopAnim: Entity %u"), (int32)Runtime.GetRegEntity(Entity));
+    HKT_VM_TRACE_EVENT(StopAnim, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Entity), 0);
 }
 
 void FHktVMInterpreter::Op_PlayVFX(FHktVMRuntime& Runtime, RegisterIndex PosBase, int32 StringIndex)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM] PlayVFX: (%d,%d,%d), VFX %s"), 
-        Runtime.GetReg(PosBase), Runtime.GetReg(PosBase+1), Runtime.GetReg(PosBase+2),
-        *GetString(Runtime, StringIndex));
+    HKT_VM_TRACE_EVENT(PlayVFX, Runtime.SlotIndex, Runtime.GetReg(PosBase), StringIndex);
 }
 
 void FHktVMInterpreter::Op_PlayVFXAttached(FHktVMRuntime& Runtime, RegisterIndex Entity, int32 StringIndex)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM] PlayVFXAttached: Entity %u, VFX %s"), 
-        (int32)Runtime.GetRegEntity(Entity), *GetString(Runtime, StringIndex));
+    HKT_VM_TRACE_EVENT(PlayVFXAttached, Runtime.SlotIndex, (int32)Runtime.GetRegEntity(Entity), StringIndex);
 }
 
 // Audio
 void FHktVMInterpreter::Op_PlaySound(FHktVMRuntime& Runtime, int32 StringIndex)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM] PlaySound: %s"), *GetString(Runtime, StringIndex));
+    HKT_VM_TRACE_EVENT(PlaySound, Runtime.SlotIndex, 0, StringIndex);
 }
 
 void FHktVMInterpreter::Op_PlaySoundAtLocation(FHktVMRuntime& Runtime, RegisterIndex PosBase, int32 StringIndex)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM] PlaySoundAtLocation: (%d,%d,%d), Sound %s"), 
-        Runtime.GetReg(PosBase), Runtime.GetReg(PosBase+1), Runtime.GetReg(PosBase+2),
-        *GetString(Runtime, StringIndex));
+    HKT_VM_TRACE_EVENT(PlaySoundAtLocation, Runtime.SlotIndex, Runtime.GetReg(PosBase), StringIndex);
 }
 
 // Equipment
-void FHktVMInterpreter::Op_SpawnEquipment(FHktVMRuntime& Runtime, RegisterIndex Owner, int32 Slot, int32 StringIndex)
+EVMStatus FHktVMInterpreter::Op_SpawnEquipment(FHktVMRuntime& Runtime, RegisterIndex Owner, int32 Slot, int32 StringIndex)
 {
     EntityId OwnerEntity = Runtime.GetRegEntity(Owner);
-    const FString& EquipClass = GetString(Runtime, StringIndex);
+    HKT_VM_TRACE_EVENT(SpawnEquipment, Runtime.SlotIndex, (int32)OwnerEntity, Slot);
     
-    UE_LOG(LogTemp, Log, TEXT("[VM] SpawnEquipment: Owner %u, Slot %d, Class %s"), (int32)OwnerEntity, Slot, *EquipClass);
+    if (!Stash || !Runtime.Store)
+        return EVMStatus::Running;
     
-    if (Stash && Runtime.Store)
-    {
-        EntityId NewEquip = Stash->AllocateEntity();
-        Runtime.Store->WriteEntity(NewEquip, PropertyId::EntityType, HktEntityType::Equipment);
-        Runtime.Store->WriteEntity(NewEquip, PropertyId::OwnerEntity, OwnerEntity);
-        Runtime.SetRegEntity(Reg::Spawned, NewEquip);
-    }
+    Runtime.PendingSpawn.Owner = OwnerEntity;
+    Runtime.PendingSpawn.EntityType = HktEntityType::Equipment;
+    return EVMStatus::PendingSpawn;
 }
 
 // Utility
 void FHktVMInterpreter::Op_Log(FHktVMRuntime& Runtime, int32 StringIndex)
 {
-    UE_LOG(LogTemp, Log, TEXT("[VM Log] %s"), *GetString(Runtime, StringIndex));
+    HKT_VM_TRACE_EVENT(Log, Runtime.SlotIndex, 0, StringIndex);
+    UE_LOG(LogTemp, Verbose, TEXT("[VM Log] %s"), *GetString(Runtime, StringIndex));
 }
\ No newline at end of file
@@ -0,0 +1,368 @@
+#include "HktVMInterpreter.h"
+#include "HktVMProgram.h"
+
+// ============================================================================
+// 광역(SPMD) 실행
+//
+// 같은 Program/PC의 VM들을 한 명령어씩 함께 진행합니다.
+// Execute 동안 Stash는 읽기 전용(엔티티 생성/제거는 라운드 사이/종료 시 적용)이므로
+// 레인별 실행 순서가 바뀌어도 결과는 직렬 실행과 같습니다.
+// ============================================================================
+
+namespace
+{
+    enum class EWideOpKind : uint8
+    {
+        Register,   // 레지스터만 사용 - SOA로 레인 전체에 한 번에 적용
+        Branch,     // 분기 - 모든 레인이 같은 방향일 때만 계속
+        Lane,       // 레인별 실행 (자신의 Runtime/Store만 변경)
+        Stop,       // 레인별 실행 후 광역 실행 종료 (Halt/Yield/Wait/Spawn)
+        Barrier,    // 실행하지 않고 종료 (알 수 없는 명령어 - 직렬 실행에 맡김)
+    };
+
+    EWideOpKind ClassifyWide(EOpCode Op)
+    {
+        switch (Op)
+        {
+        case EOpCode::Nop:
+        case EOpCode::LoadConst:
+        case EOpCode::LoadConstHigh:
+        case EOpCode::LoadConstPool:
+        case EOpCode::Move:
+        case EOpCode::Add:
+        case EOpCode::Sub:
+        case EOpCode::Mul:
+        case EOpCode::Div:
+        case EOpCode::Mod:
+        case EOpCode::AddImm:
+        case EOpCode::AddImmWide:
+        case EOpCode::Vec3Add:
+        case EOpCode::Vec3Sub:
+        case EOpCode::Vec3Scale:
+        case EOpCode::CmpEq:
+        case EOpCode::CmpNe:
+        case EOpCode::CmpLt:
+        case EOpCode::CmpLe:
+        case EOpCode::CmpGt:
+        case EOpCode::CmpGe:
+            return EWideOpKind::Register;
+
+        case EOpCode::Jump:
+        case EOpCode::JumpIf:
+        case EOpCode::JumpIfNot:
+        case EOpCode::JumpIfEq:
+        case EOpCode::JumpIfNe:
+        case EOpCode::JumpIfLt:
+        case EOpCode::JumpIfLe:
+        case EOpCode::JumpIfGt:
+        case EOpCode::JumpIfGe:
+            return EWideOpKind::Branch;
+
+        case EOpCode::SaveStore:
+        case EOpCode::SaveStoreEntity:
+        case EOpCode::SaveStoreConst:
+        case EOpCode::SaveStoreEntityConst:
+        case EOpCode::LoadStore:
+        case EOpCode::LoadStoreEntity:
+        case EOpCode::GetPosition:
+        case EOpCode::GetDistance:
+        case EOpCode::SetPosition:
+        case EOpCode::MoveToward:
+        case EOpCode::MoveForward:
+        case EOpCode::StopMovement:
+        case EOpCode::Vec3DistSq:
+        case EOpCode::Vec3Toward:
+        case EOpCode::FindInRadius:
+        case EOpCode::FindNearest:
+        case EOpCode::NextFound:
+        case EOpCode::ApplyDamage:
+        case EOpCode::ApplyDamageConst:
+        case EOpCode::ApplyEffect:
+        case EOpCode::RemoveEffect:
+        case EOpCode::DestroyEntity:
+        case EOpCode::PlayAnim:
+        case EOpCode::PlayAnimMontage:
+        case EOpCode::StopAnim:
+        case EOpCode::PlayVFX:
+        case EOpCode::PlayVFXAttached:
+        case EOpCode::PlaySound:
+        case EOpCode::PlaySoundAtLocation:
+        case EOpCode::Log:
+            return EWideOpKind::Lane;
+
+        case EOpCode::Halt:
+        case EOpCode::Yield:
+        case EOpCode::YieldSeconds:
+        case EOpCode::WaitCollision:
+        case EOpCode::WaitMoveEnd:
+        case EOpCode::WaitAnimEnd:
+        case EOpCode::SpawnEntity:
+        case EOpCode::SpawnEquipment:
+            return EWideOpKind::Stop;
+
+        default:
+            return EWideOpKind::Barrier;
+        }
+    }
+
+    /** SOA 레지스터 파일: R[Reg][Lane] */
+    struct FWideRegisterFile
+    {
+        alignas(16) int32 R[MaxRegisters][FHktVMInterpreter::MaxWideLanes];
+    };
+
+    /** 레지스터 연산을 레인 전체에 적용 (단순 루프 - 컴파일러 자동 벡터화 대상) */
+    void ApplyRegisterOp(FWideRegisterFile& Regs, const FInstruction& Inst, const FHktVMProgram& Program, int32 NumLanes)
+    {
+        int32* D = Regs.R[Inst.Dst];
+        const int32* A = Regs.R[Inst.Src1];
+        const int32* B = Regs.R[Inst.Src2];
+
+        switch (Inst.GetOpCode())
+        {
+        case EOpCode::Nop:
+            break;
+        case EOpCode::LoadConst:
+        {
+            const int32 Value = Inst.GetSignedImm20();
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = Value;
+            break;
+        }
+        case EOpCode::LoadConstHigh:
+        {
+            const int32 High = static_cast<int32>(Inst.Imm12) << 20;
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = (D[L] & 0xFFFFF) | High;
+            break;
+        }
+        case EOpCode::LoadConstPool:
+        {
+            const int32 Value = Program.Constants[Inst.Imm20];
+            for (int32 L = 0; L < NumLanes; ++L) Regs.R[Inst._Dst][L] = Value;
+            break;
+        }
+        case EOpCode::Move:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L];
+            break;
+        case EOpCode::Add:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] + B[L];
+            break;
+        case EOpCode::Sub:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] - B[L];
+            break;
+        case EOpCode::Mul:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] * B[L];
+            break;
+        case EOpCode::Div:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = B[L] != 0 ? A[L] / B[L] : 0;
+            break;
+        case EOpCode::Mod:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = B[L] != 0 ? A[L] % B[L] : 0;
+            break;
+        case EOpCode::AddImm:
+        {
+            const int32 Imm = Inst.GetSignedImm12();
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] + Imm;
+            break;
+        }
+        case EOpCode::AddImmWide:
+        {
+            const int32 Imm = Inst.GetSignedImm20();
+            int32* R = Regs.R[Inst._Dst];
+            for (int32 L = 0; L < NumLanes; ++L) R[L] += Imm;
+            break;
+        }
+        // Vec3: 성분 순서대로 (레지스터가 겹쳐도 인터프리터와 동일)
+        case EOpCode::Vec3Add:
+            for (int32 i = 0; i < 3; ++i)
+            {
+                int32* Di = Regs.R[Inst.Dst + i];
+                const int32* Ai = Regs.R[Inst.Src1 + i];
+                const int32* Bi = Regs.R[Inst.Src2 + i];
+                for (int32 L = 0; L < NumLanes; ++L) Di[L] = Ai[L] + Bi[L];
+            }
+            break;
+        case EOpCode::Vec3Sub:
+            for (int32 i = 0; i < 3; ++i)
+            {
+                int32* Di = Regs.R[Inst.Dst + i];
+                const int32* Ai = Regs.R[Inst.Src1 + i];
+                const int32* Bi = Regs.R[Inst.Src2 + i];
+                for (int32 L = 0; L < NumLanes; ++L) Di[L] = Ai[L] - Bi[L];
+            }
+            break;
+        case EOpCode::Vec3Scale:
+            for (int32 i = 0; i < 3; ++i)
+            {
+                int32* Di = Regs.R[Inst.Dst + i];
+                const int32* Ai = Regs.R[Inst.Src1 + i];
+                for (int32 L = 0; L < NumLanes; ++L) Di[L] = Ai[L] * B[L];
+            }
+            break;
+        case EOpCode::CmpEq:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] == B[L] ? 1 : 0;
+            break;
+        case EOpCode::CmpNe:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] != B[L] ? 1 : 0;
+            break;
+        case EOpCode::CmpLt:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] < B[L] ? 1 : 0;
+            break;
+        case EOpCode::CmpLe:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] <= B[L] ? 1 : 0;
+            break;
+        case EOpCode::CmpGt:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] > B[L] ? 1 : 0;
+            break;
+        case EOpCode::CmpGe:
+            for (int32 L = 0; L < NumLanes; ++L) D[L] = A[L] >= B[L] ? 1 : 0;
+            break;
+        default:
+            checkNoEntry();
+            break;
+        }
+    }
+
+    /** 분기 조건이 참인 레인 수 */
+    int32 CountTakenLanes(const FWideRegisterFile& Regs, const FInstruction& Inst, int32 NumLanes)
+    {
+        const int32* A = Regs.R[Inst.Src1];
+        const int32* B = Regs.R[Inst.Src2];
+        int32 Taken = 0;
+
+        switch (Inst.GetOpCode())
+        {
+        case EOpCode::Jump:      return NumLanes;
+        case EOpCode::JumpIf:    for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] != 0; break;
+        case EOpCode::JumpIfNot: for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] == 0; break;
+        case EOpCode::JumpIfEq:  for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] == B[L]; break;
+        case EOpCode::JumpIfNe:  for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] != B[L]; break;
+        case EOpCode::JumpIfLt:  for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] < B[L]; break;
+        case EOpCode::JumpIfLe:  for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] <= B[L]; break;
+        case EOpCode::JumpIfGt:  for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] > B[L]; break;
+        case EOpCode::JumpIfGe:  for (int32 L = 0; L < NumLanes; ++L) Taken += A[L] >= B[L]; break;
+        default:
+            checkNoEntry();
+            break;
+        }
+        return Taken;
+    }
+}
+
+int32 FHktVMInterpreter::ExecuteWide(const TArray<FHktVMRuntime*>& Lanes, TArray<EVMStatus>& OutStatuses)
+{
+    const int32 NumLanes = Lanes.Num();
+    OutStatuses.Init(EVMStatus::Running, NumLanes);
+
+    if (NumLanes == 0 || !Lanes[0]->Program || !Lanes[0]->Program->bVerified)
+        return 0;
+
+    check(NumLanes <= MaxWideLanes);
+
+    const FInstruction* const Code = Lanes[0]->Program->Code.GetData();
+    int32 PC = Lanes[0]->PC;
+
+    // AoS → SOA
+    FWideRegisterFile Regs;
+    for (int32 L = 0; L < NumLanes; ++L)
+    {
+        checkSlow(Lanes[L]->Program == Lanes[0]->Program && Lanes[L]->PC == PC);
+        for (int32 R = 0; R < MaxRegisters; ++R)
+        {
+            Regs.R[R][L] = Lanes[L]->Registers[R];
+        }
+    }
+
+    // SOA에서만 갱신되어 Runtime.Registers에 아직 반영되지 않은 레지스터
+    uint16 Dirty = 0;
+
+    auto SyncToLanes = [&](uint16 Mask)
+    {
+        for (int32 R = 0; Mask != 0; ++R, Mask >>= 1)
+        {
+            if (Mask & 1)
+            {
+                for (int32 L = 0; L < NumLanes; ++L) Lanes[L]->Registers[R] = Regs.R[R][L];
+            }
+        }
+    };
+
+    auto SyncFromLanes = [&](uint16 Mask)
+    {
+        for (int32 R = 0; Mask != 0; ++R, Mask >>= 1)
+        {
+            if (Mask & 1)
+            {
+                for (int32 L = 0; L < NumLanes; ++L) Regs.R[R][L] = Lanes[L]->Registers[R];
+            }
+        }
+    };
+
+    int32 Executed = 0;
+    while (Executed < MaxInstructionsPerTick)
+    {
+        const FInstruction Inst = Code[PC];
+        const EWideOpKind Kind = ClassifyWide(Inst.GetOpCode());
+
+        if (Kind == EWideOpKind::Barrier)
+            break;
+
+        if (Kind == EWideOpKind::Branch)
+        {
+            const int32 Taken = CountTakenLanes(Regs, Inst, NumLanes);
+            if (Taken != 0 && Taken != NumLanes)
+                break;  // 레인별로 갈림 → 분기부터 직렬 실행
+
+            int32 Target = PC + 1;
+            if (Taken != 0)
+            {
+                Inst.GetBranchTarget(Target);
+            }
+            PC = Target;
+            ++Executed;
+            continue;
+        }
+
+        if (Kind == EWideOpKind::Register)
+        {
+            ApplyRegisterOp(Regs, Inst, *Lanes[0]->Program, NumLanes);
+            Dirty |= FRegisterUsage::Of(Inst).Writes;
+            ++PC;
+            ++Executed;
+            continue;
+        }
+
+        // Lane / Stop: 필요한 레지스터만 Runtime에 반영 후 레인별 실행
+        const FRegisterUsage Usage = FRegisterUsage::Of(Inst);
+        SyncToLanes(Usage.Reads & Dirty);
+        Dirty &= ~Usage.Reads;
+
+        bool bAnyStopped = false;
+        for (int32 L = 0; L < NumLanes; ++L)
+        {
+            Lanes[L]->PC = PC + 1;
+            OutStatuses[L] = ExecuteInstruction(*Lanes[L], Inst);
+            bAnyStopped |= OutStatuses[L] != EVMStatus::Running;
+        }
+
+        SyncFromLanes(Usage.Writes);
+        Dirty &= ~Usage.Writes;
+        ++PC;
+        ++Executed;
+
+        // 한 레인이라도 멈추면 (Yield/Wait/생성 대기/실패) 나머지는 직렬 실행에서 이어감
+        if (Kind == EWideOpKind::Stop || bAnyStopped)
+            break;
+    }
+
+    // SOA → AoS
+    SyncToLanes(Dirty);
+    for (int32 L = 0; L < NumLanes; ++L)
+    {
+        if (OutStatuses[L] == EVMStatus::Running)
+        {
+            Lanes[L]->PC = PC;
+        }
+    }
+
+    return Executed;
+}
@@ -0,0 +1,247 @@
+#include "HktVMNative.h"
+#include "HktVMInterpreter.h"
+#include "HktVMProgram.h"
+
+// ============================================================================
+// FHktVMNativeRegistry
+// ============================================================================
+
+FHktVMNativeRegistry& FHktVMNativeRegistry::Get()
+{
+    static FHktVMNativeRegistry Instance;
+    return Instance;
+}
+
+void FHktVMNativeRegistry::Register(FName TagName, uint32 CodeHash, FHktVMNativeFunc Func)
+{
+    FEntry& Entry = Entries.FindOrAdd(TagName);
+    Entry.CodeHash = CodeHash;
+    Entry.Func = Func;
+}
+
+FHktVMNativeFunc FHktVMNativeRegistry::Find(const FHktVMProgram& Program) const
+{
+#if HKT_VM_NATIVE
+    const FEntry* Entry = Entries.Find(Program.Tag.GetTagName());
+    if (!Entry)
+        return nullptr;
+
+    if (Entry->CodeHash != ComputeCodeHash(Program))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[VM Native] %s: bytecode changed since generation, using interpreter"), *Program.Tag.ToString());
+        return nullptr;
+    }
+    return Entry->Func;
+#else
+    return nullptr;
+#endif
+}
+
+uint32 FHktVMNativeRegistry::ComputeCodeHash(const FHktVMProgram& Program)
+{
+    const int32 NumInstructions = Program.CodeSize();
+    uint32 Hash = FCrc::MemCrc32(&NumInstructions, sizeof(NumInstructions));
+    Hash = FCrc::MemCrc32(Program.Code.GetData(), NumInstructions * sizeof(FInstruction), Hash);
+
+    // LoadConstPool은 상수 값을 코드에 직접 새기므로 상수 풀도 해시에 포함
+    return FCrc::MemCrc32(Program.Constants.GetData(), Program.Constants.Num() * sizeof(int32), Hash);
+}
+
+// ============================================================================
+// FHktVMTranspiler
+// ============================================================================
+
+namespace
+{
+    /** 인라인으로 번역하는 명령어 (레지스터/분기) - 나머지는 ExecuteNativeOp 호출 */
+    bool EmitInline(FString& Out, const FHktVMProgram& Program, int32 PC, const FInstruction& Inst)
+    {
+        const int32 Dst = Inst.Dst;
+        const int32 Src1 = Inst.Src1;
+        const int32 Src2 = Inst.Src2;
+
+        auto Binary = [&](const TCHAR* Op)
+        {
+            Out += FString::Printf(TEXT("    R[%d] = R[%d] %s R[%d];\n"), Dst, Src1, Op, Src2);
+        };
+        auto Compare = [&](const TCHAR* Op)
+        {
+            Out += FString::Printf(TEXT("    R[%d] = R[%d] %s R[%d] ? 1 : 0;\n"), Dst, Src1, Op, Src2);
+        };
+        auto BranchIf = [&](const TCHAR* Op)
+        {
+            Out += FString::Printf(TEXT("    if (R[%d] %s R[%d]) goto L%d;\n"), Src1, Op, Src2, static_cast<int32>(Inst.Imm12));
+        };
+        // 인터프리터와 같이 성분 순서대로 기록 (레지스터가 겹쳐도 동일)
+        auto Vector = [&](const TCHAR* Op, bool bScalar)
+        {
+            for (int32 k = 0; k < 3; ++k)
+            {
+                Out += FString::Printf(TEXT("    R[%d] = R[%d] %s R[%d];\n"), Dst + k, Src1 + k, Op, bScalar ? Src2 : Src2 + k);
+            }
+        };
+
+        switch (Inst.GetOpCode())
+        {
+        case EOpCode::Nop:
+            return true;
+        case EOpCode::Halt:
+            Out += FString::Printf(TEXT("    Runtime.PC = %d;\n    return EVMStatus::Completed;\n"), PC + 1);
+            return true;
+        case EOpCode::Jump:
+            Out += FString::Printf(TEXT("    goto L%d;\n"), static_cast<int32>(Inst.Imm20));
+            return true;
+        case EOpCode::JumpIf:
+            Out += FString::Printf(TEXT("    if (R[%d] != 0) goto L%d;\n"), Src1, static_cast<int32>(Inst.Imm12));
+            return true;
+        case EOpCode::JumpIfNot:
+            Out += FString::Printf(TEXT("    if (R[%d] == 0) goto L%d;\n"), Src1, static_cast<int32>(Inst.Imm12));
+            return true;
+        case EOpCode::LoadConst:
+            Out += FString::Printf(TEXT("    R[%d] = %d;\n"), static_cast<int32>(Inst._Dst), Inst.GetSignedImm20());
+            return true;
+        case EOpCode::LoadConstHigh:
+            Out += FString::Printf(TEXT("    R[%d] = (R[%d] & 0xFFFFF) | static_cast<int32>(0x%08Xu);\n"), Dst, Dst, static_cast<uint32>(Inst.Imm12) << 20);
+            return true;
+        case EOpCode::LoadConstPool:
+            Out += FString::Printf(TEXT("    R[%d] = %d;\n"), static_cast<int32>(Inst._Dst), Program.Constants[Inst.Imm20]);
+            return true;
+        case EOpCode::Move:
+            Out += FString::Printf(TEXT("    R[%d] = R[%d];\n"), Dst, Src1);
+            return true;
+        case EOpCode::Add:      Binary(TEXT("+")); return true;
+        case EOpCode::Sub:      Binary(TEXT("-")); return true;
+        case EOpCode::Mul:      Binary(TEXT("*")); return true;
+        case EOpCode::Div:
+        case EOpCode::Mod:
+            Out += FString::Printf(TEXT("    { const int32 D = R[%d]; R[%d] = D != 0 ? R[%d] %s D : 0; }\n"),
+                Src2, Dst, Src1, Inst.GetOpCode() == EOpCode::Div ? TEXT("/") : TEXT("%"));
+            return true;
+        case EOpCode::AddImm:
+            Out += FString::Printf(TEXT("    R[%d] = R[%d] + (%d);\n"), Dst, Src1, Inst.GetSignedImm12());
+            return true;
+        case EOpCode::AddImmWide:
+            Out += FString::Printf(TEXT("    R[%d] += %d;\n"), static_cast<int32>(Inst._Dst), Inst.GetSignedImm20());
+            return true;
+        case EOpCode::Vec3Add:   Vector(TEXT("+"), false); return true;
+        case EOpCode::Vec3Sub:   Vector(TEXT("-"), false); return true;
+        case EOpCode::Vec3Scale: Vector(TEXT("*"), true);  return true;
+        case EOpCode::CmpEq:    Compare(TEXT("==")); return true;
+        case EOpCode::CmpNe:    Compare(TEXT("!=")); return true;
+        case EOpCode::CmpLt:    Compare(TEXT("<"));  return true;
+        case EOpCode::CmpLe:    Compare(TEXT("<=")); return true;
+        case EOpCode::CmpGt:    Compare(TEXT(">"));  return true;
+        case EOpCode::CmpGe:    Compare(TEXT(">=")); return true;
+        case EOpCode::JumpIfEq: BranchIf(TEXT("==")); return true;
+        case EOpCode::JumpIfNe: BranchIf(TEXT("!=")); return true;
+        case EOpCode::JumpIfLt: BranchIf(TEXT("<"));  return true;
+        case EOpCode::JumpIfLe: BranchIf(TEXT("<=")); return true;
+        case EOpCode::JumpIfGt: BranchIf(TEXT(">"));  return true;
+        case EOpCode::JumpIfGe: BranchIf(TEXT(">=")); return true;
+        default:
+            return false;
+        }
+    }
+}
+
+FString FHktVMTranspiler::MakeFunctionName(const FHktVMProgram& Program)
+{
+    FString Name = Program.Tag.ToString();
+    for (int32 i = 0; i < Name.Len(); ++i)
+    {
+        if (!FChar::IsAlnum(Name[i]))
+        {
+            Name[i] = TEXT('_');
+        }
+    }
+    return TEXT("HktVMNative_") + Name;
+}
+
+bool FHktVMTranspiler::GenerateFunction(const FHktVMProgram& Program, FString& OutCode)
+{
+    if (!Program.bVerified)
+        return false;
+
+    const int32 CodeSize = Program.CodeSize();
+    const uint32 CodeHash = FHktVMNativeRegistry::ComputeCodeHash(Program);
+    const FString FuncName = MakeFunctionName(Program);
+    const FString TagName = Program.Tag.ToString();
+
+    FString& Out = OutCode;
+    Out += FString::Printf(TEXT("// %s - %d instructions, CodeHash 0x%08X\n"), *TagName, CodeSize, CodeHash);
+    Out += FString::Printf(TEXT("EVMStatus %s(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, int32& Budget)\n{\n"), *FuncName);
+    Out += TEXT("    int32* const R = Runtime.Registers;\n\n");
+
+    // 재개 지점: 인터프리터는 어떤 PC에서든 멈출 수 있으므로 (명령어 한도) 모든 PC가 진입점
+    Out += TEXT("    switch (Runtime.PC)\n    {\n");
+    for (int32 PC = 0; PC < CodeSize; ++PC)
+    {
+        Out += FString::Printf(TEXT("    case %d: goto L%d;\n"), PC, PC);
+    }
+    Out += TEXT("    default: return EVMStatus::Failed;\n    }\n\n");
+
+    for (int32 PC = 0; PC < CodeSize; ++PC)
+    {
+        const FInstruction& Inst = Program.Code[PC];
+
+        Out += FString::Printf(TEXT("L%d: // %s\n"), PC, FHktVMInterpreter::GetOpName(Inst.GetOpCode()));
+        Out += FString::Printf(TEXT("    if (Budget-- <= 0) { Runtime.PC = %d; return EVMStatus::Yielded; }\n"), PC);
+
+        if (EmitInline(Out, Program, PC, Inst))
+            continue;
+
+        if (FHktVMInterpreter::IsStopOp(Inst.GetOpCode()))
+        {
+            // 멈추는 명령어: 인터프리터처럼 다음 PC를 남긴 뒤 실행
+            Out += FString::Printf(TEXT("    Runtime.PC = %d;\n"), PC + 1);
+            Out += FString::Printf(TEXT("    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x%08Xu)); S != EVMStatus::Running) return S;\n"), Inst.Raw);
+        }
+        else
+        {
+            Out += FString::Printf(TEXT("    VM.ExecuteNativeOp(Runtime, FInstruction(0x%08Xu));\n"), Inst.Raw);
+        }
+    }
+
+    // 마지막 명령어가 fall-through면 인터프리터처럼 코드 끝에서 실패
+    if (CodeSize > 0 && Program.Code[CodeSize - 1].FallsThrough())
+    {
+        Out += FString::Printf(TEXT("    Runtime.PC = %d;\n    return EVMStatus::Failed;\n"), CodeSize);
+    }
+    Out += TEXT("}\n\n");
+    Out += FString::Printf(TEXT("FHktVMNativeAutoRegister G%s(TEXT(\"%s\"), 0x%08Xu, &%s);\n\n"), *FuncName, *TagName, CodeHash, *FuncName);
+    return true;
+}
+
+FString FHktVMTranspiler::GenerateSource(const TArray<const FHktVMProgram*>& Programs)
+{
+    TArray<const FHktVMProgram*> Sorted;
+    for (const FHktVMProgram* Program : Programs)
+    {
+        if (Program && Program->bVerified)
+        {
+            Sorted.Add(Program);
+        }
+    }
+    Sorted.Sort([](const FHktVMProgram& A, const FHktVMProgram& B)
+    {
+        return A.Tag.ToString() < B.Tag.ToString();
+    });
+
+    FString Out;
+    Out += TEXT("// 자동 생성 파일 - 직접 수정하지 마세요.\n");
+    Out += TEXT("// FHktVMTranspiler::GenerateSource로 생성 (콘솔: hkt.VM.GenerateNative <파일>)\n");
+    Out += TEXT("// Flow 바이트코드가 바뀌면 CodeHash가 맞지 않아 해당 Flow는 인터프리터로 실행됩니다.\n\n");
+    Out += TEXT("#include \"HktVMNative.h\"\n");
+    Out += TEXT("#include \"HktVMInterpreter.h\"\n\n");
+    Out += TEXT("#if HKT_VM_NATIVE\n\n");
+    Out += TEXT("namespace\n{\n\n");
+
+    for (const FHktVMProgram* Program : Sorted)
+    {
+        GenerateFunction(*Program, Out);
+    }
+
+    Out += TEXT("} // namespace\n\n");
+    Out += TEXT("#endif // HKT_VM_NATIVE\n");
+    return Out;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktVMTypes.h"
+
+// Forward declarations
+class FHktVMInterpreter;
+struct FHktVMRuntime;
+struct FHktVMProgram;
+
+/**
+ * HKT_VM_NATIVE - AOT 네이티브 Flow 컴파일 스위치
+ *
+ * 0이면 생성된 코드가 빌드에서 빠지고 모든 Flow가 인터프리터로 실행됩니다.
+ */
+#ifndef HKT_VM_NATIVE
+#define HKT_VM_NATIVE 1
+#endif
+
+/**
+ * 네이티브 Flow 진입점 - FHktVMInterpreter::Execute와 같은 계약
+ *
+ * Runtime.PC에서 재개하여 yield/완료/실패/생성 대기까지 실행하고,
+ * 멈출 때 Runtime.PC를 인터프리터와 같은 위치에 남깁니다.
+ */
+using FHktVMNativeFunc = EVMStatus (*)(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, int32& Budget);
+
+// ============================================================================
+// FHktVMNativeRegistry - Tag → 네이티브 함수
+// ============================================================================
+
+/**
+ * 생성된 코드는 정적 초기화 시 (Tag, CodeHash, 함수)를 등록합니다.
+ * FHktVMProgramRegistry::RegisterProgram이 검증된 프로그램의 바이트코드 해시와
+ * 비교해 일치할 때만 FHktVMProgram::NativeEntry를 연결하므로,
+ * Flow 정의가 바뀌고 다시 생성하지 않은 경우에는 인터프리터로 실행됩니다.
+ */
+class FHktVMNativeRegistry
+{
+public:
+    static FHktVMNativeRegistry& Get();
+
+    void Register(FName TagName, uint32 CodeHash, FHktVMNativeFunc Func);
+
+    /** Program의 Tag/바이트코드와 일치하는 네이티브 함수 (없으면 nullptr) */
+    FHktVMNativeFunc Find(const FHktVMProgram& Program) const;
+
+    /** 바이트코드 해시 (명령어 수 + 명령어 원시값) */
+    static uint32 ComputeCodeHash(const FHktVMProgram& Program);
+
+private:
+    struct FEntry
+    {
+        uint32 CodeHash = 0;
+        FHktVMNativeFunc Func = nullptr;
+    };
+
+    TMap<FName, FEntry> Entries;
+};
+
+/** 생성된 파일에서 사용하는 정적 등록 헬퍼 */
+struct FHktVMNativeAutoRegister
+{
+    FHktVMNativeAutoRegister(const TCHAR* TagName, uint32 CodeHash, FHktVMNativeFunc Func)
+    {
+        FHktVMNativeRegistry::Get().Register(FName(TagName), CodeHash, Func);
+    }
+};
+
+// ============================================================================
+// FHktVMTranspiler - 바이트코드 → C++
+// ============================================================================
+
+/**
+ * 검증된 FHktVMProgram을 FHktVMNativeFunc 형태의 C++ 함수로 변환합니다.
+ *
+ * - 명령어마다 레이블을 두고 진입 시 switch(Runtime.PC)로 재개 지점으로 점프
+ * - 레지스터 연산/비교/분기는 Runtime.Registers에 직접 인라인
+ * - 그 외 명령어는 FHktVMInterpreter::ExecuteNativeOp로 같은 핸들러를 호출
+ * - 명령어마다 Budget을 차감 (인터프리터와 같은 틱에 yield)
+ *
+ * 생성 결과는 HktVMNativeGenerated.cpp로 저장해 모듈에 함께 빌드합니다 (hkt.VM.GenerateNative).
+ */
+class FHktVMTranspiler
+{
+public:
+    /** 프로그램 하나를 함수 정의 + 등록 코드로 변환 (검증되지 않은 프로그램이면 false) */
+    static bool GenerateFunction(const FHktVMProgram& Program, FString& OutCode);
+
+    /** 등록된 모든 검증된 프로그램으로 HktVMNativeGenerated.cpp 전체 내용 생성 (Tag 이름 순) */
+    static FString GenerateSource(const TArray<const FHktVMProgram*>& Programs);
+
+    /** Tag → C++ 식별자 (Ability.Skill.Fireball → HktVMNative_Ability_Skill_Fireball) */
+    static FString MakeFunctionName(const FHktVMProgram& Program);
+};
@@ -0,0 +1,445 @@
+// 자동 생성 파일 - 직접 수정하지 마세요.
+// FHktVMTranspiler::GenerateSource로 생성 (콘솔: hkt.VM.GenerateNative <파일>)
+// Flow 바이트코드가 바뀌면 CodeHash가 맞지 않아 해당 Flow는 인터프리터로 실행됩니다.
+
+#include "HktVMNative.h"
+#include "HktVMInterpreter.h"
+
+#if HKT_VM_NATIVE
+
+namespace
+{
+
+// Ability.Attack.Basic - 10 instructions, CodeHash 0x2226CDF9
+EVMStatus HktVMNative_Ability_Attack_Basic(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, int32& Budget)
+{
+    int32* const R = Runtime.Registers;
+
+    switch (Runtime.PC)
+    {
+    case 0: goto L0;
+    case 1: goto L1;
+    case 2: goto L2;
+    case 3: goto L3;
+    case 4: goto L4;
+    case 5: goto L5;
+    case 6: goto L6;
+    case 7: goto L7;
+    case 8: goto L8;
+    case 9: goto L9;
+    default: return EVMStatus::Failed;
+    }
+
+L0: // Log
+    if (Budget-- <= 0) { Runtime.PC = 0; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000003Au));
+L1: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 1; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x02100B0Du));
+L2: // PlayAnimMontage
+    if (Budget-- <= 0) { Runtime.PC = 2; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0010A033u));
+L3: // WaitAnimEnd
+    if (Budget-- <= 0) { Runtime.PC = 3; return EVMStatus::Yielded; }
+    Runtime.PC = 4;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x0000A009u)); S != EVMStatus::Running) return S;
+L4: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 4; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00C0000Du));
+L5: // ApplyDamage
+    if (Budget-- <= 0) { Runtime.PC = 5; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000B02Fu));
+L6: // PlayVFXAttached
+    if (Budget-- <= 0) { Runtime.PC = 6; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0020B036u));
+L7: // PlaySound
+    if (Budget-- <= 0) { Runtime.PC = 7; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00003037u));
+L8: // Log
+    if (Budget-- <= 0) { Runtime.PC = 8; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000403Au));
+L9: // Halt
+    if (Budget-- <= 0) { Runtime.PC = 9; return EVMStatus::Yielded; }
+    Runtime.PC = 10;
+    return EVMStatus::Completed;
+}
+
+FHktVMNativeAutoRegister GHktVMNative_Ability_Attack_Basic(TEXT("Ability.Attack.Basic"), 0x2226CDF9u, &HktVMNative_Ability_Attack_Basic);
+
+// Ability.Skill.Fireball - 28 instructions, CodeHash 0xB71F4498
+EVMStatus HktVMNative_Ability_Skill_Fireball(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, int32& Budget)
+{
+    int32* const R = Runtime.Registers;
+
+    switch (Runtime.PC)
+    {
+    case 0: goto L0;
+    case 1: goto L1;
+    case 2: goto L2;
+    case 3: goto L3;
+    case 4: goto L4;
+    case 5: goto L5;
+    case 6: goto L6;
+    case 7: goto L7;
+    case 8: goto L8;
+    case 9: goto L9;
+    case 10: goto L10;
+    case 11: goto L11;
+    case 12: goto L12;
+    case 13: goto L13;
+    case 14: goto L14;
+    case 15: goto L15;
+    case 16: goto L16;
+    case 17: goto L17;
+    case 18: goto L18;
+    case 19: goto L19;
+    case 20: goto L20;
+    case 21: goto L21;
+    case 22: goto L22;
+    case 23: goto L23;
+    case 24: goto L24;
+    case 25: goto L25;
+    case 26: goto L26;
+    case 27: goto L27;
+    default: return EVMStatus::Failed;
+    }
+
+L0: // Log
+    if (Budget-- <= 0) { Runtime.PC = 0; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000003Au));
+L1: // PlayAnim
+    if (Budget-- <= 0) { Runtime.PC = 1; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0010A032u));
+L2: // YieldSeconds
+    if (Budget-- <= 0) { Runtime.PC = 2; return EVMStatus::Yielded; }
+    Runtime.PC = 3;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x00064003u)); S != EVMStatus::Running) return S;
+L3: // Log
+    if (Budget-- <= 0) { Runtime.PC = 3; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000203Au));
+L4: // SpawnEntity
+    if (Budget-- <= 0) { Runtime.PC = 4; return EVMStatus::Yielded; }
+    Runtime.PC = 5;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x00003C1Fu)); S != EVMStatus::Running) return S;
+L5: // GetPosition
+    if (Budget-- <= 0) { Runtime.PC = 5; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000A021u));
+L6: // SetPosition
+    if (Budget-- <= 0) { Runtime.PC = 6; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00000C22u));
+L7: // MoveForward
+    if (Budget-- <= 0) { Runtime.PC = 7; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x1F40C025u));
+L8: // PlaySound
+    if (Budget-- <= 0) { Runtime.PC = 8; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00004037u));
+L9: // Log
+    if (Budget-- <= 0) { Runtime.PC = 9; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000503Au));
+L10: // WaitCollision
+    if (Budget-- <= 0) { Runtime.PC = 10; return EVMStatus::Yielded; }
+    Runtime.PC = 11;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x0000CD07u)); S != EVMStatus::Running) return S;
+L11: // Log
+    if (Budget-- <= 0) { Runtime.PC = 11; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000603Au));
+L12: // GetPosition
+    if (Budget-- <= 0) { Runtime.PC = 12; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000C321u));
+L13: // DestroyEntity
+    if (Budget-- <= 0) { Runtime.PC = 13; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000C020u));
+L14: // ApplyDamageConst
+    if (Budget-- <= 0) { Runtime.PC = 14; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0640D03Du));
+L15: // PlayVFXAttached
+    if (Budget-- <= 0) { Runtime.PC = 15; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0070D036u));
+L16: // PlayVFX
+    if (Budget-- <= 0) { Runtime.PC = 16; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00803035u));
+L17: // PlaySoundAtLocation
+    if (Budget-- <= 0) { Runtime.PC = 17; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00903038u));
+L18: // Log
+    if (Budget-- <= 0) { Runtime.PC = 18; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000A03Au));
+L19: // FindInRadius
+    if (Budget-- <= 0) { Runtime.PC = 19; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x12C0DF2Cu));
+L20: // NextFound
+    if (Budget-- <= 0) { Runtime.PC = 20; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00000E2Eu));
+L21: // JumpIfNot
+    if (Budget-- <= 0) { Runtime.PC = 21; return EVMStatus::Yielded; }
+    if (R[15] == 0) goto L26;
+L22: // Move
+    if (Budget-- <= 0) { Runtime.PC = 22; return EVMStatus::Yielded; }
+    R[11] = R[14];
+L23: // ApplyDamageConst
+    if (Budget-- <= 0) { Runtime.PC = 23; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0320B03Du));
+L24: // ApplyEffect
+    if (Budget-- <= 0) { Runtime.PC = 24; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00B0B030u));
+L25: // Jump
+    if (Budget-- <= 0) { Runtime.PC = 25; return EVMStatus::Yielded; }
+    goto L20;
+L26: // Log
+    if (Budget-- <= 0) { Runtime.PC = 26; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000C03Au));
+L27: // Halt
+    if (Budget-- <= 0) { Runtime.PC = 27; return EVMStatus::Yielded; }
+    Runtime.PC = 28;
+    return EVMStatus::Completed;
+}
+
+FHktVMNativeAutoRegister GHktVMNative_Ability_Skill_Fireball(TEXT("Ability.Skill.Fireball"), 0xB71F4498u, &HktVMNative_Ability_Skill_Fireball);
+
+// Ability.Skill.Heal - 17 instructions, CodeHash 0xBB710FC9
+EVMStatus HktVMNative_Ability_Skill_Heal(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, int32& Budget)
+{
+    int32* const R = Runtime.Registers;
+
+    switch (Runtime.PC)
+    {
+    case 0: goto L0;
+    case 1: goto L1;
+    case 2: goto L2;
+    case 3: goto L3;
+    case 4: goto L4;
+    case 5: goto L5;
+    case 6: goto L6;
+    case 7: goto L7;
+    case 8: goto L8;
+    case 9: goto L9;
+    case 10: goto L10;
+    case 11: goto L11;
+    case 12: goto L12;
+    case 13: goto L13;
+    case 14: goto L14;
+    case 15: goto L15;
+    case 16: goto L16;
+    default: return EVMStatus::Failed;
+    }
+
+L0: // Log
+    if (Budget-- <= 0) { Runtime.PC = 0; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000003Au));
+L1: // PlayAnim
+    if (Budget-- <= 0) { Runtime.PC = 1; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0010A032u));
+L2: // PlayVFXAttached
+    if (Budget-- <= 0) { Runtime.PC = 2; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0020A036u));
+L3: // YieldSeconds
+    if (Budget-- <= 0) { Runtime.PC = 3; return EVMStatus::Yielded; }
+    Runtime.PC = 4;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x00050003u)); S != EVMStatus::Running) return S;
+L4: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 4; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00A0000Du));
+L5: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 5; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00B0010Du));
+L6: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 6; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0210020Du));
+L7: // JumpIfNe
+    if (Budget-- <= 0) { Runtime.PC = 7; return EVMStatus::Yielded; }
+    if (R[2] != R[3]) goto L9;
+L8: // LoadConst
+    if (Budget-- <= 0) { Runtime.PC = 8; return EVMStatus::Yielded; }
+    R[2] = 50;
+L9: // Add
+    if (Budget-- <= 0) { Runtime.PC = 9; return EVMStatus::Yielded; }
+    R[0] = R[0] + R[2];
+L10: // JumpIfLe
+    if (Budget-- <= 0) { Runtime.PC = 10; return EVMStatus::Yielded; }
+    if (R[0] <= R[1]) goto L12;
+L11: // Move
+    if (Budget-- <= 0) { Runtime.PC = 11; return EVMStatus::Yielded; }
+    R[0] = R[1];
+L12: // SaveStore
+    if (Budget-- <= 0) { Runtime.PC = 12; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00A0000Fu));
+L13: // PlayVFXAttached
+    if (Budget-- <= 0) { Runtime.PC = 13; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0030A036u));
+L14: // PlaySound
+    if (Budget-- <= 0) { Runtime.PC = 14; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00004037u));
+L15: // Log
+    if (Budget-- <= 0) { Runtime.PC = 15; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000503Au));
+L16: // Halt
+    if (Budget-- <= 0) { Runtime.PC = 16; return EVMStatus::Yielded; }
+    Runtime.PC = 17;
+    return EVMStatus::Completed;
+}
+
+FHktVMNativeAutoRegister GHktVMNative_Ability_Skill_Heal(TEXT("Ability.Skill.Heal"), 0xBB710FC9u, &HktVMNative_Ability_Skill_Heal);
+
+// Action.Move.ToLocation - 11 instructions, CodeHash 0x70DD31C8
+EVMStatus HktVMNative_Action_Move_ToLocation(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, int32& Budget)
+{
+    int32* const R = Runtime.Registers;
+
+    switch (Runtime.PC)
+    {
+    case 0: goto L0;
+    case 1: goto L1;
+    case 2: goto L2;
+    case 3: goto L3;
+    case 4: goto L4;
+    case 5: goto L5;
+    case 6: goto L6;
+    case 7: goto L7;
+    case 8: goto L8;
+    case 9: goto L9;
+    case 10: goto L10;
+    default: return EVMStatus::Failed;
+    }
+
+L0: // Log
+    if (Budget-- <= 0) { Runtime.PC = 0; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000003Au));
+L1: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 1; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x01E0000Du));
+L2: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 2; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x01F0010Du));
+L3: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 3; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0200020Du));
+L4: // PlayAnim
+    if (Budget-- <= 0) { Runtime.PC = 4; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0010A032u));
+L5: // MoveToward
+    if (Budget-- <= 0) { Runtime.PC = 5; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x12C00A24u));
+L6: // WaitMoveEnd
+    if (Budget-- <= 0) { Runtime.PC = 6; return EVMStatus::Yielded; }
+    Runtime.PC = 7;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x0000A008u)); S != EVMStatus::Running) return S;
+L7: // StopMovement
+    if (Budget-- <= 0) { Runtime.PC = 7; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000A026u));
+L8: // PlayAnim
+    if (Budget-- <= 0) { Runtime.PC = 8; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0020A032u));
+L9: // Log
+    if (Budget-- <= 0) { Runtime.PC = 9; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000303Au));
+L10: // Halt
+    if (Budget-- <= 0) { Runtime.PC = 10; return EVMStatus::Yielded; }
+    Runtime.PC = 11;
+    return EVMStatus::Completed;
+}
+
+FHktVMNativeAutoRegister GHktVMNative_Action_Move_ToLocation(TEXT("Action.Move.ToLocation"), 0x70DD31C8u, &HktVMNative_Action_Move_ToLocation);
+
+// Event.Character.Spawn - 20 instructions, CodeHash 0x298DED58
+EVMStatus HktVMNative_Event_Character_Spawn(FHktVMInterpreter& VM, FHktVMRuntime& Runtime, int32& Budget)
+{
+    int32* const R = Runtime.Registers;
+
+    switch (Runtime.PC)
+    {
+    case 0: goto L0;
+    case 1: goto L1;
+    case 2: goto L2;
+    case 3: goto L3;
+    case 4: goto L4;
+    case 5: goto L5;
+    case 6: goto L6;
+    case 7: goto L7;
+    case 8: goto L8;
+    case 9: goto L9;
+    case 10: goto L10;
+    case 11: goto L11;
+    case 12: goto L12;
+    case 13: goto L13;
+    case 14: goto L14;
+    case 15: goto L15;
+    case 16: goto L16;
+    case 17: goto L17;
+    case 18: goto L18;
+    case 19: goto L19;
+    default: return EVMStatus::Failed;
+    }
+
+L0: // Log
+    if (Budget-- <= 0) { Runtime.PC = 0; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000003Au));
+L1: // SpawnEntity
+    if (Budget-- <= 0) { Runtime.PC = 1; return EVMStatus::Yielded; }
+    Runtime.PC = 2;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x00001C1Fu)); S != EVMStatus::Running) return S;
+L2: // Move
+    if (Budget-- <= 0) { Runtime.PC = 2; return EVMStatus::Yielded; }
+    R[10] = R[12];
+L3: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 3; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x01E0000Du));
+L4: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 4; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x01F0010Du));
+L5: // LoadStore
+    if (Budget-- <= 0) { Runtime.PC = 5; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0200020Du));
+L6: // SetPosition
+    if (Budget-- <= 0) { Runtime.PC = 6; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00000A22u));
+L7: // PlayVFXAttached
+    if (Budget-- <= 0) { Runtime.PC = 7; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0020A036u));
+L8: // PlaySound
+    if (Budget-- <= 0) { Runtime.PC = 8; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00003037u));
+L9: // PlayAnim
+    if (Budget-- <= 0) { Runtime.PC = 9; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0040A032u));
+L10: // YieldSeconds
+    if (Budget-- <= 0) { Runtime.PC = 10; return EVMStatus::Yielded; }
+    Runtime.PC = 11;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x00032003u)); S != EVMStatus::Running) return S;
+L11: // Log
+    if (Budget-- <= 0) { Runtime.PC = 11; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000503Au));
+L12: // SpawnEquipment
+    if (Budget-- <= 0) { Runtime.PC = 12; return EVMStatus::Yielded; }
+    Runtime.PC = 13;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x0060AC39u)); S != EVMStatus::Running) return S;
+L13: // PlayVFXAttached
+    if (Budget-- <= 0) { Runtime.PC = 13; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0070C036u));
+L14: // SpawnEquipment
+    if (Budget-- <= 0) { Runtime.PC = 14; return EVMStatus::Yielded; }
+    Runtime.PC = 15;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x0081AC39u)); S != EVMStatus::Running) return S;
+L15: // PlayAnimMontage
+    if (Budget-- <= 0) { Runtime.PC = 15; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0090A033u));
+L16: // WaitAnimEnd
+    if (Budget-- <= 0) { Runtime.PC = 16; return EVMStatus::Yielded; }
+    Runtime.PC = 17;
+    if (const EVMStatus S = VM.ExecuteNativeOp(Runtime, FInstruction(0x0000A009u)); S != EVMStatus::Running) return S;
+L17: // PlayAnim
+    if (Budget-- <= 0) { Runtime.PC = 17; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x00A0A032u));
+L18: // Log
+    if (Budget-- <= 0) { Runtime.PC = 18; return EVMStatus::Yielded; }
+    VM.ExecuteNativeOp(Runtime, FInstruction(0x0000B03Au));
+L19: // Halt
+    if (Budget-- <= 0) { Runtime.PC = 19; return EVMStatus::Yielded; }
+    Runtime.PC = 20;
+    return EVMStatus::Completed;
+}
+
+FHktVMNativeAutoRegister GHktVMNative_Event_Character_Spawn(TEXT("Event.Character.Spawn"), 0x298DED58u, &HktVMNative_Event_Character_Spawn);
+
+} // namespace
+
+#endif // HKT_VM_NATIVE
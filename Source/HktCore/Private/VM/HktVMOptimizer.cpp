@@ -0,0 +1,562 @@
+#include "HktVMOptimizer.h"
+#include "HktVMProgram.h"
+
+namespace
+{
+    constexpr int32 MaxOptimizePasses = 4;
+
+    FORCEINLINE bool FitsImm12(int64 Value) { return Value >= -2048 && Value <= 2047; }
+    FORCEINLINE bool FitsImm20(int64 Value) { return Value >= -524288 && Value <= 524287; }
+
+    /** 상수 저장 포맷에 담을 수 있는 PropertyId (8비트) */
+    FORCEINLINE bool FitsPackedProperty(uint32 PropertyId) { return PropertyId <= 0xFF; }
+
+    /** CmpXX → 대응하는 JumpIfXX (bNegate: JumpIfNot과 융합할 때) */
+    EOpCode CompareToJump(EOpCode Cmp, bool bNegate)
+    {
+        switch (Cmp)
+        {
+        case EOpCode::CmpEq: return bNegate ? EOpCode::JumpIfNe : EOpCode::JumpIfEq;
+        case EOpCode::CmpNe: return bNegate ? EOpCode::JumpIfEq : EOpCode::JumpIfNe;
+        case EOpCode::CmpLt: return bNegate ? EOpCode::JumpIfGe : EOpCode::JumpIfLt;
+        case EOpCode::CmpLe: return bNegate ? EOpCode::JumpIfGt : EOpCode::JumpIfLe;
+        case EOpCode::CmpGt: return bNegate ? EOpCode::JumpIfLe : EOpCode::JumpIfGt;
+        case EOpCode::CmpGe: return bNegate ? EOpCode::JumpIfLt : EOpCode::JumpIfGe;
+        default:             return EOpCode::Max;
+        }
+    }
+
+    /** 두 피연산자 연산의 결과 계산 (인터프리터와 동일한 의미). 폴딩 불가 시 false */
+    bool EvaluateBinary(EOpCode Op, int32 A, int32 B, int32& OutResult)
+    {
+        switch (Op)
+        {
+        case EOpCode::Add:   OutResult = static_cast<int32>(static_cast<uint32>(A) + static_cast<uint32>(B)); return true;
+        case EOpCode::Sub:   OutResult = static_cast<int32>(static_cast<uint32>(A) - static_cast<uint32>(B)); return true;
+        case EOpCode::Mul:   OutResult = static_cast<int32>(static_cast<uint32>(A) * static_cast<uint32>(B)); return true;
+        case EOpCode::Div:
+        case EOpCode::Mod:
+            if (B == -1 && A == INT32_MIN)
+                return false;
+            OutResult = B != 0 ? (Op == EOpCode::Div ? A / B : A % B) : 0;
+            return true;
+        case EOpCode::CmpEq: case EOpCode::JumpIfEq: OutResult = A == B ? 1 : 0; return true;
+        case EOpCode::CmpNe: case EOpCode::JumpIfNe: OutResult = A != B ? 1 : 0; return true;
+        case EOpCode::CmpLt: case EOpCode::JumpIfLt: OutResult = A < B ? 1 : 0; return true;
+        case EOpCode::CmpLe: case EOpCode::JumpIfLe: OutResult = A <= B ? 1 : 0; return true;
+        case EOpCode::CmpGt: case EOpCode::JumpIfGt: OutResult = A > B ? 1 : 0; return true;
+        case EOpCode::CmpGe: case EOpCode::JumpIfGe: OutResult = A >= B ? 1 : 0; return true;
+        default:
+            return false;
+        }
+    }
+}
+
+// ============================================================================
+// Entry
+// ============================================================================
+
+int32 FHktVMOptimizer::Optimize(FHktVMProgram& Program)
+{
+    const int32 OriginalSize = Program.Code.Num();
+    FHktVMOptimizer Optimizer(Program);
+
+    for (int32 Pass = 0; Pass < MaxOptimizePasses; ++Pass)
+    {
+        Optimizer.AnalyzeControlFlow();
+        bool bChanged = Optimizer.FoldConstants();
+
+        Optimizer.ComputeLiveness();
+        bChanged |= Optimizer.FuseSuperinstructions();
+        bChanged |= Optimizer.FuseVectorOps();
+
+        Optimizer.ComputeLiveness();
+        bChanged |= Optimizer.RemoveDeadCode();
+
+        Optimizer.Compact();
+
+        if (!bChanged)
+            break;
+    }
+
+    return OriginalSize - Program.Code.Num();
+}
+
+FHktVMOptimizer::FHktVMOptimizer(FHktVMProgram& InProgram)
+    : Program(InProgram)
+{
+}
+
+// ============================================================================
+// Control Flow Helpers
+// ============================================================================
+
+bool FHktVMOptimizer::IsPure(const FInstruction& Inst)
+{
+    switch (Inst.GetOpCode())
+    {
+    case EOpCode::LoadConst:
+    case EOpCode::LoadConstHigh:
+    case EOpCode::LoadConstPool:
+    case EOpCode::LoadStore:
+    case EOpCode::LoadStoreEntity:
+    case EOpCode::Move:
+    case EOpCode::Add:
+    case EOpCode::Sub:
+    case EOpCode::Mul:
+    case EOpCode::Div:
+    case EOpCode::Mod:
+    case EOpCode::AddImm:
+    case EOpCode::AddImmWide:
+    case EOpCode::CmpEq:
+    case EOpCode::CmpNe:
+    case EOpCode::CmpLt:
+    case EOpCode::CmpLe:
+    case EOpCode::CmpGt:
+    case EOpCode::CmpGe:
+    case EOpCode::Vec3Add:
+    case EOpCode::Vec3Sub:
+    case EOpCode::Vec3Scale:
+    case EOpCode::Vec3DistSq:
+    case EOpCode::Vec3Toward:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void FHktVMOptimizer::AnalyzeControlFlow()
+{
+    const TArray<FInstruction>& Code = Program.Code;
+    JumpTargets.Init(false, Code.Num() + 1);
+
+    for (const FInstruction& Inst : Code)
+    {
+        int32 Target;
+        if (Inst.GetBranchTarget(Target) && Target >= 0 && Target <= Code.Num())
+        {
+            JumpTargets[Target] = true;
+        }
+    }
+}
+
+void FHktVMOptimizer::ComputeLiveness()
+{
+    const TArray<FInstruction>& Code = Program.Code;
+    const int32 Num = Code.Num();
+
+    TArray<uint16> LiveIn;
+    LiveIn.Init(0, Num);
+    LiveOut.Init(0, Num);
+
+    // 역방향 데이터플로우 (루프가 있으므로 고정점까지 반복)
+    bool bChanged = true;
+    while (bChanged)
+    {
+        bChanged = false;
+        for (int32 i = Num - 1; i >= 0; --i)
+        {
+            const FInstruction& Inst = Code[i];
+
+            uint16 Out = 0;
+            if (Inst.FallsThrough() && i + 1 < Num)
+            {
+                Out |= LiveIn[i + 1];
+            }
+            int32 Target;
+            if (Inst.GetBranchTarget(Target) && Target >= 0 && Target < Num)
+            {
+                Out |= LiveIn[Target];
+            }
+
+            const FRegisterUsage Usage = FRegisterUsage::Of(Inst);
+            const uint16 In = Usage.Reads | (Out & ~Usage.Writes);
+
+            if (Out != LiveOut[i] || In != LiveIn[i])
+            {
+                LiveOut[i] = Out;
+                LiveIn[i] = In;
+                bChanged = true;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Pass 1: 상수 전파/폴딩
+// ============================================================================
+
+bool FHktVMOptimizer::FoldConstants()
+{
+    TArray<FInstruction>& Code = Program.Code;
+    bool bChanged = false;
+
+    int32 Values[MaxRegisters] = {0};
+    uint16 Known = 0;
+
+    auto IsKnown = [&Known](uint32 Reg) { return (Known & (1u << Reg)) != 0; };
+    auto SetKnown = [&Known, &Values](uint32 Reg, int32 Value) { Known |= (1u << Reg); Values[Reg] = Value; };
+
+    for (int32 i = 0; i < Code.Num(); ++i)
+    {
+        // 다른 경로에서 진입 가능한 지점에서는 레지스터 값을 알 수 없음
+        if (JumpTargets[i])
+        {
+            Known = 0;
+        }
+
+        FInstruction& Inst = Code[i];
+        const EOpCode Op = Inst.GetOpCode();
+
+        bool bHasResult = false;
+        int32 Result = 0;
+
+        switch (Op)
+        {
+        case EOpCode::LoadConst:
+            SetKnown(Inst._Dst, Inst.GetSignedImm20());
+            continue;
+
+        case EOpCode::LoadConstHigh:
+            if (IsKnown(Inst.Dst))
+            {
+                SetKnown(Inst.Dst, (Values[Inst.Dst] & 0xFFFFF) | (static_cast<int32>(Inst.Imm12) << 20));
+                continue;
+            }
+            break;
+
+        case EOpCode::LoadConstPool:
+            if (Program.Constants.IsValidIndex(Inst.Imm20))
+            {
+                SetKnown(Inst._Dst, Program.Constants[Inst.Imm20]);
+                continue;
+            }
+            break;
+
+        case EOpCode::AddImmWide:
+            if (IsKnown(Inst._Dst))
+            {
+                bHasResult = true;
+                Result = static_cast<int32>(static_cast<uint32>(Values[Inst._Dst]) + static_cast<uint32>(Inst.GetSignedImm20()));
+            }
+            break;
+
+        case EOpCode::Move:
+            if (IsKnown(Inst.Src1))
+            {
+                bHasResult = true;
+                Result = Values[Inst.Src1];
+            }
+            break;
+
+        case EOpCode::AddImm:
+            if (IsKnown(Inst.Src1))
+            {
+                bHasResult = true;
+                Result = static_cast<int32>(static_cast<uint32>(Values[Inst.Src1]) + static_cast<uint32>(Inst.GetSignedImm12()));
+            }
+            break;
+
+        case EOpCode::Add:
+        case EOpCode::Sub:
+        case EOpCode::Mul:
+        case EOpCode::Div:
+        case EOpCode::Mod:
+        case EOpCode::CmpEq:
+        case EOpCode::CmpNe:
+        case EOpCode::CmpLt:
+        case EOpCode::CmpLe:
+        case EOpCode::CmpGt:
+        case EOpCode::CmpGe:
+            if (IsKnown(Inst.Src1) && IsKnown(Inst.Src2))
+            {
+                bHasResult = EvaluateBinary(Op, Values[Inst.Src1], Values[Inst.Src2], Result);
+            }
+            break;
+
+        case EOpCode::JumpIf:
+        case EOpCode::JumpIfNot:
+            if (IsKnown(Inst.Src1))
+            {
+                const bool bTaken = (Values[Inst.Src1] != 0) == (Op == EOpCode::JumpIf);
+                Inst = bTaken ? FInstruction::MakeImm(EOpCode::Jump, 0, Inst.Imm12) : FInstruction::Make(EOpCode::Nop);
+                bChanged = true;
+            }
+            break;
+
+        case EOpCode::JumpIfEq:
+        case EOpCode::JumpIfNe:
+        case EOpCode::JumpIfLt:
+        case EOpCode::JumpIfLe:
+        case EOpCode::JumpIfGt:
+        case EOpCode::JumpIfGe:
+            if (IsKnown(Inst.Src1) && IsKnown(Inst.Src2))
+            {
+                int32 bTaken = 0;
+                EvaluateBinary(Op, Values[Inst.Src1], Values[Inst.Src2], bTaken);
+                Inst = bTaken ? FInstruction::MakeImm(EOpCode::Jump, 0, Inst.Imm12) : FInstruction::Make(EOpCode::Nop);
+                bChanged = true;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (bHasResult)
+        {
+            const RegisterIndex Dst = Op == EOpCode::AddImmWide ? Inst._Dst : Inst.Dst;
+            Inst = FitsImm20(Result)
+                ? FInstruction::MakeImm(EOpCode::LoadConst, Dst, Result)
+                : FInstruction::MakeImm(EOpCode::LoadConstPool, Dst, Program.FindOrAddConstant(Result));
+            bChanged = true;
+            SetKnown(Dst, Result);
+            continue;
+        }
+
+        Known &= ~FRegisterUsage::Of(Code[i]).Writes;
+        if (!Code[i].FallsThrough())
+        {
+            Known = 0;
+        }
+    }
+
+    return bChanged;
+}
+
+// ============================================================================
+// Pass 2: 슈퍼명령어 융합
+// ============================================================================
+
+bool FHktVMOptimizer::FuseSuperinstructions()
+{
+    TArray<FInstruction>& Code = Program.Code;
+    bool bChanged = false;
+
+    for (int32 i = 0; i + 1 < Code.Num(); ++i)
+    {
+        // 두 번째 명령어로 직접 점프해 들어오는 경로가 있으면 융합 불가
+        if (JumpTargets[i + 1])
+            continue;
+
+        const FInstruction Cur = Code[i];
+        const FInstruction Next = Code[i + 1];
+        const EOpCode NextOp = Next.GetOpCode();
+        FInstruction Fused;
+        bool bFused = false;
+
+        if (Cur.GetOpCode() == EOpCode::LoadConst)
+        {
+            const RegisterIndex ValueReg = Cur._Dst;
+            const int32 Value = Cur.GetSignedImm20();
+
+            if (!FitsImm12(Value) || IsLiveAfter(i + 1, ValueReg))
+                continue;
+
+            if (NextOp == EOpCode::SaveStore && Next.Src1 == ValueReg && FitsPackedProperty(Next.Imm12))
+            {
+                Fused = FInstruction::MakePropConst(EOpCode::SaveStoreConst, 0, Next.Imm12, Value);
+                bFused = true;
+            }
+            else if (NextOp == EOpCode::SaveStoreEntity && Next.Src2 == ValueReg && Next.Src1 != ValueReg && FitsPackedProperty(Next.Imm12))
+            {
+                Fused = FInstruction::MakePropConst(EOpCode::SaveStoreEntityConst, Next.Src1, Next.Imm12, Value);
+                bFused = true;
+            }
+            else if (NextOp == EOpCode::ApplyDamage && Next.Src2 == ValueReg && Next.Src1 != ValueReg)
+            {
+                Fused = FInstruction::Make(EOpCode::ApplyDamageConst, 0, Next.Src1, 0, Value & 0xFFF);
+                bFused = true;
+            }
+        }
+        else if ((NextOp == EOpCode::JumpIf || NextOp == EOpCode::JumpIfNot) && Next.Src1 == Cur.Dst)
+        {
+            const EOpCode JumpOp = CompareToJump(Cur.GetOpCode(), NextOp == EOpCode::JumpIfNot);
+            if (JumpOp != EOpCode::Max && !IsLiveAfter(i + 1, Cur.Dst))
+            {
+                Fused = FInstruction::Make(JumpOp, 0, Cur.Src1, Cur.Src2, Next.Imm12);
+                bFused = true;
+            }
+        }
+
+        if (bFused)
+        {
+            Code[i] = FInstruction::Make(EOpCode::Nop);
+            Code[i + 1] = Fused;
+            bChanged = true;
+            ++i;
+        }
+    }
+
+    return bChanged;
+}
+
+/**
+ * 연속 레지스터에 대한 같은 스칼라 연산 3개 → Vec3 명령어
+ *
+ *   Add D, A, B / Add D+1, A+1, B+1 / Add D+2, A+2, B+2  → Vec3Add D, A, B
+ *   Mul D, A, S / Mul D+1, A+1, S   / Mul D+2, A+2, S    → Vec3Scale D, A, S
+ *
+ * Vec3 명령어는 성분 순서대로 기록하므로 레지스터가 겹쳐도 원래 3개와 결과가 같습니다.
+ */
+bool FHktVMOptimizer::FuseVectorOps()
+{
+    TArray<FInstruction>& Code = Program.Code;
+    bool bChanged = false;
+
+    auto VectorOpFor = [](EOpCode Op)
+    {
+        switch (Op)
+        {
+        case EOpCode::Add: return EOpCode::Vec3Add;
+        case EOpCode::Sub: return EOpCode::Vec3Sub;
+        case EOpCode::Mul: return EOpCode::Vec3Scale;
+        default:           return EOpCode::Max;
+        }
+    };
+
+    for (int32 i = 0; i + 2 < Code.Num(); ++i)
+    {
+        if (JumpTargets[i + 1] || JumpTargets[i + 2])
+            continue;
+
+        const FInstruction X = Code[i];
+        const EOpCode VecOp = VectorOpFor(X.GetOpCode());
+        if (VecOp == EOpCode::Max || X.Dst + 2 >= MaxRegisters || X.Src1 + 2 >= MaxRegisters)
+            continue;
+
+        // Scale은 스칼라 레지스터 고정, Add/Sub는 두 번째 피연산자도 연속
+        const bool bScalarSrc2 = VecOp == EOpCode::Vec3Scale;
+        if (!bScalarSrc2 && X.Src2 + 2 >= MaxRegisters)
+            continue;
+
+        bool bMatch = true;
+        for (uint32 k = 1; k <= 2 && bMatch; ++k)
+        {
+            const FInstruction& Y = Code[i + k];
+            bMatch = Y.GetOpCode() == X.GetOpCode()
+                && Y.Dst == X.Dst + k
+                && Y.Src1 == X.Src1 + k
+                && Y.Src2 == (bScalarSrc2 ? X.Src2 : X.Src2 + k);
+        }
+        if (!bMatch)
+            continue;
+
+        Code[i] = FInstruction::Make(EOpCode::Nop);
+        Code[i + 1] = FInstruction::Make(EOpCode::Nop);
+        Code[i + 2] = FInstruction::Make(VecOp, X.Dst, X.Src1, X.Src2, 0);
+        bChanged = true;
+        i += 2;
+    }
+
+    return bChanged;
+}
+
+// ============================================================================
+// Pass 3: 죽은 코드 제거
+// ============================================================================
+
+bool FHktVMOptimizer::RemoveDeadCode()
+{
+    TArray<FInstruction>& Code = Program.Code;
+    const int32 Num = Code.Num();
+    bool bChanged = false;
+
+    // 진입점(0)에서 도달 가능한 명령어
+    TBitArray<> Reachable(false, Num);
+    TArray<int32> Worklist;
+    if (Num > 0)
+    {
+        Worklist.Add(0);
+    }
+    while (Worklist.Num() > 0)
+    {
+        const int32 Index = Worklist.Pop();
+        if (Index < 0 || Index >= Num || Reachable[Index])
+            continue;
+
+        Reachable[Index] = true;
+
+        if (Code[Index].FallsThrough())
+        {
+            Worklist.Add(Index + 1);
+        }
+        int32 Target;
+        if (Code[Index].GetBranchTarget(Target))
+        {
+            Worklist.Add(Target);
+        }
+    }
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        FInstruction& Inst = Code[i];
+        if (Inst.GetOpCode() == EOpCode::Nop)
+            continue;
+
+        const bool bUnreachable = !Reachable[i];
+        const bool bUnusedResult = IsPure(Inst) && (FRegisterUsage::Of(Inst).Writes & LiveOut[i]) == 0;
+
+        if (bUnreachable || bUnusedResult)
+        {
+            Inst = FInstruction::Make(EOpCode::Nop);
+            bChanged = true;
+        }
+    }
+
+    return bChanged;
+}
+
+void FHktVMOptimizer::Compact()
+{
+    TArray<FInstruction>& Code = Program.Code;
+    const int32 Num = Code.Num();
+
+    // 기존 인덱스 → 새 인덱스 (제거된 명령어는 다음으로 남는 명령어를 가리킴)
+    TArray<int32> NewIndex;
+    NewIndex.SetNum(Num + 1);
+    int32 NextIndex = 0;
+    for (int32 i = 0; i < Num; ++i)
+    {
+        NewIndex[i] = NextIndex;
+        if (Code[i].GetOpCode() != EOpCode::Nop)
+        {
+            ++NextIndex;
+        }
+    }
+    NewIndex[Num] = NextIndex;
+
+    if (NextIndex == Num)
+        return;
+
+    const bool bHasLineNumbers = Program.LineNumbers.Num() == Num;
+
+    TArray<FInstruction> NewCode;
+    TArray<int32> NewLineNumbers;
+    NewCode.Reserve(NextIndex);
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        FInstruction Inst = Code[i];
+        if (Inst.GetOpCode() == EOpCode::Nop)
+            continue;
+
+        int32 Target;
+        if (Inst.GetBranchTarget(Target))
+        {
+            Inst.SetBranchTarget(NewIndex[FMath::Clamp(Target, 0, Num)]);
+        }
+
+        NewCode.Add(Inst);
+        if (bHasLineNumbers)
+        {
+            NewLineNumbers.Add(Program.LineNumbers[i]);
+        }
+    }
+
+    Code = MoveTemp(NewCode);
+    if (bHasLineNumbers)
+    {
+        Program.LineNumbers = MoveTemp(NewLineNumbers);
+    }
+}
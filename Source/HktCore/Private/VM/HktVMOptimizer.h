@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktVMTypes.h"
+
+struct FHktVMProgram;
+
+/**
+ * FHktVMOptimizer - 바이트코드 peephole 최적화 패스 (FFlowBuilder::Build 시점)
+ *
+ * 라벨 해석이 끝난 프로그램에 대해 동작하며, 최종 Store 쓰기 결과는 변경하지 않습니다.
+ *
+ * 1. 상수 전파/폴딩: 기본 블록 내에서 값이 확정된 레지스터 연산을 LoadConst로 치환
+ *    (20비트를 넘으면 상수 풀 LoadConstPool), 조건이 확정된 분기를 Jump/Nop으로 치환
+ * 2. 슈퍼명령어 융합 (중간 레지스터가 이후 읽히지 않을 때만):
+ *    LoadConst + SaveStore        → SaveStoreConst
+ *    LoadConst + SaveStoreEntity  → SaveStoreEntityConst
+ *    LoadConst + ApplyDamage      → ApplyDamageConst
+ *    CmpXX + JumpIf/JumpIfNot     → JumpIfXX
+ *    연속 레지스터에 대한 Add/Sub ×3 → Vec3Add/Vec3Sub, 같은 스칼라 Mul ×3 → Vec3Scale
+ * 3. 죽은 코드 제거: 결과가 읽히지 않는 순수 연산 제거 후 점프 대상 재계산
+ */
+class FHktVMOptimizer
+{
+public:
+    /** @return 제거된 명령어 수 */
+    static int32 Optimize(FHktVMProgram& Program);
+
+private:
+    explicit FHktVMOptimizer(FHktVMProgram& InProgram);
+
+    bool FoldConstants();
+    bool FuseSuperinstructions();
+    bool FuseVectorOps();
+    bool RemoveDeadCode();
+    void Compact();
+
+    void AnalyzeControlFlow();
+    void ComputeLiveness();
+
+    /** Index 명령어 실행 직후 Reg가 다시 읽힐 수 있는지 */
+    bool IsLiveAfter(int32 Index, RegisterIndex Reg) const { return (LiveOut[Index] & (1u << Reg)) != 0; }
+
+    static bool IsPure(const FInstruction& Inst);
+
+private:
+    FHktVMProgram& Program;
+
+    /** 점프 대상이 되는 명령어 (기본 블록 시작점) */
+    TBitArray<> JumpTargets;
+
+    /** 명령어 실행 직후 살아있는 레지스터 마스크 */
+    TArray<uint16> LiveOut;
+};
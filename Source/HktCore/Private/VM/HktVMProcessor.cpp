@@ -3,6 +3,10 @@
 #include "HktVMInterpreter.h"
 #include "HktVMStore.h"
 #include "HktVMProgram.h"
+#include "HktVMTrace.h"
+#include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
 
 #if WITH_HKT_INSIGHTS
 #include "HktInsightsDataCollector.h"
@@ -20,26 +24,70 @@ FHktVMProcessor::~FHktVMProcessor()
 void FHktVMProcessor::Initialize(IHktStashInterface* InStash)
 {
     Stash = InStash;
+    StashReader.Bind(Stash);
     
     Interpreter = new FHktVMInterpreter();
     Interpreter->Initialize(Stash);
 
+    QueryArenas[0].Reset();
+    QueryArenas[1].Reset();
+    CurrentQueryArena = 0;
+    LiveQueryVMs.Reset();
+    Interpreter->SetQueryArena(&QueryArenas[CurrentQueryArena]);
+
+    SpatialIndex.Initialize(Stash);
+    Interpreter->SetSpatialIndex(&SpatialIndex);
+
     // RuntimePool은 인라인 멤버이므로 Reset으로 초기화
     RuntimePool.Reset();
+    EventWaiters.Reset();
+    TimerWheel.Reset();
+    AwakeVMs.Reset();
+    SpawningVMs.Reset();
+    DestroyingVMs.Reset();
+
+    // Store 풀 초기화 (Runtime 슬롯과 1:1, 풀이 커지면 함께 확장)
+    StorePool.Empty();
+    GrowStorePool();
+    AdmissionQueue.Reset();
+}
 
-    // Store 풀 초기화
-    StorePool.SetNum(256);
-    for (FHktVMStore& Store : StorePool)
+void FHktVMProcessor::SetMaxVMs(int32 InMaxVMs)
+{
+    RuntimePool.SetMaxCapacity(InMaxVMs);
+}
+
+void FHktVMProcessor::ReserveVMs(int32 NumVMs)
+{
+    RuntimePool.Reserve(NumVMs);
+    GrowStorePool();
+}
+
+void FHktVMProcessor::GrowStorePool()
+{
+    const int32 First = StorePool.Num();
+    if (First >= RuntimePool.Capacity())
+        return;
+
+    StorePool.Add(RuntimePool.Capacity() - First);
+    for (int32 i = First; i < StorePool.Num(); ++i)
     {
-        Store.Stash = Stash;
+        StorePool[i].Stash = StashReader;
     }
 }
 
 void FHktVMProcessor::Tick(int32 CurrentFrame, float DeltaSeconds)
 {
+    HKT_VM_TRACE_FRAME(CurrentFrame);
+    HKT_VM_TRACE_EVENT(FrameBegin, 0xFFFFFF, PendingEvents.Num() + AdmissionQueue.Num(), RuntimePool.NumActive());
+    
     Build(CurrentFrame);
-    Execute(DeltaSeconds);
+    Execute(CurrentFrame, DeltaSeconds);
+    
+    const int32 NumCompleted = CompletedVMs.Num();
     Cleanup(CurrentFrame);
+    
+    HKT_VM_TRACE_EVENT(FrameEnd, 0xFFFFFF, NumCompleted, RuntimePool.NumActive());
 }
 
 void FHktVMProcessor::NotifyIntentEvent(const FHktIntentEvent& Event)
@@ -69,25 +117,52 @@ void FHktVMProcessor::NotifyCollision(FHktEntityId WatchedEntity, FHktEntityId H
     PendingExternalEvents.Add(Event);
 }
 
+void FHktVMProcessor::NotifyMoveEnd(FHktEntityId Entity)
+{
+    FHktPendingEvent Event;
+    Event.Type = EWaitEventType::MoveEnd;
+    Event.WatchedEntity = Entity;
+    PendingExternalEvents.Add(Event);
+}
+
+void FHktVMProcessor::NotifyAnimEnd(FHktEntityId Entity)
+{
+    FHktPendingEvent Event;
+    Event.Type = EWaitEventType::AnimEnd;
+    Event.WatchedEntity = Entity;
+    PendingExternalEvents.Add(Event);
+}
+
 // ============================================================================
 // Phase 1: Build
 // ============================================================================
 
 void FHktVMProcessor::Build(int32 CurrentFrame)
 {
-    TArray<FHktIntentEvent> Events = PullIntentEvents();
-    for (const FHktIntentEvent& Event : Events)
+    // 이전 프레임에 미뤄진 Intent부터 (도착 순서 유지)
+    TArray<FHktIntentEvent> Events = MoveTemp(AdmissionQueue);
+    AdmissionQueue.Reset();
+    Events.Append(PullIntentEvents());
+
+    int32 Admitted = 0;
+    for (int32 i = 0; i < Events.Num(); ++i)
     {
-        // VM 생성
-        TOptional<FHktVMHandle> Handle = TryCreateVM(Event, CurrentFrame);
+        // 풀 상한 또는 프레임당 생성 한도 도달 → 나머지는 버리지 않고 다음 프레임으로
+        if (!RuntimePool.CanAllocate() || (MaxAdmissionsPerFrame > 0 && Admitted >= MaxAdmissionsPerFrame))
+        {
+            AdmissionQueue.Append(Events.GetData() + i, Events.Num() - i);
+            HKT_VM_TRACE_EVENT(AdmissionDeferred, 0xFFFFFF, AdmissionQueue.Num(), RuntimePool.NumActive());
+            break;
+        }
+
+        // VM 생성 - 새 VM은 이번 프레임에 바로 실행
+        TOptional<FHktVMHandle> Handle = TryCreateVM(Events[i], CurrentFrame);
         if (Handle.IsSet())
         {
-            PendingVMs.Add(Handle.GetValue());
+            AwakeVMs.Add(Handle.GetValue());
+            ++Admitted;
         }
     }
-    
-    ActiveVMs.Append(PendingVMs);
-    PendingVMs.Reset();
 }
 
 TArray<FHktIntentEvent> FHktVMProcessor::PullIntentEvents()
@@ -112,6 +187,12 @@ TOptional<FHktVMHandle> FHktVMProcessor::TryCreateVM(const FHktIntentEvent& Even
         return {};
     }
     
+    if (!Program->bVerified)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VM creation failed: Program %s failed verification"), *Event.EventTag.ToString());
+        return {};
+    }
+    
     FHktVMHandle Handle = RuntimePool.Allocate();
     if (!Handle.IsValid())
     {
@@ -122,23 +203,24 @@ TOptional<FHktVMHandle> FHktVMProcessor::TryCreateVM(const FHktIntentEvent& Even
     FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
     check(Runtime);
     
-    // Store 할당
+    // Store 할당 (풀이 커졌으면 Store도 확장)
+    GrowStorePool();
     FHktVMStore& Store = StorePool[Handle.Index];
-    Store.Stash = Stash;
+    Store.Stash = StashReader;
     Store.SourceEntity = Event.SourceEntity;
     Store.TargetEntity = Event.TargetEntity;
     Store.ClearPendingWrites();
-    Store.LocalCache.Reset();
     
     // Runtime 초기화
     Runtime->Program = Program;
     Runtime->Store = &Store;
     Runtime->PC = 0;
-    Runtime->Status = EVMStatus::Ready;
     Runtime->CreationFrame = CurrentFrame;
     Runtime->WaitFrames = 0;
     Runtime->EventWait.Reset();
     Runtime->SpatialQuery.Reset();
+    Runtime->PendingSpawn.Reset();
+    Runtime->bRecordedDestroy = false;
     FMemory::Memzero(Runtime->Registers, sizeof(Runtime->Registers));
 
 #if !UE_BUILD_SHIPPING
@@ -161,7 +243,7 @@ TOptional<FHktVMHandle> FHktVMProcessor::TryCreateVM(const FHktIntentEvent& Even
     Store.Write(PropertyId::TargetPosY, FMath::RoundToInt(Event.Location.Y));
     Store.Write(PropertyId::TargetPosZ, FMath::RoundToInt(Event.Location.Z));
     
-    UE_LOG(LogTemp, Log, TEXT("VM created: %s for Entity %u"), *Event.EventTag.ToString(), (int32)Event.SourceEntity);
+    HKT_VM_TRACE_EVENT(VMCreated, Handle.Index, static_cast<int32>(Event.SourceEntity), Event.EventId);
     
     // HktInsights: VM 생성 기록
     HKT_INSIGHTS_RECORD_VM_CREATED(
@@ -182,125 +264,390 @@ TOptional<FHktVMHandle> FHktVMProcessor::TryCreateVM(const FHktIntentEvent& Even
 // Phase 2: Execute
 // ============================================================================
 
-void FHktVMProcessor::Execute(float DeltaSeconds)
+void FHktVMProcessor::Execute(int32 CurrentFrame, float DeltaSeconds)
 {
     // 외부 이벤트를 로컬로 이동 (순회 중 새 이벤트 추가 방지)
     TArray<FHktPendingEvent> ExternalEvents = MoveTemp(PendingExternalEvents);
     PendingExternalEvents.Reset();
 
-    // 단일 ForEachActive — 이벤트 매칭 + 상태 전환을 한 번의 순회로
-    RuntimePool.ForEachActive([&](FHktVMHandle Handle, FHktVMRuntime& Runtime)
+    // 대기 중인 VM 재개: 이벤트는 인덱스 조회, 시간 대기는 이번 프레임에 만료된 타이머만
+    WakeEventWaiters(ExternalEvents);
+    WakeExpiredTimers(CurrentFrame);
+
+    // 이번 프레임에 실행할 VM = 입장 + 깨어난 VM, 슬롯 순 (깨운 경로/순서와 무관한 실행 순서)
+    // 잠든 VM은 여기 없으므로 이하 모든 단계는 깨어난 VM 수에 비례
+    AwakeVMs.Sort([](const FHktVMHandle& A, const FHktVMHandle& B) { return A.Index < B.Index; });
+    AwakeVMs.SetNum(Algo::Unique(AwakeVMs), false);
+
+    Interpreter->bEnableNative = bEnableNativeExecution;
+    Interpreter->bVerifyNative = bVerifyNativeExecution;
+
+    // 지난 프레임 이후 Stash가 바뀌었으므로 이번 프레임 첫 검색에서 다시 빌드
+    SpatialIndex.Invalidate();
+
+    // 이번 프레임 명령어 예산 (광역 실행/라운드에 걸쳐 VM별로 차감)
+    // 배열은 풀 용량까지 늘리기만 하고, 값은 깨어난 VM 슬롯만 채움
+    if (InstructionBudgets.Num() < RuntimePool.Capacity())
+    {
+        InstructionBudgets.SetNumUninitialized(RuntimePool.Capacity());
+    }
+    for (FHktVMHandle Handle : AwakeVMs)
+    {
+        InstructionBudgets[Handle.Index] = FHktVMInterpreter::MaxInstructionsPerTick;
+    }
+
+    // 같은 Program/PC에 모인 VM들을 먼저 함께 진행
+    if (bEnableWideExecution)
+    {
+        ExecuteWideGroups();
+    }
+
+    // 첫 라운드: 광역 실행에서 멈추지 않은 VM
+    RoundVMs.Reset();
+    for (FHktVMHandle Handle : AwakeVMs)
+    {
+        if (FHktVMRuntimePool::IsRunnable(RuntimePool.GetStatus(Handle)))
+        {
+            RoundVMs.Add(Handle);
+        }
+    }
+
+    // 라운드: 실행 가능한 VM 병렬 실행 → 생성 요청을 순서대로 할당 → 그 VM들만 재개
+    // 라운드 중 Stash는 읽기 전용이므로 결과는 스레드 수/스케줄과 무관
+    do
+    {
+        ExecuteRound(DeltaSeconds);
+    }
+    while (ResolvePendingSpawns());
+
+    ApplyPendingDestroys();
+
+    // 완료된 VM 수집 - 이번 프레임에 실행된 VM만 (슬롯 순 → Cleanup의 커밋 순서 고정)
+    for (FHktVMHandle Handle : AwakeVMs)
+    {
+        if (FHktVMRuntimePool::IsTerminated(RuntimePool.GetStatus(Handle)))
+        {
+            CompletedVMs.Add(Handle);
+        }
+    }
+    AwakeVMs.Reset();
+}
+
+namespace
+{
+    uint64 MakeWaitKey(EWaitEventType Type, FHktEntityId Entity)
+    {
+        return (static_cast<uint64>(Type) << 32) | static_cast<uint32>(Entity.RawValue);
+    }
+}
+
+void FHktVMProcessor::WakeEventWaiters(const TArray<FHktPendingEvent>& Events)
+{
+    // 최근 이벤트부터, 같은 키의 대기 VM은 슬롯 순서대로 하나씩 깨움 (이벤트 1개 = VM 1개)
+    for (int32 i = Events.Num() - 1; i >= 0; --i)
+    {
+        const FHktPendingEvent& Event = Events[i];
+        const uint64 Key = MakeWaitKey(Event.Type, Event.WatchedEntity);
+
+        TArray<FHktVMHandle>* Waiters = EventWaiters.Find(Key);
+        if (!Waiters)
+            continue;
+
+        FHktVMHandle Handle = FHktVMHandle::Invalid();
+        FHktVMRuntime* Runtime = nullptr;
+        while (!Runtime && Waiters->Num() > 0)
+        {
+            Handle = (*Waiters)[0];
+            Runtime = RuntimePool.Get(Handle);
+            Waiters->RemoveAt(0);
+        }
+        if (Waiters->Num() == 0)
+        {
+            EventWaiters.Remove(Key);
+        }
+        if (!Runtime)
+            continue;
+
+        if (Event.Type == EWaitEventType::Collision)
+        {
+            Runtime->SetRegEntity(Reg::Hit, Event.HitEntity);
+        }
+        Runtime->EventWait.Reset();
+        RuntimePool.SetStatus(Handle, EVMStatus::Ready);
+        AwakeVMs.Add(Handle);
+    }
+}
+
+void FHktVMProcessor::WakeExpiredTimers(int32 CurrentFrame)
+{
+    ExpiredTimers.Reset();
+    TimerWheel.Advance(CurrentFrame, ExpiredTimers);
+
+    for (FHktVMHandle Handle : ExpiredTimers)
+    {
+        FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
+        if (!Runtime)
+            continue;
+
+        Runtime->WaitFrames = 0;
+        Runtime->EventWait.Reset();
+        RuntimePool.SetStatus(Handle, EVMStatus::Ready);
+        AwakeVMs.Add(Handle);
+    }
+}
+
+void FHktVMProcessor::ScheduleWake(FHktVMHandle Handle, EVMStatus Status, const FHktVMRuntime& Runtime)
+{
+    // TimerWheel의 현재 프레임 = 실행 중인 프레임
+    const int32 Now = TimerWheel.GetCurrentFrame();
+
+    if (Status == EVMStatus::Yielded)
+    {
+        // Yield(N): N프레임을 건너뛴 다음 프레임에 재개 (예산 소진 시 WaitFrames = 0 → 다음 프레임)
+        TimerWheel.Schedule(Handle, Now + 1 + FMath::Max(0, Runtime.WaitFrames));
+    }
+    else if (Status == EVMStatus::WaitingEvent && Runtime.EventWait.Type == EWaitEventType::Timer)
+    {
+        TimerWheel.Schedule(Handle, Now + Runtime.WaitFrames);
+    }
+    else if (Status == EVMStatus::WaitingEvent)
+    {
+        TArray<FHktVMHandle>& Waiters = EventWaiters.FindOrAdd(MakeWaitKey(Runtime.EventWait.Type, Runtime.EventWait.WatchedEntity));
+        const int32 InsertAt = Algo::LowerBoundBy(Waiters, Handle.Index, [](const FHktVMHandle& H) { return H.Index; });
+        Waiters.Insert(Handle, InsertAt);
+    }
+}
+
+void FHktVMProcessor::ExecuteWideGroups()
+{
+    struct FWideGroup
+    {
+        const FHktVMProgram* Program;
+        int32 PC;
+        TArray<FHktVMRuntime*> Lanes;
+        TArray<FHktVMHandle> Handles;
+    };
+
+    // 직렬 실행과 같은 순서(AwakeVMs, 슬롯 순)로 그룹 구성
+    // 실행 순서는 Groups 배열(처음 나온 순)이 정하고, 맵은 (Program, PC) → 그룹 인덱스 조회에만 사용
+    TArray<FWideGroup> Groups;
+    TMap<TPair<const FHktVMProgram*, int32>, int32> GroupIndices;
+    GroupIndices.Reserve(AwakeVMs.Num());
+
+    for (const FHktVMHandle Handle : AwakeVMs)
     {
-        // 1) WaitingEvent VM: 외부 이벤트 매칭 또는 타이머 업데이트
-        if (Runtime.Status == EVMStatus::WaitingEvent)
+        if (!FHktVMRuntimePool::IsRunnable(RuntimePool.GetStatus(Handle)))
+            continue;
+
+        FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
+        int32& GroupIndex = GroupIndices.FindOrAdd(TPair<const FHktVMProgram*, int32>(Runtime->Program, Runtime->PC), INDEX_NONE);
+        if (GroupIndex == INDEX_NONE)
         {
-            if (Runtime.EventWait.Type == EWaitEventType::Timer)
+            GroupIndex = Groups.Num();
+            FWideGroup& NewGroup = Groups.AddDefaulted_GetRef();
+            NewGroup.Program = Runtime->Program;
+            NewGroup.PC = Runtime->PC;
+        }
+        FWideGroup& Group = Groups[GroupIndex];
+        Group.Lanes.Add(Runtime);
+        Group.Handles.Add(Handle);
+    }
+
+    TArray<FHktVMRuntime*> Chunk;
+    TArray<EVMStatus> Statuses;
+
+    for (FWideGroup& Group : Groups)
+    {
+        if (Group.Lanes.Num() < MinWideLanes)
+            continue;
+
+        for (int32 Start = 0; Start < Group.Lanes.Num(); Start += FHktVMInterpreter::MaxWideLanes)
+        {
+            const int32 Count = FMath::Min(FHktVMInterpreter::MaxWideLanes, Group.Lanes.Num() - Start);
+            Chunk.Reset();
+            Chunk.Append(Group.Lanes.GetData() + Start, Count);
+
+            for (int32 L = 0; L < Count; ++L)
             {
-                Runtime.EventWait.RemainingTime -= DeltaSeconds;
-                if (Runtime.EventWait.RemainingTime <= 0.0f)
-                {
-                    Runtime.EventWait.Reset();
-                    Runtime.Status = EVMStatus::Ready;
-                }
+                RuntimePool.SetStatus(Group.Handles[Start + L], EVMStatus::Running);
             }
-            else
+
+            const int32 Executed = Interpreter->ExecuteWide(Chunk, Statuses);
+
+            for (int32 L = 0; L < Count; ++L)
             {
-                // 큐에서 매칭되는 이벤트 검색
-                for (int32 i = ExternalEvents.Num() - 1; i >= 0; --i)
+                const FHktVMHandle Handle = Group.Handles[Start + L];
+                InstructionBudgets[Handle.Index] -= Executed;
+
+                // 광역 실행 중 멈춘 레인은 라운드에서 IsRunnable()이 false가 되어 건너뜀
+                RuntimePool.SetStatus(Handle, Statuses[L] == EVMStatus::Running ? EVMStatus::Ready : Statuses[L]);
+                if (Statuses[L] != EVMStatus::Running)
                 {
-                    if (ExternalEvents[i].Type == Runtime.EventWait.Type &&
-                        ExternalEvents[i].WatchedEntity == Runtime.EventWait.WatchedEntity)
+                    ScheduleWake(Handle, Statuses[L], *Chunk[L]);
+                    RecordVMTick(Handle, *Chunk[L], Statuses[L]);
+                    if (Chunk[L]->SpatialQuery.HasNext())
+                    {
+                        LiveQueryVMs.Add(Handle);
+                    }
+                    if (Statuses[L] == EVMStatus::PendingSpawn)
+                    {
+                        SpawningVMs.Add(Handle);
+                    }
+                    if (Chunk[L]->bRecordedDestroy)
                     {
-                        if (ExternalEvents[i].Type == EWaitEventType::Collision)
-                        {
-                            Runtime.SetRegEntity(Reg::Hit, ExternalEvents[i].HitEntity);
-                        }
-                        Runtime.EventWait.Reset();
-                        Runtime.Status = EVMStatus::Ready;
-                        ExternalEvents.RemoveAtSwap(i);
-                        break;
+                        DestroyingVMs.Add(Handle);
+                        Chunk[L]->bRecordedDestroy = false;
                     }
                 }
             }
         }
+    }
+}
+
+void FHktVMProcessor::ExecuteRound(float DeltaSeconds)
+{
+    // 각 VM은 자신의 Runtime/Store만 수정 - Insights 기록은 게임 스레드에서
+    const bool bSingleThread = !bEnableParallelExecution || RoundVMs.Num() < MinParallelVMs;
+    ParallelFor(RoundVMs.Num(), [this, DeltaSeconds](int32 Index)
+    {
+        ExecuteUntilYield(RoundVMs[Index], DeltaSeconds);
+    }, bSingleThread);
 
-        // 2) Yielded VM: 프레임 카운트다운
-        if (Runtime.Status == EVMStatus::Yielded)
+    for (FHktVMHandle Handle : RoundVMs)
+    {
+        FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
+        const EVMStatus Status = RuntimePool.GetStatus(Handle);
+        ScheduleWake(Handle, Status, *Runtime);
+        RecordVMTick(Handle, *Runtime, Status);
+        if (Runtime->SpatialQuery.HasNext())
         {
-            if (Runtime.WaitFrames <= 0)
-            {
-                Runtime.Status = EVMStatus::Ready;
-            }
-            else
-            {
-                Runtime.WaitFrames--;
-            }
+            LiveQueryVMs.Add(Handle);
         }
-    });
+        if (Status == EVMStatus::PendingSpawn)
+        {
+            SpawningVMs.Add(Handle);
+        }
+        if (Runtime->bRecordedDestroy)
+        {
+            DestroyingVMs.Add(Handle);
+            Runtime->bRecordedDestroy = false;
+        }
+    }
+}
 
-    // VM 실행
-    for (int32 i = ActiveVMs.Num() - 1; i >= 0; --i)
+bool FHktVMProcessor::ResolvePendingSpawns()
+{
+    if (SpawningVMs.Num() == 0)
+        return false;
+
+    // 슬롯 순으로 할당 → 스레드 수/광역 실행 여부와 무관한 엔티티 ID
+    SpawningVMs.Sort([](const FHktVMHandle& A, const FHktVMHandle& B) { return A.Index < B.Index; });
+
+    // 다음 라운드는 생성 요청이 풀린 VM만 실행
+    RoundVMs.Reset();
+    for (FHktVMHandle Handle : SpawningVMs)
     {
-        FHktVMHandle Handle = ActiveVMs[i];
-        EVMStatus Status = ExecuteUntilYield(Handle, DeltaSeconds);
+        FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
+        const FHktEntityId NewEntity = Stash->AllocateEntity();
+        Runtime->SetRegEntity(Reg::Spawned, NewEntity);
+        SpatialIndex.AddEntity(NewEntity);
 
-        if (Status == EVMStatus::Completed || Status == EVMStatus::Failed)
+        // 소유자/타입 설정 (Store를 통해 버퍼링)
+        if (Runtime->Store)
         {
-            CompletedVMs.Add(Handle);
-            ActiveVMs.RemoveAtSwap(i);
+            Runtime->Store->WriteEntity(NewEntity, PropertyId::OwnerEntity, Runtime->PendingSpawn.Owner);
+            Runtime->Store->WriteEntity(NewEntity, PropertyId::EntityType, Runtime->PendingSpawn.EntityType);
         }
+
+        Runtime->PendingSpawn.Reset();
+        RuntimePool.SetStatus(Handle, EVMStatus::Ready);
+        RoundVMs.Add(Handle);
     }
+    SpawningVMs.Reset();
+
+    return true;
+}
+
+void FHktVMProcessor::ApplyPendingDestroys()
+{
+    // 제거를 기록한 VM의 Store만 접근 (생성 후 다시 실행된 VM은 두 번 들어올 수 있음)
+    // 슬롯 순으로 적용 → 스레드 수/광역 실행 여부와 무관한 FreeList 순서
+    DestroyingVMs.Sort([](const FHktVMHandle& A, const FHktVMHandle& B) { return A.Index < B.Index; });
+    DestroyingVMs.SetNum(Algo::Unique(DestroyingVMs), false);
+
+    for (FHktVMHandle Handle : DestroyingVMs)
+    {
+        FHktVMStore& Store = StorePool[Handle.Index];
+        for (FHktEntityId Entity : Store.PendingDestroys)
+        {
+            Stash->FreeEntity(Entity);
+        }
+        Store.PendingDestroys.Reset();
+    }
+    DestroyingVMs.Reset();
 }
 
 EVMStatus FHktVMProcessor::ExecuteUntilYield(FHktVMHandle Handle, float DeltaSeconds)
 {
-    FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
-    if (!Runtime) return EVMStatus::Failed;
+    const EVMStatus Status = RuntimePool.GetStatus(Handle);
+    if (!FHktVMRuntimePool::IsRunnable(Status))
+        return Status;
     
-    if (!Runtime->IsRunnable())
-        return Runtime->Status;
+    FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
+    RuntimePool.SetStatus(Handle, EVMStatus::Running);
+    EVMStatus Result = Interpreter->Execute(*Runtime, InstructionBudgets[Handle.Index]);
+    RuntimePool.SetStatus(Handle, Result);
     
-    Runtime->Status = EVMStatus::Running;
-    EVMStatus Result = Interpreter->Execute(*Runtime);
-    Runtime->Status = Result;
+    return Result;
+}
+
+void FHktVMProcessor::RecordVMTick(FHktVMHandle Handle, const FHktVMRuntime& Runtime, EVMStatus Result)
+{
+    HKT_VM_TRACE_EVENT(VMTick, Handle.Index, Runtime.PC, static_cast<int32>(Result));
 
     // HktInsights: VM Tick 기록
 #if WITH_HKT_INSIGHTS
+    EHktInsightsVMState VMState;
+    switch (Result)
     {
-        EHktInsightsVMState VMState;
-        switch (Result)
-        {
-        case EVMStatus::Running:
-        case EVMStatus::Ready:
-            VMState = EHktInsightsVMState::Running;
-            break;
-        case EVMStatus::Yielded:
-        case EVMStatus::WaitingEvent:
-            VMState = EHktInsightsVMState::Blocked;
-            break;
-        case EVMStatus::Completed:
-            VMState = EHktInsightsVMState::Completed;
-            break;
-        case EVMStatus::Failed:
-            VMState = EHktInsightsVMState::Error;
-            break;
-        default:
-            VMState = EHktInsightsVMState::Running;
-            break;
-        }
+    case EVMStatus::Running:
+    case EVMStatus::Ready:
+    case EVMStatus::PendingSpawn:
+        VMState = EHktInsightsVMState::Running;
+        break;
+    case EVMStatus::Yielded:
+    case EVMStatus::WaitingEvent:
+        VMState = EHktInsightsVMState::Blocked;
+        break;
+    case EVMStatus::Completed:
+        VMState = EHktInsightsVMState::Completed;
+        break;
+    case EVMStatus::Failed:
+        VMState = EHktInsightsVMState::Error;
+        break;
+    default:
+        VMState = EHktInsightsVMState::Running;
+        break;
+    }
 
-        FString OpName;
-        if (Runtime->Program && Runtime->PC >= 0 && Runtime->PC < Runtime->Program->CodeSize())
+    // OpCode 이름은 한 번만 만들어 두고 틱마다 재사용
+    static const TArray<FString> OpNames = []()
+    {
+        TArray<FString> Names;
+        for (int32 Op = 0; Op < 256; ++Op)
         {
-            const FInstruction& Inst = Runtime->Program->Code[Runtime->PC];
-            OpName = FString::Printf(TEXT("OP_%02X"), static_cast<uint8>(Inst.GetOpCode()));
+            Names.Add(FString::Printf(TEXT("OP_%02X"), Op));
         }
+        return Names;
+    }();
 
-        HKT_INSIGHTS_RECORD_VM_TICK(Handle.Index, Runtime->PC, VMState, OpName);
-    }
+    static const FString NoOp;
+    const FString& OpName = (Runtime.Program && Runtime.PC >= 0 && Runtime.PC < Runtime.Program->CodeSize())
+        ? OpNames[static_cast<uint8>(Runtime.Program->Code[Runtime.PC].GetOpCode())]
+        : NoOp;
+
+    HKT_INSIGHTS_RECORD_VM_TICK(Handle.Index, Runtime.PC, VMState, OpName);
 #endif
-    
-    return Result;
 }
 
 // ============================================================================
@@ -309,24 +656,55 @@ EVMStatus FHktVMProcessor::ExecuteUntilYield(FHktVMHandle Handle, float DeltaSec
 
 void FHktVMProcessor::Cleanup(int32 CurrentFrame)
 {
+    CommitStoreChanges();
     for (FHktVMHandle Handle : CompletedVMs)
     {
-        ApplyStoreChanges(Handle);
         FinalizeVM(Handle);
     }
     CompletedVMs.Reset();
+
+    CarryOverQueryResults();
 }
 
-void FHktVMProcessor::ApplyStoreChanges(FHktVMHandle Handle)
+void FHktVMProcessor::CommitStoreChanges()
 {
-    FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
-    if (!Runtime || !Runtime->Store || !Stash) return;
-    
-    for (const FHktVMStore::FPendingWrite& W : Runtime->Store->PendingWrites)
+    // 완료 순서대로 모은 뒤 (PropertyId, EntityId)로 안정 정렬 → 같은 키는 나중에 완료된 VM이 이김
+    FrameWrites.Reset();
+    for (FHktVMHandle Handle : CompletedVMs)
+    {
+        FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
+        if (!Runtime || !Runtime->Store) continue;
+
+        FrameWrites.Append(Runtime->Store->PendingWrites);
+        Runtime->Store->ClearPendingWrites();
+    }
+
+    if (!Stash || FrameWrites.Num() == 0)
+        return;
+
+    FrameWrites.StableSort([](const FHktVMStore::FPendingWrite& A, const FHktVMStore::FPendingWrite& B)
+    {
+        return A.PropertyId != B.PropertyId ? A.PropertyId < B.PropertyId : A.Entity.RawValue < B.Entity.RawValue;
+    });
+
+    // 같은 키는 마지막 값만 남김
+    int32 NumUnique = 0;
+    for (int32 i = 0; i < FrameWrites.Num(); ++i)
     {
-        Stash->SetProperty(W.Entity, W.PropertyId, W.Value);
+        const FHktVMStore::FPendingWrite& W = FrameWrites[i];
+        if (NumUnique > 0 && FrameWrites[NumUnique - 1].PropertyId == W.PropertyId && FrameWrites[NumUnique - 1].Entity == W.Entity)
+        {
+            FrameWrites[NumUnique - 1].Value = W.Value;
+        }
+        else
+        {
+            FrameWrites[NumUnique++] = W;
+        }
     }
-    Runtime->Store->ClearPendingWrites();
+    FrameWrites.SetNum(NumUnique, false);
+
+    // 열 단위 한 번의 커밋 (MasterStash는 위치가 바뀐 엔티티의 셀을 ID 순으로 갱신)
+    Stash->ApplyWrites(FrameWrites);
 }
 
 void FHktVMProcessor::FinalizeVM(FHktVMHandle Handle)
@@ -334,11 +712,10 @@ void FHktVMProcessor::FinalizeVM(FHktVMHandle Handle)
     FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
     if (Runtime)
     {
-        UE_LOG(LogTemp, Log, TEXT("VM finalized: %s"), 
-            Runtime->Program ? *Runtime->Program->Tag.ToString() : TEXT("unknown"));
+        bool bSuccess = (RuntimePool.GetStatus(Handle) == EVMStatus::Completed);
+        HKT_VM_TRACE_EVENT(VMFinalized, Handle.Index, bSuccess ? 1 : 0, Runtime->PC);
 
         // HktInsights: VM 완료 기록
-        bool bSuccess = (Runtime->Status == EVMStatus::Completed);
         HKT_INSIGHTS_RECORD_VM_COMPLETED(Handle.Index, bSuccess);
 
         // HktInsights: Intent 이벤트 상태를 Completed/Failed로 업데이트
@@ -358,4 +735,39 @@ void FHktVMProcessor::FinalizeVM(FHktVMHandle Handle)
         }
     }
     RuntimePool.Free(Handle);
-}
\ No newline at end of file
+}
+
+void FHktVMProcessor::CarryOverQueryResults()
+{
+    // 순회 중인 결과의 남은 부분만 다음 아레나로 복사 (완료/해제된 VM은 무효 핸들로 건너뜀)
+    FHktVMQueryArena& NextArena = QueryArenas[1 - CurrentQueryArena];
+    NextArena.Reset();
+
+    LiveQueryVMs.Sort([](const FHktVMHandle& A, const FHktVMHandle& B) { return A.Index < B.Index; });
+
+    int32 NumCarried = 0;
+    for (int32 i = 0; i < LiveQueryVMs.Num(); ++i)
+    {
+        const FHktVMHandle Handle = LiveQueryVMs[i];
+        if (i > 0 && LiveQueryVMs[i - 1] == Handle)
+            continue;
+
+        FHktVMRuntime* Runtime = RuntimePool.Get(Handle);
+        if (!Runtime || !Runtime->SpatialQuery.HasNext())
+            continue;
+
+        FSpatialQueryResult& Query = Runtime->SpatialQuery;
+        const int32 Remaining = Query.Num - Query.CurrentIndex;
+        EntityId* Dest = NextArena.Allocate(Remaining);
+        FMemory::Memcpy(Dest, Query.Entities + Query.CurrentIndex, Remaining * sizeof(EntityId));
+        Query.Entities = Dest;
+        Query.Num = Remaining;
+        Query.CurrentIndex = 0;
+        LiveQueryVMs[NumCarried++] = Handle;
+    }
+    LiveQueryVMs.SetNum(NumCarried, false);
+
+    // 다음 프레임은 새 아레나에 기록, 이번 아레나는 다음 Cleanup에서 비움
+    CurrentQueryArena = 1 - CurrentQueryArena;
+    Interpreter->SetQueryArena(&QueryArenas[CurrentQueryArena]);
+}
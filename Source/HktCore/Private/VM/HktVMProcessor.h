@@ -7,6 +7,8 @@
 #include "HktVMTypes.h"
 #include "HktVMRuntime.h"
 #include "HktVMStore.h"
+#include "HktVMTimerWheel.h"
+#include "HktVMSpatialIndex.h"
 
 // Forward declarations
 enum class EVMStatus : uint8;
@@ -14,8 +16,9 @@ enum class EVMStatus : uint8;
 /**
  * FHktVMProcessor - 3단계 파이프라인으로 VM들을 처리 (Pure C++)
  * 
- * Build:   IntentEvent → VM 생성
- * Execute: 모든 VM yield까지 실행
+ * Build:   IntentEvent → VM 생성 (풀 상한 초과분은 AdmissionQueue로 다음 프레임에)
+ * Execute: 입장/깨어난 VM만 yield까지 실행 (워커 스레드 병렬, Stash는 읽기 전용)
+ *          엔티티 생성은 라운드 사이에, 제거는 Execute 끝에 슬롯 순서대로 적용
  * Cleanup: 결과 적용, 완료된 VM 정리
  * 
  * UObject/UWorld 참조 없음 - HktCore의 순수성 유지
@@ -32,33 +35,123 @@ public:
     virtual void Tick(int32 CurrentFrame, float DeltaSeconds) override;
     virtual void NotifyIntentEvent(const FHktIntentEvent& Event) override;
     virtual void NotifyCollision(FHktEntityId WatchedEntity, FHktEntityId HitEntity) override;
+    virtual void NotifyMoveEnd(FHktEntityId Entity) override;
+    virtual void NotifyAnimEnd(FHktEntityId Entity) override;
+
+    /** 동시 VM 수 상한 (기본: FHktVMHandle 24비트 인덱스 전체) - 초과한 Intent는 다음 프레임으로 미룸 */
+    void SetMaxVMs(int32 InMaxVMs);
+
+    /** Runtime/Store 슬롯을 미리 확보 (대규모 전투 전 확장 비용 제거) */
+    void ReserveVMs(int32 NumVMs);
+
+    /** 미뤄진 Intent 수 (AdmissionQueue) */
+    int32 GetNumDeferredIntents() const { return AdmissionQueue.Num(); }
+
+    /** 프레임당 새로 생성할 최대 VM 수 (0 = 무제한, 초과분은 다음 프레임으로) */
+    int32 MaxAdmissionsPerFrame = 0;
+
+    /** 같은 Program/PC의 VM들을 묶어 광역 실행할지 (끄면 항상 VM별 스칼라 실행) */
+    bool bEnableWideExecution = true;
+
+    /** 라운드 내 VM들을 워커 스레드에서 실행할지 (끄면 게임 스레드 직렬 실행, 결과는 동일) */
+    bool bEnableParallelExecution = true;
+
+    /** AOT 네이티브 Flow를 사용할지 (끄면 모든 Flow를 바이트코드로 실행, 결과는 동일) */
+    bool bEnableNativeExecution = true;
+
+    /** 네이티브 실행마다 바이트코드 결과와 비교 (개발 빌드 차등 검증, 느림) */
+    bool bVerifyNativeExecution = false;
+
+    /** 광역 실행할 최소 VM 수 (이보다 적으면 직렬 실행이 더 저렴) */
+    static constexpr int32 MinWideLanes = 4;
+
+    /** 워커 스레드로 나눌 최소 VM 수 (이보다 적으면 태스크 분배 비용이 더 큼) */
+    static constexpr int32 MinParallelVMs = 16;
 
 private:
     // Phase 1
     void Build(int32 CurrentFrame);
     TArray<FHktIntentEvent> PullIntentEvents();
     TOptional<FHktVMHandle> TryCreateVM(const FHktIntentEvent& Event, int32 CurrentFrame);
+    void GrowStorePool();
 
     // Phase 2
-    void Execute(float DeltaSeconds);
+    void Execute(int32 CurrentFrame, float DeltaSeconds);
+    void WakeEventWaiters(const TArray<FHktPendingEvent>& Events);
+    void WakeExpiredTimers(int32 CurrentFrame);
+    void ScheduleWake(FHktVMHandle Handle, EVMStatus Status, const FHktVMRuntime& Runtime);
+    void ExecuteWideGroups();
+    void ExecuteRound(float DeltaSeconds);
+    bool ResolvePendingSpawns();
+    void ApplyPendingDestroys();
     EVMStatus ExecuteUntilYield(FHktVMHandle Handle, float DeltaSeconds);
+    void RecordVMTick(FHktVMHandle Handle, const FHktVMRuntime& Runtime, EVMStatus Result);
 
     // Phase 3
     void Cleanup(int32 CurrentFrame);
-    void ApplyStoreChanges(FHktVMHandle Handle);
+    void CommitStoreChanges();
     void FinalizeVM(FHktVMHandle Handle);
+    void CarryOverQueryResults();
 
 private:
     IHktStashInterface* Stash = nullptr;
+
+    /** VM 읽기 경로 (Store에 복사, 가상 호출 없는 열 접근) */
+    FHktVMStashReader StashReader;
     
     FHktVMRuntimePool RuntimePool;
-    TArray<FHktVMStore> StorePool;
+    TChunkedArray<FHktVMStore> StorePool;   // Runtime->Store 포인터가 유지되도록 청크 저장
     
     TArray<FHktIntentEvent> PendingEvents;
+    
+    /** 풀 상한/프레임 한도로 미뤄진 Intent (도착 순서 유지, 다음 Build에서 먼저 처리) */
+    TArray<FHktIntentEvent> AdmissionQueue;
     TArray<FHktPendingEvent> PendingExternalEvents;
-    TArray<FHktVMHandle> PendingVMs;
-    TArray<FHktVMHandle> ActiveVMs;
     TArray<FHktVMHandle> CompletedVMs;
+
+    /**
+     * 이번 프레임에 실행할 VM (Build 입장, WakeEventWaiters, WakeExpiredTimers가 추가)
+     * Execute 시작 시 슬롯 순으로 정렬 - 잠든 VM은 어느 프레임 단계에서도 순회되지 않음
+     */
+    TArray<FHktVMHandle> AwakeVMs;
+
+    /** 이번 프레임 완료 VM의 쓰기 모음 (CommitStoreChanges 재사용 버퍼) */
+    TArray<FHktVMStore::FPendingWrite> FrameWrites;
+
+    /**
+     * 이벤트 대기 인덱스: (EWaitEventType, WatchedEntity) → 대기 VM (Handle.Index 오름차순)
+     * 이벤트가 오기 전까지 대기 VM은 프레임마다 순회되지 않음
+     */
+    TMap<uint64, TArray<FHktVMHandle>> EventWaiters;
+
+    /** Yield / WaitSeconds 대기 VM (마감 프레임에만 처리) */
+    FHktVMTimerWheel TimerWheel;
+    TArray<FHktVMHandle> ExpiredTimers;
+
+    /** 이번 프레임 남은 명령어 예산 (Handle.Index별, AwakeVMs 슬롯만 유효) */
+    TArray<int32> InstructionBudgets;
+
+    /** 현재 라운드에서 실행할 VM (첫 라운드: 실행 가능한 AwakeVMs, 이후: 생성이 풀린 VM) */
+    TArray<FHktVMHandle> RoundVMs;
+
+    /** 이번 라운드에 PendingSpawn으로 멈춘 VM (ResolvePendingSpawns에서 슬롯 순으로 할당) */
+    TArray<FHktVMHandle> SpawningVMs;
+
+    /** 이번 프레임에 DestroyEntity를 기록한 VM (ApplyPendingDestroys가 이 VM의 Store만 접근) */
+    TArray<FHktVMHandle> DestroyingVMs;
+
+    /**
+     * FindInRadius 결과 아레나 (이번 프레임 / 다음 프레임)
+     * Cleanup에서 아직 순회 중인 결과만 다음 아레나로 옮기고 이번 아레나를 비움
+     */
+    FHktVMQueryArena QueryArenas[2];
+    int32 CurrentQueryArena = 0;
+
+    /** 이번 프레임에 멈출 때 순회할 검색 결과가 남아 있던 VM (중복 가능) */
+    TArray<FHktVMHandle> LiveQueryVMs;
+
+    /** 공간 검색 격자 (Execute마다 무효화, 첫 검색에서 빌드) */
+    FHktVMSpatialIndex SpatialIndex;
     
     class FHktVMInterpreter* Interpreter = nullptr;
 };
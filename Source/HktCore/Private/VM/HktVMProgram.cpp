@@ -1,4 +1,79 @@
 #include "HktVMProgram.h"
+#include "HktVMOptimizer.h"
+#include "HktVMVerifier.h"
+
+// ============================================================================
+// FHktVMEffectSignature
+// ============================================================================
+
+void FHktVMEffectSignature::Reset()
+{
+    ReadProperties.Reset();
+    WriteProperties.Reset();
+    bSpawnsEntities = false;
+    bDestroysEntities = false;
+    bQueriesSpatial = false;
+    bYields = false;
+    WaitMask = 0;
+}
+
+void FHktVMEffectSignature::AddRead(uint16 PropertyId)
+{
+    if (ReadProperties.Num() <= PropertyId)
+    {
+        ReadProperties.Add(false, PropertyId + 1 - ReadProperties.Num());
+    }
+    ReadProperties[PropertyId] = true;
+}
+
+void FHktVMEffectSignature::AddWrite(uint16 PropertyId)
+{
+    if (WriteProperties.Num() <= PropertyId)
+    {
+        WriteProperties.Add(false, PropertyId + 1 - WriteProperties.Num());
+    }
+    WriteProperties[PropertyId] = true;
+}
+
+bool FHktVMEffectSignature::ConflictsWith(const FHktVMEffectSignature& Other) const
+{
+    // 엔티티 할당/해제는 Stash의 FreeList 순서에 의존
+    if (bSpawnsEntities || bDestroysEntities || Other.bSpawnsEntities || Other.bDestroysEntities)
+    {
+        return true;
+    }
+    
+    for (int32 Prop = 0; Prop < WriteProperties.Num(); ++Prop)
+    {
+        if (WriteProperties[Prop] && (Other.ReadsProperty(Prop) || Other.WritesProperty(Prop)))
+        {
+            return true;
+        }
+    }
+    for (int32 Prop = 0; Prop < Other.WriteProperties.Num(); ++Prop)
+    {
+        if (Other.WriteProperties[Prop] && ReadsProperty(Prop))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// FHktVMProgram
+// ============================================================================
+
+int32 FHktVMProgram::FindOrAddConstant(int32 Value)
+{
+    int32 Index = Constants.IndexOfByKey(Value);
+    if (Index == INDEX_NONE)
+    {
+        Index = Constants.Num();
+        Constants.Add(Value);
+    }
+    return Index;
+}
 
 // ============================================================================
 // FHktVMProgramRegistry
@@ -22,11 +97,26 @@ const FHktVMProgram* FHktVMProgramRegistry::FindProgram(const FGameplayTag& Tag)
 
 void FHktVMProgramRegistry::RegisterProgram(FHktVMProgram&& Program)
 {
+    // 검증은 락 밖에서 (실패한 프로그램도 등록되지만 VM 생성이 거부됨)
+    FHktVMVerifier::Verify(Program);
+    
+    // 같은 바이트코드로 생성된 네이티브 함수가 있으면 연결 (없으면 인터프리터)
+    Program.NativeEntry = Program.bVerified ? FHktVMNativeRegistry::Get().Find(Program) : nullptr;
+    
     FRWScopeLock WriteLock(Lock, SLT_Write);
     FGameplayTag Tag = Program.Tag;
     Programs.Add(Tag, MakeShared<FHktVMProgram>(MoveTemp(Program)));
 }
 
+void FHktVMProgramRegistry::ForEachProgram(TFunctionRef<void(const FHktVMProgram&)> Callback) const
+{
+    FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+    for (const auto& Pair : Programs)
+    {
+        Callback(*Pair.Value);
+    }
+}
+
 void FHktVMProgramRegistry::Clear()
 {
     FRWScopeLock WriteLock(Lock, SLT_Write);
@@ -37,6 +127,8 @@ void FHktVMProgramRegistry::Clear()
 // FFlowBuilder - Construction
 // ============================================================================
 
+bool FFlowBuilder::bOptimizeOnBuild = true;
+
 FFlowBuilder FFlowBuilder::Create(const FGameplayTag& Tag)
 {
     return FFlowBuilder(Tag);
@@ -72,13 +164,7 @@ int32 FFlowBuilder::AddString(const FString& Str)
 
 int32 FFlowBuilder::AddConstant(int32 Value)
 {
-    int32 Index = Program.Constants.IndexOfByKey(Value);
-    if (Index == INDEX_NONE)
-    {
-        Index = Program.Constants.Num();
-        Program.Constants.Add(Value);
-    }
-    return Index;
+    return Program.FindOrAddConstant(Value);
 }
 
 // ============================================================================
@@ -142,6 +228,18 @@ FFlowBuilder& FFlowBuilder::WaitCollision(RegisterIndex WatchEntity)
     return *this;
 }
 
+FFlowBuilder& FFlowBuilder::WaitAnimEnd(RegisterIndex Entity)
+{
+    Emit(FInstruction::Make(EOpCode::WaitAnimEnd, 0, Entity, 0, 0));
+    return *this;
+}
+
+FFlowBuilder& FFlowBuilder::WaitMoveEnd(RegisterIndex Entity)
+{
+    Emit(FInstruction::Make(EOpCode::WaitMoveEnd, 0, Entity, 0, 0));
+    return *this;
+}
+
 // ============================================================================
 // Data Operations
 // ============================================================================
@@ -155,9 +253,8 @@ FFlowBuilder& FFlowBuilder::LoadConst(RegisterIndex Dst, int32 Value)
     }
     else
     {
-        // 32비트 상수는 두 명령어로 분할
-        Emit(FInstruction::MakeImm(EOpCode::LoadConst, Dst, Value & 0xFFFFF));
-        Emit(FInstruction::Make(EOpCode::LoadConstHigh, Dst, 0, 0, (Value >> 20) & 0xFFF));
+        // 32비트 상수는 상수 풀에서 한 명령어로 로드
+        Emit(FInstruction::MakeImm(EOpCode::LoadConstPool, Dst, AddConstant(Value)));
     }
     return *this;
 }
@@ -222,7 +319,29 @@ FFlowBuilder& FFlowBuilder::Div(RegisterIndex Dst, RegisterIndex Src1, RegisterI
 
 FFlowBuilder& FFlowBuilder::AddImm(RegisterIndex Dst, RegisterIndex Src, int32 Imm)
 {
-    Emit(FInstruction::Make(EOpCode::AddImm, Dst, Src, 0, Imm & 0xFFF));
+    if (Imm >= -2048 && Imm <= 2047)
+    {
+        Emit(FInstruction::Make(EOpCode::AddImm, Dst, Src, 0, Imm & 0xFFF));
+    }
+    else if (Imm >= -524288 && Imm <= 524287)
+    {
+        if (Dst != Src)
+        {
+            Move(Dst, Src);
+        }
+        Emit(FInstruction::MakeImm(EOpCode::AddImmWide, Dst, Imm));
+    }
+    else if (Dst != Src)
+    {
+        LoadConst(Dst, Imm);
+        Add(Dst, Src, Dst);
+    }
+    else
+    {
+        check(Dst != Reg::Temp);
+        LoadConst(Reg::Temp, Imm);
+        Add(Dst, Dst, Reg::Temp);
+    }
     return *this;
 }
 
@@ -323,6 +442,41 @@ FFlowBuilder& FFlowBuilder::GetDistance(RegisterIndex Dst, RegisterIndex Entity1
     return *this;
 }
 
+// ============================================================================
+// Vector
+// ============================================================================
+
+FFlowBuilder& FFlowBuilder::Vec3Add(RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase)
+{
+    Emit(FInstruction::Make(EOpCode::Vec3Add, DstBase, ABase, BBase, 0));
+    return *this;
+}
+
+FFlowBuilder& FFlowBuilder::Vec3Sub(RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase)
+{
+    Emit(FInstruction::Make(EOpCode::Vec3Sub, DstBase, ABase, BBase, 0));
+    return *this;
+}
+
+FFlowBuilder& FFlowBuilder::Vec3Scale(RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex Scalar)
+{
+    Emit(FInstruction::Make(EOpCode::Vec3Scale, DstBase, ABase, Scalar, 0));
+    return *this;
+}
+
+FFlowBuilder& FFlowBuilder::Vec3DistSq(RegisterIndex Dst, RegisterIndex ABase, RegisterIndex BBase)
+{
+    Emit(FInstruction::Make(EOpCode::Vec3DistSq, Dst, ABase, BBase, 0));
+    return *this;
+}
+
+FFlowBuilder& FFlowBuilder::Vec3Toward(RegisterIndex DstBase, RegisterIndex FromBase, RegisterIndex ToBase, int32 LengthCm)
+{
+    check(LengthCm >= 0 && LengthCm <= 0xFFF);
+    Emit(FInstruction::Make(EOpCode::Vec3Toward, DstBase, FromBase, ToBase, LengthCm & 0xFFF));
+    return *this;
+}
+
 // ============================================================================
 // Spatial Query
 // ============================================================================
@@ -333,6 +487,13 @@ FFlowBuilder& FFlowBuilder::FindInRadius(RegisterIndex CenterEntity, int32 Radiu
     return *this;
 }
 
+FFlowBuilder& FFlowBuilder::FindNearest(RegisterIndex CenterEntity, int32 K, int32 RadiusCm)
+{
+    check(K >= 1 && K <= 15);
+    Emit(FInstruction::Make(EOpCode::FindNearest, Reg::Count, CenterEntity, K & 0xF, RadiusCm & 0xFFF));
+    return *this;
+}
+
 FFlowBuilder& FFlowBuilder::NextFound()
 {
     Emit(FInstruction::Make(EOpCode::NextFound, Reg::Iter, 0, 0, 0));
@@ -340,6 +501,22 @@ FFlowBuilder& FFlowBuilder::NextFound()
 }
 
 FFlowBuilder& FFlowBuilder::ForEachInRadius(RegisterIndex CenterEntity, int32 RadiusCm)
+{
+    // FindInRadius(Center, Radius) → Count
+    FindInRadius(CenterEntity, RadiusCm);
+    BeginForEachLoop();
+    return *this;
+}
+
+FFlowBuilder& FFlowBuilder::ForEachNearest(RegisterIndex CenterEntity, int32 K, int32 RadiusCm)
+{
+    // FindNearest(Center, K, Radius) → Count
+    FindNearest(CenterEntity, K, RadiusCm);
+    BeginForEachLoop();
+    return *this;
+}
+
+void FFlowBuilder::BeginForEachLoop()
 {
     FForEachContext Ctx;
     Ctx.LoopLabel = FString::Printf(TEXT("__foreach_%d_loop"), ForEachCounter);
@@ -347,9 +524,6 @@ FFlowBuilder& FFlowBuilder::ForEachInRadius(RegisterIndex CenterEntity, int32 Ra
     ForEachCounter++;
     ForEachStack.Push(Ctx);
     
-    // FindInRadius(Center, Radius) → Count
-    FindInRadius(CenterEntity, RadiusCm);
-    
     // Loop:
     Label(Ctx.LoopLabel);
     
@@ -358,8 +532,6 @@ FFlowBuilder& FFlowBuilder::ForEachInRadius(RegisterIndex CenterEntity, int32 Ra
     
     // JumpIfNot Flag, End
     JumpIfNot(Reg::Flag, Ctx.EndLabel);
-    
-    return *this;
 }
 
 FFlowBuilder& FFlowBuilder::EndForEach()
@@ -523,12 +695,30 @@ void FFlowBuilder::ResolveLabels()
 
 FHktVMProgram FFlowBuilder::Build()
 {
-    if (Program.Code.Num() == 0 || Program.Code.Last().GetOpCode() != EOpCode::Halt)
+    if (ForEachStack.Num() > 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Unclosed ForEach (%d) in Flow %s"), ForEachStack.Num(), *Program.Tag.ToString());
+    }
+    
+    // 끝을 가리키는 라벨이 있으면 Halt가 점프 대상이 되도록 추가
+    bool bLabelAtEnd = false;
+    for (const auto& Pair : Labels)
+    {
+        bLabelAtEnd |= (Pair.Value == Program.Code.Num());
+    }
+    
+    if (Program.Code.Num() == 0 || Program.Code.Last().GetOpCode() != EOpCode::Halt || bLabelAtEnd)
     {
         Halt();
     }
     
     ResolveLabels();
+    
+    if (bOptimizeOnBuild)
+    {
+        FHktVMOptimizer::Optimize(Program);
+    }
+    
     return MoveTemp(Program);
 }
 
@@ -2,6 +2,38 @@
 
 #include "CoreMinimal.h"
 #include "HktVMTypes.h"
+#include "HktVMNative.h"
+
+/**
+ * FHktVMEffectSignature - 프로그램이 세계 상태에 미치는 영향 요약 (FHktVMVerifier가 기록)
+ * 
+ * 스케줄러가 VM 간 병렬 실행 가능 여부를 판단하는 데 사용
+ */
+struct FHktVMEffectSignature
+{
+    /** PropertyId별 읽기/쓰기 여부 (암묵적 접근 포함: GetPosition → PosX/Y/Z 등) */
+    TBitArray<> ReadProperties;
+    TBitArray<> WriteProperties;
+    
+    bool bSpawnsEntities = false;
+    bool bDestroysEntities = false;
+    bool bQueriesSpatial = false;
+    bool bYields = false;
+    
+    /** 사용하는 대기 이벤트 (1 << EWaitEventType) */
+    uint8 WaitMask = 0;
+    
+    void Reset();
+    void AddRead(uint16 PropertyId);
+    void AddWrite(uint16 PropertyId);
+    
+    bool ReadsProperty(uint16 PropertyId) const { return ReadProperties.IsValidIndex(PropertyId) && ReadProperties[PropertyId]; }
+    bool WritesProperty(uint16 PropertyId) const { return WriteProperties.IsValidIndex(PropertyId) && WriteProperties[PropertyId]; }
+    bool UsesWait(EWaitEventType Type) const { return (WaitMask & (1u << static_cast<uint8>(Type))) != 0; }
+    
+    /** 동시에 실행하면 결과가 순서에 의존할 수 있는지 (쓰기-읽기/쓰기-쓰기 겹침, 엔티티 생성/제거) */
+    bool ConflictsWith(const FHktVMEffectSignature& Other) const;
+};
 
 /**
  * FHktVMProgram - 컴파일된 바이트코드 프로그램 (불변, 공유 가능)
@@ -14,8 +46,20 @@ struct FHktVMProgram
     TArray<FString> Strings;
     TArray<int32> LineNumbers;
     
+    /** FHktVMVerifier 통과 여부 - 검증된 프로그램만 실행됨 */
+    bool bVerified = false;
+    
+    /** 검증 시 기록된 효과 요약 */
+    FHktVMEffectSignature Effects;
+    
+    /** AOT 네이티브 진입점 (FHktVMNativeRegistry에 같은 바이트코드로 생성된 함수가 있을 때만) */
+    FHktVMNativeFunc NativeEntry = nullptr;
+    
     bool IsValid() const { return Code.Num() > 0; }
     int32 CodeSize() const { return Code.Num(); }
+    
+    /** 상수 풀 인덱스 (없으면 추가) - LoadConstPool 피연산자 */
+    int32 FindOrAddConstant(int32 Value);
 };
 
 /**
@@ -29,6 +73,9 @@ public:
     const FHktVMProgram* FindProgram(const FGameplayTag& Tag) const;
     void RegisterProgram(FHktVMProgram&& Program);
     void Clear();
+    
+    /** 등록된 모든 프로그램 순회 (AOT 코드 생성 등) */
+    void ForEachProgram(TFunctionRef<void(const FHktVMProgram&)> Callback) const;
 
 private:
     FHktVMProgramRegistry() = default;
@@ -111,6 +158,8 @@ public:
     FFlowBuilder& Sub(RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2);
     FFlowBuilder& Mul(RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2);
     FFlowBuilder& Div(RegisterIndex Dst, RegisterIndex Src1, RegisterIndex Src2);
+    
+    /** 12비트를 넘으면 AddImmWide(20비트) 또는 상수 로드 + Add로 분할 */
     FFlowBuilder& AddImm(RegisterIndex Dst, RegisterIndex Src, int32 Imm);
     
     // ========== Comparison ==========
@@ -150,16 +199,36 @@ public:
     /** 거리 계산 */
     FFlowBuilder& GetDistance(RegisterIndex Dst, RegisterIndex Entity1, RegisterIndex Entity2);
     
+    // ========== Vector (레지스터 Base~Base+2) ==========
+    //
+    // 같은 패턴의 스칼라 Add/Sub/Mul 3개는 최적화 패스가 자동으로 Vec3 명령어로 합칩니다.
+    
+    FFlowBuilder& Vec3Add(RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase);
+    FFlowBuilder& Vec3Sub(RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex BBase);
+    
+    /** DstBase = ABase * Scalar (성분별) */
+    FFlowBuilder& Vec3Scale(RegisterIndex DstBase, RegisterIndex ABase, RegisterIndex Scalar);
+    
+    /** Dst = |BBase - ABase|² (int32 포화) - 반경 비교에 sqrt 불필요 */
+    FFlowBuilder& Vec3DistSq(RegisterIndex Dst, RegisterIndex ABase, RegisterIndex BBase);
+    
+    /** DstBase = From → To 방향으로 길이 LengthCm(0~4095)인 벡터 */
+    FFlowBuilder& Vec3Toward(RegisterIndex DstBase, RegisterIndex FromBase, RegisterIndex ToBase, int32 LengthCm);
+    
     // ========== Spatial Query ==========
     
     /** 범위 내 엔티티 검색 시작 */
     FFlowBuilder& FindInRadius(RegisterIndex CenterEntity, int32 RadiusCm);
     
+    /** 범위 내 가까운 순 K개(1~15) 검색 시작 */
+    FFlowBuilder& FindNearest(RegisterIndex CenterEntity, int32 K, int32 RadiusCm);
+    
     /** 다음 검색 결과 → Iter, 끝이면 Flag=0 */
     FFlowBuilder& NextFound();
     
     /** ForEach 편의 메서드 (FindInRadius + 루프) */
     FFlowBuilder& ForEachInRadius(RegisterIndex CenterEntity, int32 RadiusCm);
+    FFlowBuilder& ForEachNearest(RegisterIndex CenterEntity, int32 K, int32 RadiusCm);
     FFlowBuilder& EndForEach();
     
     // ========== Combat ==========
@@ -207,8 +276,12 @@ public:
     
     // ========== Build ==========
     
+    /** 라벨 해석 후 bOptimizeOnBuild이면 peephole 최적화(FHktVMOptimizer) 적용 */
     FHktVMProgram Build();
     void BuildAndRegister();
+    
+    /** false면 최적화 없이 빌드 (최적화 전/후 실행 결과 비교용) */
+    static bool bOptimizeOnBuild;
 
 private:
     explicit FFlowBuilder(const FGameplayTag& Tag);
@@ -217,6 +290,9 @@ private:
     int32 AddString(const FString& Str);
     int32 AddConstant(int32 Value);
     void ResolveLabels();
+    
+    /** 검색 명령어 이후 ForEach 루프 헤더 */
+    void BeginForEachLoop();
 
 private:
     FHktVMProgram Program;
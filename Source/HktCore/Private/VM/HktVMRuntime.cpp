@@ -1,22 +1,41 @@
 #include "HktVMRuntime.h"
 #include "HktVMProgram.h"
 
-FString FHktVMRuntime::GetDebugString() const
+// ============================================================================
+// FHktVMQueryArena
+// ============================================================================
+
+EntityId* FHktVMQueryArena::Allocate(int32 Count)
 {
-    const TCHAR* StatusNames[] = {
-        TEXT("Ready"), TEXT("Running"), TEXT("Yielded"), 
-        TEXT("WaitingEvent"), TEXT("Completed"), TEXT("Failed")
-    };
+    if (Count <= 0)
+        return nullptr;
     
-    return FString::Printf(
-        TEXT("[VM] Tag=%s PC=%d Status=%s Self=%d Target=%d Spawned=%d"),
-        Program ? *Program->Tag.ToString() : TEXT("null"),
-        PC,
-        StatusNames[static_cast<int32>(Status)],
-        Registers[Reg::Self],
-        Registers[Reg::Target],
-        Registers[Reg::Spawned]
-    );
+    FScopeLock ScopeLock(&Lock);
+    
+    // 현재 블록에 자리가 없으면 다음 블록 (Reset 후 재사용, 부족하면 추가)
+    while (CurrentBlock < Blocks.Num() && BlockOffset + Count > Blocks[CurrentBlock].Num())
+    {
+        ++CurrentBlock;
+        BlockOffset = 0;
+    }
+    if (CurrentBlock == Blocks.Num())
+    {
+        Blocks.AddDefaulted_GetRef().SetNumUninitialized(FMath::Max(Count, EntitiesPerBlock));
+        BlockOffset = 0;
+    }
+    
+    EntityId* Result = Blocks[CurrentBlock].GetData() + BlockOffset;
+    BlockOffset += Count;
+    NumAllocated += Count;
+    return Result;
+}
+
+void FHktVMQueryArena::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+    CurrentBlock = 0;
+    BlockOffset = 0;
+    NumAllocated = 0;
 }
 
 // ============================================================================
@@ -25,40 +44,67 @@ FString FHktVMRuntime::GetDebugString() const
 
 FHktVMRuntimePool::FHktVMRuntimePool()
 {
-    Statuses.SetNumZeroed(MaxVMs);
-    PCs.SetNumZeroed(MaxVMs);
-    WaitFrames.SetNumZeroed(MaxVMs);
-    Generations.SetNumZeroed(MaxVMs);
-    Runtimes.SetNum(MaxVMs);
+    Grow(SlotsPerChunk);
+}
+
+void FHktVMRuntimePool::Grow(int32 NewCapacity)
+{
+    const int32 OldCapacity = Capacity();
+    NewCapacity = FMath::Min(Align(NewCapacity, SlotsPerChunk), MaxVMs);
+    if (NewCapacity <= OldCapacity)
+        return;
+    
+    const int32 Added = NewCapacity - OldCapacity;
+    Runtimes.Add(Added);
+    Statuses.SetNum(NewCapacity);
+    Generations.SetNumZeroed(NewCapacity);
     
-    FreeSlots.Reserve(MaxVMs);
-    for (int32 i = MaxVMs - 1; i >= 0; --i)
+    // 새 슬롯은 낮은 인덱스부터 할당되도록 기존 빈 슬롯 아래에 역순으로 쌓음
+    TArray<uint32> NewSlots;
+    NewSlots.Reserve(Added + FreeSlots.Num());
+    for (int32 i = NewCapacity - 1; i >= OldCapacity; --i)
     {
-        FreeSlots.Add(i);
+        NewSlots.Add(i);
         Statuses[i] = EVMStatus::Completed;
     }
+    NewSlots.Append(FreeSlots);
+    FreeSlots = MoveTemp(NewSlots);
+}
+
+void FHktVMRuntimePool::Reserve(int32 NumVMs)
+{
+    Grow(FMath::Min(NumVMs, MaxCapacity));
+}
+
+void FHktVMRuntimePool::SetMaxCapacity(int32 InMaxCapacity)
+{
+    MaxCapacity = FMath::Clamp(InMaxCapacity, 1, MaxVMs);
 }
 
 FHktVMHandle FHktVMRuntimePool::Allocate()
 {
-    if (FreeSlots.Num() == 0)
+    if (!CanAllocate())
         return FHktVMHandle::Invalid();
     
+    if (FreeSlots.Num() == 0)
+    {
+        Grow(Capacity() + SlotsPerChunk);
+    }
+    
     uint32 Index = FreeSlots.Pop();
+    ++NumAllocated;
     
     FHktVMHandle Handle;
     Handle.Index = Index;
     Handle.Generation = Generations[Index];
     
     Statuses[Index] = EVMStatus::Ready;
-    PCs[Index] = 0;
-    WaitFrames[Index] = 0;
     
     FHktVMRuntime& Runtime = Runtimes[Index];
     Runtime.Program = nullptr;
     Runtime.Store = nullptr;
     Runtime.PC = 0;
-    Runtime.Status = EVMStatus::Ready;
+    Runtime.SlotIndex = Index;
     Runtime.CreationFrame = 0;
     Runtime.WaitFrames = 0;
     Runtime.EventWait.Reset();
@@ -77,6 +123,7 @@ void FHktVMRuntimePool::Free(FHktVMHandle Handle)
     Generations[Index]++;
     Statuses[Index] = EVMStatus::Completed;
     FreeSlots.Add(Index);
+    --NumAllocated;
 }
 
 FHktVMRuntime* FHktVMRuntimePool::Get(FHktVMHandle Handle)
@@ -95,15 +142,37 @@ const FHktVMRuntime* FHktVMRuntimePool::Get(FHktVMHandle Handle) const
 
 bool FHktVMRuntimePool::IsValid(FHktVMHandle Handle) const
 {
-    if (!Handle.IsValid() || Handle.Index >= static_cast<uint32>(MaxVMs))
+    if (!Handle.IsValid() || Handle.Index >= static_cast<uint32>(Capacity()))
         return false;
     return Generations[Handle.Index] == Handle.Generation;
 }
 
+FString FHktVMRuntimePool::GetDebugString(FHktVMHandle Handle) const
+{
+    const TCHAR* StatusNames[] = {
+        TEXT("Ready"), TEXT("Running"), TEXT("Yielded"), 
+        TEXT("WaitingEvent"), TEXT("PendingSpawn"), TEXT("Completed"), TEXT("Failed")
+    };
+    
+    const FHktVMRuntime* Runtime = Get(Handle);
+    if (!Runtime)
+        return TEXT("[VM] invalid handle");
+    
+    return FString::Printf(
+        TEXT("[VM] Tag=%s PC=%d Status=%s Self=%d Target=%d Spawned=%d"),
+        Runtime->Program ? *Runtime->Program->Tag.ToString() : TEXT("null"),
+        Runtime->PC,
+        StatusNames[static_cast<int32>(Statuses[Handle.Index])],
+        Runtime->Registers[Reg::Self],
+        Runtime->Registers[Reg::Target],
+        Runtime->Registers[Reg::Spawned]
+    );
+}
+
 int32 FHktVMRuntimePool::CountByStatus(EVMStatus Status) const
 {
     int32 Count = 0;
-    for (int32 i = 0; i < Runtimes.Num(); ++i)
+    for (int32 i = 0; i < Capacity(); ++i)
     {
         if (Statuses[i] == Status)
             Count++;
@@ -114,7 +183,8 @@ int32 FHktVMRuntimePool::CountByStatus(EVMStatus Status) const
 void FHktVMRuntimePool::Reset()
 {
     FreeSlots.Reset();
-    for (int32 i = MaxVMs - 1; i >= 0; --i)
+    NumAllocated = 0;
+    for (int32 i = Capacity() - 1; i >= 0; --i)
     {
         FreeSlots.Add(i);
         Statuses[i] = EVMStatus::Completed;
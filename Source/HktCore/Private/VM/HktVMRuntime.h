@@ -2,28 +2,34 @@
 
 #include "CoreMinimal.h"
 #include "HktVMTypes.h"
+#include "Containers/ChunkedArray.h"
 
 // Forward declarations
 struct FHktVMProgram;
 struct FHktVMStore;
 
 /**
- * FSpatialQueryResult - 공간 검색 결과 저장
+ * FSpatialQueryResult - 공간 검색 결과 (FHktVMQueryArena의 구간)
+ *
+ * 결과는 VM마다 힙 배열을 두지 않고 프레임 아레나에 저장합니다.
+ * 프레임이 끝날 때 순회 중인 결과만 다음 프레임 아레나로 옮겨집니다.
  */
 struct FSpatialQueryResult
 {
-    TArray<EntityId> Entities;
+    const EntityId* Entities = nullptr;
+    int32 Num = 0;
     int32 CurrentIndex = 0;
     
     void Reset()
     {
-        Entities.Reset();
+        Entities = nullptr;
+        Num = 0;
         CurrentIndex = 0;
     }
     
     bool HasNext() const
     {
-        return CurrentIndex < Entities.Num();
+        return CurrentIndex < Num;
     }
     
     EntityId Next()
@@ -36,6 +42,36 @@ struct FSpatialQueryResult
     }
 };
 
+/**
+ * FHktVMQueryArena - 공간 검색 결과용 선형 할당기
+ *
+ * 블록 단위로 커지고 Reset은 블록을 유지한 채 처음부터 다시 씁니다.
+ * 라운드 중 여러 워커가 동시에 검색하므로 Allocate만 잠금으로 보호합니다
+ * (결과 수집은 잠금 밖에서, 복사만 확보한 구간에).
+ */
+class HKTCORE_API FHktVMQueryArena
+{
+public:
+    /** 블록당 엔티티 수 (더 큰 요청은 전용 크기의 블록) */
+    static constexpr int32 EntitiesPerBlock = 4096;
+    
+    /** Count개 연속 슬롯 확보 (다음 Reset까지 유효) */
+    EntityId* Allocate(int32 Count);
+    
+    /** 모든 구간 해제 (블록 메모리는 유지) */
+    void Reset();
+    
+    /** 사용 중인 엔티티 수 (통계용) */
+    int32 NumUsed() const { return NumAllocated; }
+
+private:
+    FCriticalSection Lock;
+    TArray<TArray<EntityId>> Blocks;
+    int32 CurrentBlock = 0;
+    int32 BlockOffset = 0;
+    int32 NumAllocated = 0;
+};
+
 /**
  * FEventWaitState - 이벤트 대기 상태
  */
@@ -43,18 +79,38 @@ struct FEventWaitState
 {
     EWaitEventType Type = EWaitEventType::None;
     EntityId WatchedEntity = InvalidEntityId;
-    float RemainingTime = 0.0f;  // Timer용
     
     void Reset()
     {
         Type = EWaitEventType::None;
         WatchedEntity = InvalidEntityId;
-        RemainingTime = 0.0f;
     }
 };
 
 /**
- * FHktVMRuntime - 단일 VM의 실행 상태
+ * FPendingSpawn - 할당 대기 중인 엔티티 생성 요청 (Status == PendingSpawn)
+ *
+ * 스레드/실행 순서와 무관한 ID를 위해 FHktVMProcessor가 라운드 사이에
+ * 슬롯 순서대로 할당하고 Reg::Spawned에 기록합니다.
+ */
+struct FPendingSpawn
+{
+    EntityId Owner = InvalidEntityId;
+    int32 EntityType = 0;
+    
+    void Reset()
+    {
+        Owner = InvalidEntityId;
+        EntityType = 0;
+    }
+};
+
+/**
+ * FHktVMRuntime - 단일 VM의 실행 컨텍스트 (콜드 블록)
+ *
+ * 인터프리터가 실행 중에만 만지는 상태 (PC, 레지스터, 대기/생성 요청, 검색 결과)입니다.
+ * 스케줄링에 쓰는 VM 상태(EVMStatus)는 FHktVMRuntimePool의 상태 열에만 있으므로
+ * 풀/AwakeVMs 순회는 Runtime을 읽지 않습니다.
  */
 struct HKTCORE_API FHktVMRuntime
 {
@@ -70,13 +126,13 @@ struct HKTCORE_API FHktVMRuntime
     /** 범용 레지스터 (R0-R15) */
     int32 Registers[MaxRegisters] = {0};
     
-    /** 현재 상태 */
-    EVMStatus Status = EVMStatus::Ready;
+    /** 풀 슬롯 인덱스 (FHktVMHandle::Index, 트레이스 기록용) */
+    uint32 SlotIndex = 0xFFFFFF;
     
     /** 생성 프레임 */
     int32 CreationFrame = 0;
     
-    /** Yield 후 대기 프레임 수 */
+    /** Yield / WaitSeconds 후 대기 프레임 수 (재개 시 타이밍 휠에 등록) */
     int32 WaitFrames = 0;
     
     /** 이벤트 대기 상태 */
@@ -84,6 +140,12 @@ struct HKTCORE_API FHktVMRuntime
     
     /** 공간 검색 결과 (FindInRadius) */
     FSpatialQueryResult SpatialQuery;
+    
+    /** 엔티티 생성 요청 (SpawnEntity/SpawnEquipment) */
+    FPendingSpawn PendingSpawn;
+
+    /** 마지막으로 멈춘 뒤 Store.PendingDestroys에 제거를 기록했는지 (프로세서가 제거 목록에 옮기며 지움) */
+    bool bRecordedDestroy = false;
 
 #if !UE_BUILD_SHIPPING
     /** 디버그용: 이 VM을 생성한 이벤트 ID (HktInsights 추적용) */
@@ -91,16 +153,17 @@ struct HKTCORE_API FHktVMRuntime
 #endif
     
     // ========== 레지스터 헬퍼 ==========
+    // 인덱스 범위는 FHktVMVerifier가 로드 시점에 보장 (검증된 프로그램만 실행됨)
     
     int32 GetReg(RegisterIndex Idx) const 
     { 
-        check(Idx < MaxRegisters);
+        checkSlow(Idx < MaxRegisters);
         return Registers[Idx]; 
     }
     
     void SetReg(RegisterIndex Idx, int32 Value) 
     { 
-        check(Idx < MaxRegisters);
+        checkSlow(Idx < MaxRegisters);
         Registers[Idx] = Value; 
     }
     
@@ -124,32 +187,30 @@ struct HKTCORE_API FHktVMRuntime
     {
         Registers[Idx] = static_cast<int32>(Entity);
     }
-    
-    // ========== 상태 검사 ==========
-    
-    bool IsRunnable() const 
-    { 
-        return Status == EVMStatus::Ready || Status == EVMStatus::Running; 
-    }
-    
-    bool IsYielded() const { return Status == EVMStatus::Yielded; }
-    bool IsWaitingEvent() const { return Status == EVMStatus::WaitingEvent; }
-    bool IsCompleted() const { return Status == EVMStatus::Completed; }
-    bool IsFailed() const { return Status == EVMStatus::Failed; }
-    bool IsTerminated() const { return IsCompleted() || IsFailed(); }
-    
-    // ========== 디버그 ==========
-    
-    FString GetDebugString() const;
 };
 
 // ============================================================================
-// FHktVMRuntimePool - SOA 레이아웃의 런타임 풀
+// FHktVMRuntimePool - 청크 단위로 확장되는 런타임 풀
 // ============================================================================
 
+/**
+ * 핫/콜드 분리:
+ * - 상태/세대는 슬롯 인덱스로 접근하는 SOA 열 (스케줄링 순회는 이 열만 읽음)
+ * - FHktVMRuntime(PC, 레지스터, 검색 결과)은 별도 청크 블록 (실행할 VM만 접근)
+ *
+ * Runtime은 청크(TChunkedArray)에 저장되어 풀이 커져도 주소가 유지됩니다.
+ * 슬롯이 부족하면 SlotsPerChunk개씩 늘어나며, 최대 용량은 FHktVMHandle의
+ * 24비트 인덱스 전체(MaxVMs) 또는 SetMaxCapacity로 지정한 값입니다.
+ */
 class HKTCORE_API FHktVMRuntimePool
 {
 public:
+    /** 핸들 인덱스 공간 (24비트, 0xFFFFFF는 Invalid) */
+    static constexpr int32 MaxVMs = 0xFFFFFF;
+    
+    /** 한 번에 늘리는 슬롯 수 */
+    static constexpr int32 SlotsPerChunk = 256;
+    
     FHktVMRuntimePool();
     
     FHktVMHandle Allocate();
@@ -160,21 +221,65 @@ public:
     
     bool IsValid(FHktVMHandle Handle) const;
     
+    // ========== 상태 열 ==========
+    
+    /** VM 상태 (무효 핸들은 Failed) */
+    EVMStatus GetStatus(FHktVMHandle Handle) const
+    {
+        return IsValid(Handle) ? Statuses[Handle.Index] : EVMStatus::Failed;
+    }
+    
+    /** 유효한 핸들의 상태 변경 (서로 다른 슬롯은 워커 스레드에서 동시에 변경 가능) */
+    void SetStatus(FHktVMHandle Handle, EVMStatus Status)
+    {
+        checkSlow(IsValid(Handle));
+        Statuses[Handle.Index] = Status;
+    }
+    
+    static bool IsRunnable(EVMStatus Status)
+    {
+        return Status == EVMStatus::Ready || Status == EVMStatus::Running;
+    }
+    
+    static bool IsTerminated(EVMStatus Status)
+    {
+        return Status == EVMStatus::Completed || Status == EVMStatus::Failed;
+    }
+    
+    FString GetDebugString(FHktVMHandle Handle) const;
+    
     template<typename Func>
     void ForEachActive(Func&& Callback);
     
     int32 CountByStatus(EVMStatus Status) const;
     void Reset();
+    
+    /** 최소 NumVMs개 슬롯을 미리 확보 (전투 시작 전 프레임 스파이크 방지) */
+    void Reserve(int32 NumVMs);
+    
+    /** 동시 VM 수 상한 (이미 확보된 슬롯보다 작게 하면 새 할당만 제한) */
+    void SetMaxCapacity(int32 InMaxCapacity);
+    int32 GetMaxCapacity() const { return MaxCapacity; }
+    
+    /** 확보된 슬롯 수 (유효한 Handle.Index < Capacity) */
+    int32 Capacity() const { return Runtimes.Num(); }
+    
+    int32 NumActive() const { return NumAllocated; }
+    bool CanAllocate() const { return NumAllocated < FMath::Min(MaxCapacity, MaxVMs); }
 
 private:
-    static constexpr int32 MaxVMs = 256;
+    void Grow(int32 NewCapacity);
     
+    // 핫: 슬롯별 SOA 열
     TArray<EVMStatus> Statuses;
-    TArray<int32> PCs;
-    TArray<int32> WaitFrames;
     TArray<uint8> Generations;
-    TArray<FHktVMRuntime> Runtimes;
+    
+    // 콜드: 실행 컨텍스트
+    TChunkedArray<FHktVMRuntime> Runtimes;
     TArray<uint32> FreeSlots;
+    
+    int32 MaxCapacity = MaxVMs;
+    int32 NumAllocated = 0;
 };
 
 // ============================================================================
@@ -186,8 +291,7 @@ void FHktVMRuntimePool::ForEachActive(Func&& Callback)
 {
     for (int32 i = 0; i < Runtimes.Num(); ++i)
     {
-        EVMStatus S = Statuses[i];
-        if (S != EVMStatus::Completed && S != EVMStatus::Failed)
+        if (!IsTerminated(Statuses[i]))
         {
             FHktVMHandle Handle;
             Handle.Index = i;
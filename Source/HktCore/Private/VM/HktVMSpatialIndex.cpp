@@ -0,0 +1,198 @@
+#include "HktVMSpatialIndex.h"
+
+// ============================================================================
+// 빌드
+// ============================================================================
+
+void FHktVMSpatialIndex::SetCellSize(int32 InCellSizeCm)
+{
+    CellSizeCm = FMath::Max(1, InCellSizeCm);
+    Invalidate();
+}
+
+int32 FHktVMSpatialIndex::ToCell(int32 Coord) const
+{
+    // 음수 좌표도 내림 (C++ 나눗셈은 0 방향 절사)
+    const int32 Q = Coord / CellSizeCm;
+    return (Coord % CellSizeCm < 0) ? Q - 1 : Q;
+}
+
+uint32 FHktVMSpatialIndex::HashCell(int32 CellX, int32 CellY)
+{
+    const uint32 H = static_cast<uint32>(CellX) * 0x9E3779B1u ^ static_cast<uint32>(CellY) * 0x85EBCA77u;
+    return (H ^ (H >> 15)) & (NumBuckets - 1);
+}
+
+FHktVMSpatialIndex::FEntry FHktVMSpatialIndex::MakeEntry(EntityId Entity) const
+{
+    FEntry Entry;
+    Entry.X = Stash.GetProperty(Entity, PropertyId::PosX);
+    Entry.Y = Stash.GetProperty(Entity, PropertyId::PosY);
+    Entry.Z = Stash.GetProperty(Entity, PropertyId::PosZ);
+    Entry.Team = Stash.GetProperty(Entity, PropertyId::Team);
+    Entry.CellX = ToCell(Entry.X);
+    Entry.CellY = ToCell(Entry.Y);
+    Entry.Entity = Entity;
+    return Entry;
+}
+
+void FHktVMSpatialIndex::EnsureBuilt()
+{
+    if (bBuilt.load(std::memory_order_acquire))
+        return;
+
+    FScopeLock Lock(&BuildLock);
+    if (!bBuilt.load(std::memory_order_relaxed))
+    {
+        Build();
+        bBuilt.store(true, std::memory_order_release);
+    }
+}
+
+void FHktVMSpatialIndex::Build()
+{
+    LateEntries.Reset();
+    Entries.Reset();
+    BucketStart.Init(0, NumBuckets + 1);
+
+    if (!Stash)
+        return;
+
+    // 슬롯 오름차순으로 읽고 버킷별 counting sort (버킷 내 슬롯 순서 유지)
+    TArray<FEntry>& Unsorted = BuildScratch;
+    Unsorted.Reset();
+    Stash.ForEachEntity([this, &Unsorted](FHktEntityId Entity)
+    {
+        Unsorted.Add(MakeEntry(Entity));
+    });
+
+    for (const FEntry& Entry : Unsorted)
+    {
+        ++BucketStart[HashCell(Entry.CellX, Entry.CellY) + 1];
+    }
+    for (int32 b = 0; b < NumBuckets; ++b)
+    {
+        BucketStart[b + 1] += BucketStart[b];
+    }
+
+    BuildCursor = BucketStart;
+    Entries.SetNumUninitialized(Unsorted.Num());
+    for (const FEntry& Entry : Unsorted)
+    {
+        Entries[BuildCursor[HashCell(Entry.CellX, Entry.CellY)]++] = Entry;
+    }
+}
+
+void FHktVMSpatialIndex::AddEntity(EntityId Entity)
+{
+    if (!bBuilt.load(std::memory_order_relaxed) || !Stash.IsValidEntity(Entity))
+        return;
+
+    LateEntries.Add(MakeEntry(Entity));
+}
+
+// ============================================================================
+// 검색
+// ============================================================================
+
+template<typename Func>
+void FHktVMSpatialIndex::ForEachCandidate(const FIntVector& Center, int32 RadiusCm, const FHktVMSpatialFilter& Filter, Func&& Callback) const
+{
+    const int64 RadiusSq = static_cast<int64>(RadiusCm) * RadiusCm;
+
+    auto Test = [&](const FEntry& Entry)
+    {
+        if (Entry.Entity == Filter.ExcludeEntity || !Filter.PassesTeam(Entry.Team))
+            return;
+
+        const int64 DX = Entry.X - Center.X;
+        const int64 DY = Entry.Y - Center.Y;
+        const int64 DZ = Entry.Z - Center.Z;
+        const int64 DistSq = DX*DX + DY*DY + DZ*DZ;
+        if (DistSq <= RadiusSq)
+        {
+            Callback(Entry.Entity, DistSq);
+        }
+    };
+
+    const int32 MinCX = ToCell(Center.X - RadiusCm);
+    const int32 MaxCX = ToCell(Center.X + RadiusCm);
+    const int32 MinCY = ToCell(Center.Y - RadiusCm);
+    const int32 MaxCY = ToCell(Center.Y + RadiusCm);
+    const int64 NumCells = static_cast<int64>(MaxCX - MinCX + 1) * (MaxCY - MinCY + 1);
+
+    if (NumCells * 4 > Entries.Num())
+    {
+        // 덮는 셀이 엔티티 수에 비해 많으면 전체 순회가 더 저렴 (버킷 순 - 결과 순서는 호출자가 정렬)
+        for (const FEntry& Entry : Entries)
+        {
+            Test(Entry);
+        }
+    }
+    else
+    {
+        for (int32 CY = MinCY; CY <= MaxCY; ++CY)
+        {
+            for (int32 CX = MinCX; CX <= MaxCX; ++CX)
+            {
+                const uint32 Bucket = HashCell(CX, CY);
+                for (int32 i = BucketStart[Bucket]; i < BucketStart[Bucket + 1]; ++i)
+                {
+                    // 해시 충돌로 같은 버킷에 있는 다른 셀은 건너뜀 (중복 방지)
+                    if (Entries[i].CellX == CX && Entries[i].CellY == CY)
+                    {
+                        Test(Entries[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    for (const FEntry& Entry : LateEntries)
+    {
+        Test(Entry);
+    }
+}
+
+void FHktVMSpatialIndex::FindInRadius(const FIntVector& Center, int32 RadiusCm, const FHktVMSpatialFilter& Filter, TArray<EntityId>& Out) const
+{
+    Out.Reset();
+    ForEachCandidate(Center, RadiusCm, Filter, [&Out](EntityId Entity, int64)
+    {
+        Out.Add(Entity);
+    });
+
+    // 셀 순서 → 슬롯 인덱스 오름차순 (결정론, Stash ForEachEntity와 같은 순서)
+    // RawValue는 상위 비트가 세대라 슬롯 재사용 이력에 따라 순서가 달라지므로 쓰지 않음
+    Out.Sort([](const EntityId& A, const EntityId& B) { return A.GetIndex() < B.GetIndex(); });
+}
+
+void FHktVMSpatialIndex::FindNearest(const FIntVector& Center, int32 RadiusCm, int32 K, const FHktVMSpatialFilter& Filter, TArray<EntityId>& Out) const
+{
+    struct FCandidate
+    {
+        int64 DistSq;
+        EntityId Entity;
+
+        bool operator<(const FCandidate& Other) const
+        {
+            return DistSq != Other.DistSq ? DistSq < Other.DistSq : Entity.GetIndex() < Other.Entity.GetIndex();
+        }
+    };
+
+    Out.Reset();
+
+    thread_local TArray<FCandidate> Candidates;
+    Candidates.Reset();
+    ForEachCandidate(Center, RadiusCm, Filter, [](EntityId Entity, int64 DistSq)
+    {
+        Candidates.Add({ DistSq, Entity });
+    });
+
+    Candidates.Sort();
+    const int32 Count = FMath::Min(K, Candidates.Num());
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Out.Add(Candidates[i].Entity);
+    }
+}
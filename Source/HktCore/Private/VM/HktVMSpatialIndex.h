@@ -0,0 +1,120 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktVMTypes.h"
+#include "HktVMStashReader.h"
+#include <atomic>
+
+/**
+ * FHktVMSpatialFilter - 공간 검색 필터 (인덱스 안에서 거리 검사 전에 적용)
+ */
+struct FHktVMSpatialFilter
+{
+    enum class ETeam : uint8
+    {
+        Any,        // 팀 무시
+        Enemies,    // Team != TeamValue
+        Allies,     // Team == TeamValue
+    };
+
+    /** 결과에서 제외할 엔티티 (보통 검색 중심) */
+    EntityId ExcludeEntity = InvalidEntityId;
+
+    ETeam TeamMode = ETeam::Any;
+    int32 TeamValue = 0;
+
+    bool PassesTeam(int32 Team) const
+    {
+        switch (TeamMode)
+        {
+        case ETeam::Enemies: return Team != TeamValue;
+        case ETeam::Allies:  return Team == TeamValue;
+        default:             return true;
+        }
+    }
+};
+
+// ============================================================================
+// FHktVMSpatialIndex - 프레임 단위 균일 격자
+// ============================================================================
+
+/**
+ * VM 공간 검색(FindInRadius/FindNearest)이 공유하는 가속 구조
+ *
+ * Execute 동안 Stash는 읽기 전용이므로, 프레임의 첫 검색에서 모든 엔티티의
+ * 위치/팀을 한 번 읽어 XY 격자로 정렬해 두고 이후 검색은 덮는 셀만 확인합니다.
+ * (검색마다 엔티티 전체 × GetProperty 가상 호출 4회 → 프레임당 1회)
+ *
+ * - Invalidate: Execute 시작 시 (게임 스레드)
+ * - EnsureBuilt: 검색 시 워커 스레드에서 호출, 첫 호출만 빌드
+ * - AddEntity: 라운드 사이 생성된 엔티티 추가 (게임 스레드, 검색이 없는 시점)
+ *
+ * 결과는 슬롯 인덱스 오름차순 (FindNearest는 거리, 슬롯 순)이므로 격자 구성/세대와 무관합니다.
+ */
+class HKTCORE_API FHktVMSpatialIndex
+{
+public:
+    /** 격자 셀 크기 (cm) - 일반적인 범위 스킬 반경과 비슷하게 */
+    static constexpr int32 DefaultCellSizeCm = 512;
+
+    /** 해시 버킷 수 (2의 거듭제곱) */
+    static constexpr int32 NumBuckets = 1024;
+
+    void Initialize(IHktStashInterface* InStash) { Stash.Bind(InStash); Invalidate(); }
+
+    void SetCellSize(int32 InCellSizeCm);
+    int32 GetCellSize() const { return CellSizeCm; }
+
+    /** 다음 검색에서 다시 빌드 */
+    void Invalidate() { bBuilt.store(false, std::memory_order_relaxed); }
+
+    /** 이번 프레임 인덱스가 없으면 Stash에서 빌드 (여러 워커가 동시에 호출 가능) */
+    void EnsureBuilt();
+
+    /** 빌드 이후 생성된 엔티티 반영 (빌드 전이면 무시 - 빌드 시 Stash에서 읽음) */
+    void AddEntity(EntityId Entity);
+
+    /** 중심에서 RadiusCm 이내 (3D 거리) 엔티티를 슬롯 인덱스 오름차순으로 Out에 채움 */
+    void FindInRadius(const FIntVector& Center, int32 RadiusCm, const FHktVMSpatialFilter& Filter, TArray<EntityId>& Out) const;
+
+    /** 반경 내 가까운 순 최대 K개 (같은 거리는 슬롯 인덱스 순) */
+    void FindNearest(const FIntVector& Center, int32 RadiusCm, int32 K, const FHktVMSpatialFilter& Filter, TArray<EntityId>& Out) const;
+
+    /** 인덱스에 있는 엔티티 수 (통계용) */
+    int32 Num() const { return Entries.Num() + LateEntries.Num(); }
+
+private:
+    struct FEntry
+    {
+        int32 X, Y, Z;
+        int32 Team;
+        int32 CellX, CellY;
+        EntityId Entity;
+    };
+
+    void Build();
+    FEntry MakeEntry(EntityId Entity) const;
+    int32 ToCell(int32 Coord) const;
+    static uint32 HashCell(int32 CellX, int32 CellY);
+
+    /** 필터/거리를 통과한 (거리², 엔티티) 후보 수집 - 격자 경로는 순서가 섞임 */
+    template<typename Func>
+    void ForEachCandidate(const FIntVector& Center, int32 RadiusCm, const FHktVMSpatialFilter& Filter, Func&& Callback) const;
+
+    FHktVMStashReader Stash;
+    int32 CellSizeCm = DefaultCellSizeCm;
+
+    /** 버킷 순으로 정렬된 엔티티 (버킷 내에서는 슬롯 오름차순) */
+    TArray<FEntry> Entries;
+    TArray<int32> BucketStart;
+
+    /** 빌드 이후 추가된 엔티티 (검색 시 선형 확인) */
+    TArray<FEntry> LateEntries;
+
+    /** 빌드용 재사용 버퍼 */
+    TArray<FEntry> BuildScratch;
+    TArray<int32> BuildCursor;
+
+    std::atomic<bool> bBuilt{ false };
+    FCriticalSection BuildLock;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktCoreInterfaces.h"
+#include "HktStash.h"
+
+/**
+ * FHktVMStashReader - VM의 Stash 읽기 경로 (Internal)
+ *
+ * 프로세서의 Stash는 항상 FHktMasterStash(서버) 또는 FHktVisibleStash(클라이언트)이고
+ * 둘 다 FHktStashBase의 SOA 열을 가지므로, Bind 시 한 번 GetStorage()로 저장소를 얻어
+ * 이후 읽기는 가상 호출 없이 인라인 열 인덱싱으로 처리합니다.
+ * 저장소가 없는 외부 구현은 IHktStashInterface 가상 호출로 동작합니다.
+ */
+struct FHktVMStashReader
+{
+    IHktStashInterface* Stash = nullptr;
+    const FHktStashBase* Storage = nullptr;
+
+    void Bind(IHktStashInterface* InStash)
+    {
+        Stash = InStash;
+        Storage = InStash ? InStash->GetStorage() : nullptr;
+    }
+
+    explicit operator bool() const { return Stash != nullptr; }
+
+    FORCEINLINE int32 GetProperty(FHktEntityId Entity, uint16 PropertyId) const
+    {
+        if (Storage)
+            return Storage->GetProperty(Entity, PropertyId);
+        return Stash ? Stash->GetProperty(Entity, PropertyId) : 0;
+    }
+
+    FORCEINLINE bool IsValidEntity(FHktEntityId Entity) const
+    {
+        if (Storage)
+            return Storage->IsValidEntity(Entity);
+        return Stash && Stash->IsValidEntity(Entity);
+    }
+
+    void ForEachEntity(TFunctionRef<void(FHktEntityId)> Callback) const
+    {
+        if (Storage)
+            Storage->ForEachEntity(Callback);
+        else if (Stash)
+            Stash->ForEachEntity(Callback);
+    }
+};
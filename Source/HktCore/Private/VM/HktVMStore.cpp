@@ -12,13 +12,13 @@ int32 FHktVMStore::Read(uint16 PropertyId) const
 
 int32 FHktVMStore::ReadEntity(FHktEntityId Entity, uint16 PropertyId) const
 {
-    uint64 Key = MakeCacheKey(Entity, PropertyId);
-    if (const int32* Cached = LocalCache.Find(Key))
+    const FCacheSlot* Slot = FindSlot(MakeCacheKey(Entity, PropertyId));
+    if (Slot && Slot->bVisible)
     {
-        return *Cached;
+        return Slot->Value;
     }
     
-    return Stash ? Stash->GetProperty(Entity, PropertyId) : 0;
+    return Stash.GetProperty(Entity, PropertyId);
 }
 
 void FHktVMStore::Write(uint16 PropertyId, int32 Value)
@@ -28,25 +28,105 @@ void FHktVMStore::Write(uint16 PropertyId, int32 Value)
 
 void FHktVMStore::WriteEntity(FHktEntityId Entity, uint16 PropertyId, int32 Value)
 {
-    uint64 Key = MakeCacheKey(Entity, PropertyId);
-    LocalCache.Add(Key, Value);
-    
-    FPendingWrite W;
-    W.Entity = Entity;
-    W.PropertyId = PropertyId;
-    W.Value = Value;
-    PendingWrites.Add(W);
+    FCacheSlot& Slot = FindOrAddSlot(MakeCacheKey(Entity, PropertyId), Entity, PropertyId);
+    Slot.Value = Value;
+    Slot.bVisible = true;
+    PendingWrites[Slot.WriteIndex].Value = Value;
+}
+
+void FHktVMStore::WriteEntityDeferred(FHktEntityId Entity, uint16 PropertyId, int32 Value)
+{
+    FCacheSlot& Slot = FindOrAddSlot(MakeCacheKey(Entity, PropertyId), Entity, PropertyId);
+    PendingWrites[Slot.WriteIndex].Value = Value;
+}
+
+void FHktVMStore::DestroyEntity(FHktEntityId Entity)
+{
+    PendingDestroys.Add(Entity);
 }
 
 void FHktVMStore::ClearPendingWrites()
 {
     PendingWrites.Reset();
+    ResetCache();
 }
 
 void FHktVMStore::Reset()
 {
-    PendingWrites.Reset();
-    LocalCache.Reset();
+    ClearPendingWrites();
+    PendingDestroys.Reset();
     SourceEntity = InvalidEntityId;
     TargetEntity = InvalidEntityId;
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// 로컬 캐시
+// ============================================================================
+
+const FHktVMStore::FCacheSlot* FHktVMStore::FindSlot(uint64 Key) const
+{
+    if (NumInlineEntries == 0)
+        return nullptr;
+
+    // 삭제가 없으므로 빈 슬롯을 만나면 없는 키
+    for (uint32 i = HashKey(Key);; i = (i + 1) & (CacheCapacity - 1))
+    {
+        const FCacheSlot& Slot = InlineCache[i];
+        if (Slot.Key == Key)
+            return &Slot;
+        if (Slot.Key == EmptyKey)
+            break;
+    }
+    
+    return OverflowCache.Num() > 0 ? OverflowCache.Find(Key) : nullptr;
+}
+
+FHktVMStore::FCacheSlot& FHktVMStore::FindOrAddSlot(uint64 Key, FHktEntityId Entity, uint16 PropertyId)
+{
+    auto InitSlot = [this, Key, Entity, PropertyId](FCacheSlot& Slot)
+    {
+        Slot.Key = Key;
+        Slot.bVisible = false;
+        Slot.WriteIndex = PendingWrites.Num();
+        
+        FPendingWrite& W = PendingWrites.AddDefaulted_GetRef();
+        W.Entity = Entity;
+        W.PropertyId = PropertyId;
+    };
+    
+    uint32 i = HashKey(Key);
+    for (;; i = (i + 1) & (CacheCapacity - 1))
+    {
+        if (InlineCache[i].Key == Key)
+            return InlineCache[i];
+        if (InlineCache[i].Key == EmptyKey)
+            break;
+    }
+    
+    if (FCacheSlot* Overflow = OverflowCache.Num() > 0 ? OverflowCache.Find(Key) : nullptr)
+        return *Overflow;
+    
+    if (NumInlineEntries < MaxInlineEntries)
+    {
+        ++NumInlineEntries;
+        InitSlot(InlineCache[i]);
+        return InlineCache[i];
+    }
+    
+    FCacheSlot& Slot = OverflowCache.Add(Key);
+    InitSlot(Slot);
+    return Slot;
+}
+
+void FHktVMStore::ResetCache()
+{
+    if (NumInlineEntries > 0)
+    {
+        for (FCacheSlot& Slot : InlineCache)
+        {
+            Slot.Key = EmptyKey;
+        }
+        NumInlineEntries = 0;
+    }
+    OverflowCache.Reset();
+}
@@ -2,16 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "HktCoreTypes.h"
-
-// Forward declaration
-class IHktStashInterface;
+#include "HktVMStashReader.h"
 
 /**
  * FHktVMStore - VM의 로컬 데이터 뷰 (Internal)
  * 
  * 읽기: 로컬 캐시 → Stash 순으로 조회
- * 쓰기: 로컬 캐시 + PendingWrites에 기록
+ * 쓰기: 로컬 캐시 + PendingWrites에 기록 (같은 Entity/Property는 한 항목으로 합침, 마지막 값 유지)
  * VM 완료 시 PendingWrites가 Stash에 일괄 적용
+ * 엔티티 제거: PendingDestroys에 기록, Execute 종료 시 슬롯 순서대로 적용
  */
 struct FHktVMStore
 {
@@ -24,25 +23,71 @@ struct FHktVMStore
     void Write(uint16 PropertyId, int32 Value);
     void WriteEntity(FHktEntityId Entity, uint16 PropertyId, int32 Value);
     
-    struct FPendingWrite
-    {
-        FHktEntityId Entity;
-        uint16 PropertyId;
-        int32 Value;
-    };
+    /**
+     * 커밋 전용 쓰기 (SaveStoreEntity 계열)
+     * 이번 VM의 ReadEntity에는 보이지 않고 완료 시 Stash에만 반영 - 합치기는 동일하게 적용
+     */
+    void WriteEntityDeferred(FHktEntityId Entity, uint16 PropertyId, int32 Value);
+    
+    using FPendingWrite = FHktPropertyWrite;
+    
+    /** (Entity, Property)당 한 항목, 처음 쓴 순서 */
     TArray<FPendingWrite> PendingWrites;
     
-    /** 로컬 캐시 (VM 내 읽기/쓰기 일관성) */
-    TMap<uint64, int32> LocalCache;
+    void DestroyEntity(FHktEntityId Entity);
     
+    /** 제거 요청 (Execute 중에는 모든 VM이 같은 엔티티 집합을 보도록 지연) */
+    TArray<FHktEntityId> PendingDestroys;
+    
+    /** PendingWrites와 로컬 캐시 초기화 (캐시가 PendingWrites 인덱스를 가리키므로 함께) */
     void ClearPendingWrites();
     void Reset();
     
-    IHktStashInterface* Stash = nullptr;
+    FHktVMStashReader Stash;
+
+    // ========================================================================
+    // 로컬 캐시 - 고정 크기 open addressing (선형 탐사)
+    // ========================================================================
+
+    /** 인라인 슬롯 수 (2의 거듭제곱) - 일반적인 Flow의 쓰기 집합 크기 */
+    static constexpr int32 CacheCapacity = 64;
+
+    /** 인라인 최대 항목 수 (로드 팩터 3/4), 넘으면 OverflowCache 사용 */
+    static constexpr int32 MaxInlineEntries = CacheCapacity * 3 / 4;
+
+    int32 GetCacheNum() const { return NumInlineEntries + OverflowCache.Num(); }
 
 private:
+    struct FCacheSlot
+    {
+        uint64 Key = EmptyKey;
+        int32 Value = 0;
+        int32 WriteIndex = INDEX_NONE;  // PendingWrites 내 위치
+        bool bVisible = false;          // ReadEntity에 보이는 값이 있는지 (Deferred만 있으면 false)
+    };
+
+    /** 키는 48비트이므로 빈 슬롯 표시와 겹치지 않음 */
+    static constexpr uint64 EmptyKey = ~0ull;
+
     static uint64 MakeCacheKey(FHktEntityId Entity, uint16 PropertyId)
     {
-        return (static_cast<uint64>(Entity.RawValue) << 16) | PropertyId;
+        return (static_cast<uint64>(static_cast<uint32>(Entity.RawValue)) << 16) | PropertyId;
+    }
+
+    static uint32 HashKey(uint64 Key)
+    {
+        // Fibonacci hashing - 상위 비트가 슬롯 인덱스
+        return static_cast<uint32>((Key * 0x9E3779B97F4A7C15ull) >> 58) & (CacheCapacity - 1);
     }
+    static_assert(CacheCapacity == 64, "HashKey shift assumes 64 slots");
+
+    const FCacheSlot* FindSlot(uint64 Key) const;
+    FCacheSlot& FindOrAddSlot(uint64 Key, FHktEntityId Entity, uint16 PropertyId);
+    void ResetCache();
+
+    FCacheSlot InlineCache[CacheCapacity];
+    int32 NumInlineEntries = 0;
+
+    /** 인라인이 가득 찬 뒤의 항목 (드묾) */
+    TMap<uint64, FCacheSlot> OverflowCache;
 };
@@ -0,0 +1,95 @@
+#include "HktVMTimerWheel.h"
+
+FHktVMTimerWheel::FHktVMTimerWheel()
+{
+    Reset();
+}
+
+void FHktVMTimerWheel::Reset(int32 Frame)
+{
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        for (int32 Slot = 0; Slot < SlotsPerLevel; ++Slot)
+        {
+            Slots[Level][Slot].Reset();
+        }
+    }
+    CurrentFrame = Frame;
+    NumTimers = 0;
+}
+
+void FHktVMTimerWheel::Schedule(FHktVMHandle Handle, int32 DeadlineFrame)
+{
+    // 이미 지난 마감은 다음 프레임에 만료
+    Insert({ Handle, FMath::Max(DeadlineFrame, CurrentFrame + 1) });
+    ++NumTimers;
+}
+
+void FHktVMTimerWheel::Insert(const FTimer& Timer)
+{
+    // Delta == 0: cascade 중 이번 프레임에 만료되는 항목 (곧 처리될 레벨 0 슬롯)
+    const int32 Delta = Timer.Deadline - CurrentFrame;
+    check(Delta >= 0);
+
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        const int32 Shift = SlotBits * Level;
+        if (Level == NumLevels - 1 || Delta < (1 << (Shift + SlotBits)))
+        {
+            // 휠 범위를 넘는 마감은 마지막 레벨 끝에 두고 cascade 시 다시 배치
+            const int32 MaxDelta = (1 << (Shift + SlotBits)) - 1;
+            const uint32 Placement = static_cast<uint32>(CurrentFrame + FMath::Min(Delta, MaxDelta));
+            Slots[Level][(Placement >> Shift) & SlotMask].Add(Timer);
+            return;
+        }
+    }
+}
+
+void FHktVMTimerWheel::Cascade(int32 Level)
+{
+    const int32 Slot = (static_cast<uint32>(CurrentFrame) >> (SlotBits * Level)) & SlotMask;
+
+    TArray<FTimer> Timers = MoveTemp(Slots[Level][Slot]);
+    Slots[Level][Slot].Reset();
+
+    for (const FTimer& Timer : Timers)
+    {
+        Insert(Timer);
+    }
+}
+
+void FHktVMTimerWheel::Advance(int32 Frame, TArray<FHktVMHandle>& OutExpired)
+{
+    if (NumTimers == 0)
+    {
+        CurrentFrame = FMath::Max(CurrentFrame, Frame);
+        return;
+    }
+
+    while (CurrentFrame < Frame && NumTimers > 0)
+    {
+        ++CurrentFrame;
+        const uint32 Now = static_cast<uint32>(CurrentFrame);
+
+        // 상위 레벨 구간 경계에 도달하면 위에서부터 한 단계씩 내려보냄
+        int32 TopLevel = 0;
+        while (TopLevel + 1 < NumLevels && (Now & ((1u << (SlotBits * (TopLevel + 1))) - 1)) == 0)
+        {
+            ++TopLevel;
+        }
+        for (int32 Level = TopLevel; Level >= 1; --Level)
+        {
+            Cascade(Level);
+        }
+
+        TArray<FTimer>& Expired = Slots[0][Now & SlotMask];
+        for (const FTimer& Timer : Expired)
+        {
+            OutExpired.Add(Timer.Handle);
+        }
+        NumTimers -= Expired.Num();
+        Expired.Reset();
+    }
+
+    CurrentFrame = FMath::Max(CurrentFrame, Frame);
+}
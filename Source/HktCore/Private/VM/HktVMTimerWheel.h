@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktVMTypes.h"
+
+/**
+ * FHktVMTimerWheel - 프레임 번호 기반 계층형 타이밍 휠
+ *
+ * Yield(N프레임), WaitSeconds(→ 프레임 변환)로 멈춘 VM을 마감 프레임에 깨웁니다.
+ * 레벨 L의 슬롯 하나는 64^L 프레임을 덮으며, 상위 레벨 슬롯은 해당 구간에 진입할 때
+ * 하위 레벨로 재배치(cascade)됩니다. 프레임당 비용은 만료된 항목 수에 비례합니다.
+ *
+ * 시간은 정수 프레임만 사용하므로 서버/클라이언트에서 같은 프레임에 깨어납니다.
+ */
+class FHktVMTimerWheel
+{
+public:
+    FHktVMTimerWheel();
+
+    /** 모든 항목 제거, 현재 프레임 재설정 */
+    void Reset(int32 Frame = 0);
+
+    /** DeadlineFrame에 깨울 VM 등록 (DeadlineFrame <= 현재 프레임이면 다음 Advance에서 만료) */
+    void Schedule(FHktVMHandle Handle, int32 DeadlineFrame);
+
+    /** 현재 프레임을 Frame까지 진행하며 마감된 VM을 OutExpired에 추가 */
+    void Advance(int32 Frame, TArray<FHktVMHandle>& OutExpired);
+
+    int32 GetCurrentFrame() const { return CurrentFrame; }
+    int32 Num() const { return NumTimers; }
+
+private:
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+    static constexpr int32 SlotMask = SlotsPerLevel - 1;
+    static constexpr int32 NumLevels = 4;   // 64^4 프레임 (30Hz 기준 약 6일), 그 이상은 마지막 레벨에서 재배치
+
+    struct FTimer
+    {
+        FHktVMHandle Handle;
+        int32 Deadline;
+    };
+
+    void Insert(const FTimer& Timer);
+    void Cascade(int32 Level);
+
+    TArray<FTimer> Slots[NumLevels][SlotsPerLevel];
+
+    int32 CurrentFrame = 0;
+    int32 NumTimers = 0;
+};
@@ -0,0 +1,263 @@
+#include "HktVMTrace.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+std::atomic<bool> FHktVMTrace::bEnabled{ true };
+std::atomic<int32> FHktVMTrace::CurrentFrame{ 0 };
+
+// ============================================================================
+// 스레드별 링
+// ============================================================================
+
+namespace
+{
+    struct FTraceRing
+    {
+        FHktVMTraceRecord Records[FHktVMTrace::RecordsPerThread];
+        uint64 Written = 0;     // 누적 기록 수 (RecordsPerThread를 넘으면 오래된 것부터 덮어씀)
+        uint32 ThreadId = 0;
+    };
+
+    constexpr uint64 RingMask = FHktVMTrace::RecordsPerThread - 1;
+    static_assert((FHktVMTrace::RecordsPerThread & RingMask) == 0, "RecordsPerThread must be a power of two");
+
+    FCriticalSection RingsLock;
+    TArray<TUniquePtr<FTraceRing>> Rings;     // 스레드 종료 후에도 덤프할 수 있도록 유지
+
+    thread_local FTraceRing* ThreadRing = nullptr;
+    thread_local int32 ThreadSuppressDepth = 0;
+
+    /** 스레드 첫 기록 시 한 번만 호출 */
+    FTraceRing* AcquireThreadRing()
+    {
+        TUniquePtr<FTraceRing> Ring = MakeUnique<FTraceRing>();
+        Ring->ThreadId = FPlatformTLS::GetCurrentThreadId();
+        ThreadRing = Ring.Get();
+
+        FScopeLock Lock(&RingsLock);
+        Rings.Add(MoveTemp(Ring));
+        return ThreadRing;
+    }
+}
+
+void FHktVMTrace::Write(EHktVMTraceEvent Event, uint32 VM, int32 A, int32 B)
+{
+    if (ThreadSuppressDepth > 0)
+        return;
+
+    FTraceRing* Ring = ThreadRing ? ThreadRing : AcquireThreadRing();
+
+    FHktVMTraceRecord& Record = Ring->Records[Ring->Written & RingMask];
+    Record.Frame = CurrentFrame.load(std::memory_order_relaxed);
+    Record.Event = static_cast<uint8>(Event);
+    Record.VM = VM & 0xFFFFFF;
+    Record.A = A;
+    Record.B = B;
+    ++Ring->Written;
+}
+
+FHktVMTrace::FScopedSuppress::FScopedSuppress()
+{
+    ++ThreadSuppressDepth;
+}
+
+FHktVMTrace::FScopedSuppress::~FScopedSuppress()
+{
+    --ThreadSuppressDepth;
+}
+
+void FHktVMTrace::Reset()
+{
+    FScopeLock Lock(&RingsLock);
+    for (TUniquePtr<FTraceRing>& Ring : Rings)
+    {
+        Ring->Written = 0;
+    }
+}
+
+// ============================================================================
+// 덤프 포맷
+// ============================================================================
+//
+// [Magic:4][Version:2][RecordSize:2][NumRings:4]
+// Ring × NumRings:
+//   [ThreadId:4][Written:8][NumRecords:4]
+//   Record × NumRecords (오래된 순): [Frame:4][Event:8|VM:24 packed:4][A:4][B:4]
+
+void FHktVMTrace::Dump(TArray<uint8>& OutData)
+{
+    OutData.Reset();
+    FMemoryWriter Writer(OutData);
+
+    FScopeLock Lock(&RingsLock);
+
+    uint32 Magic = DumpMagic;
+    uint16 Version = DumpVersion;
+    uint16 RecordSize = sizeof(FHktVMTraceRecord);
+    uint32 NumRings = Rings.Num();
+    Writer << Magic;
+    Writer << Version;
+    Writer << RecordSize;
+    Writer << NumRings;
+
+    for (const TUniquePtr<FTraceRing>& Ring : Rings)
+    {
+        uint32 ThreadId = Ring->ThreadId;
+        uint64 Written = Ring->Written;
+        uint32 NumRecords = static_cast<uint32>(FMath::Min<uint64>(Written, RecordsPerThread));
+        Writer << ThreadId;
+        Writer << Written;
+        Writer << NumRecords;
+
+        for (uint64 Seq = Written - NumRecords; Seq < Written; ++Seq)
+        {
+            const FHktVMTraceRecord& Record = Ring->Records[Seq & RingMask];
+            int32 Frame = Record.Frame;
+            uint32 Packed = Record.Event | (Record.VM << 8);
+            int32 A = Record.A;
+            int32 B = Record.B;
+            Writer << Frame;
+            Writer << Packed;
+            Writer << A;
+            Writer << B;
+        }
+    }
+}
+
+bool FHktVMTrace::DumpToFile(const FString& FilePath)
+{
+    TArray<uint8> Data;
+    Dump(Data);
+    return FFileHelper::SaveArrayToFile(Data, *FilePath);
+}
+
+// ============================================================================
+// 디코더
+// ============================================================================
+
+bool FHktVMTrace::Decode(const TArray<uint8>& Data, TArray<FHktVMTraceEntry>& OutEntries)
+{
+    OutEntries.Reset();
+    FMemoryReader Reader(Data);
+
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    uint16 RecordSize = 0;
+    uint32 NumRings = 0;
+    Reader << Magic;
+    Reader << Version;
+    Reader << RecordSize;
+    Reader << NumRings;
+
+    if (Reader.IsError() || Magic != DumpMagic || Version != DumpVersion || RecordSize != sizeof(FHktVMTraceRecord))
+        return false;
+
+    for (uint32 RingIdx = 0; RingIdx < NumRings; ++RingIdx)
+    {
+        uint32 ThreadId = 0;
+        uint64 Written = 0;
+        uint32 NumRecords = 0;
+        Reader << ThreadId;
+        Reader << Written;
+        Reader << NumRecords;
+
+        if (Reader.IsError() || NumRecords > Written || Reader.TotalSize() - Reader.Tell() < static_cast<int64>(NumRecords) * RecordSize)
+            return false;
+
+        for (uint32 i = 0; i < NumRecords; ++i)
+        {
+            int32 Frame = 0;
+            uint32 Packed = 0;
+            int32 A = 0;
+            int32 B = 0;
+            Reader << Frame;
+            Reader << Packed;
+            Reader << A;
+            Reader << B;
+
+            FHktVMTraceEntry& Entry = OutEntries.AddDefaulted_GetRef();
+            Entry.ThreadId = ThreadId;
+            Entry.Sequence = Written - NumRecords + i;
+            Entry.Record.Frame = Frame;
+            Entry.Record.Event = Packed & 0xFF;
+            Entry.Record.VM = Packed >> 8;
+            Entry.Record.A = A;
+            Entry.Record.B = B;
+        }
+    }
+
+    // 스레드 간 순서는 프레임 단위로만 의미가 있음 (같은 프레임 안에서는 스레드, 기록 순)
+    OutEntries.StableSort([](const FHktVMTraceEntry& L, const FHktVMTraceEntry& R)
+    {
+        if (L.Record.Frame != R.Record.Frame)
+            return L.Record.Frame < R.Record.Frame;
+        if (L.ThreadId != R.ThreadId)
+            return L.ThreadId < R.ThreadId;
+        return L.Sequence < R.Sequence;
+    });
+
+    return !Reader.IsError();
+}
+
+FString FHktVMTrace::FormatTimeline(const TArray<uint8>& Data)
+{
+    TArray<FHktVMTraceEntry> Entries;
+    if (!Decode(Data, Entries))
+    {
+        return TEXT("Invalid VM trace dump\n");
+    }
+
+    FString Out;
+    int32 LastFrame = 0;
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        const FHktVMTraceRecord& Record = Entries[i].Record;
+        if (i == 0 || Record.Frame != LastFrame)
+        {
+            Out += FString::Printf(TEXT("=== Frame %d ===\n"), Record.Frame);
+            LastFrame = Record.Frame;
+        }
+
+        FString VM = Record.VM == 0xFFFFFF ? FString(TEXT("-")) : FString::Printf(TEXT("%u"), static_cast<uint32>(Record.VM));
+        Out += FString::Printf(TEXT("  [T%u #%llu] VM %s %s A=%d B=%d\n"),
+            Entries[i].ThreadId, static_cast<unsigned long long>(Entries[i].Sequence),
+            *VM, GetEventName(Record.GetEvent()), Record.A, Record.B);
+    }
+    return Out;
+}
+
+const TCHAR* FHktVMTrace::GetEventName(EHktVMTraceEvent Event)
+{
+    switch (Event)
+    {
+    case EHktVMTraceEvent::None:                return TEXT("None");
+    case EHktVMTraceEvent::FrameBegin:          return TEXT("FrameBegin");
+    case EHktVMTraceEvent::FrameEnd:            return TEXT("FrameEnd");
+    case EHktVMTraceEvent::VMCreated:           return TEXT("VMCreated");
+    case EHktVMTraceEvent::VMFinalized:         return TEXT("VMFinalized");
+    case EHktVMTraceEvent::VMTick:              return TEXT("VMTick");
+    case EHktVMTraceEvent::AdmissionDeferred:   return TEXT("AdmissionDeferred");
+    case EHktVMTraceEvent::SpawnEntity:         return TEXT("SpawnEntity");
+    case EHktVMTraceEvent::DestroyEntity:       return TEXT("DestroyEntity");
+    case EHktVMTraceEvent::MoveToward:          return TEXT("MoveToward");
+    case EHktVMTraceEvent::MoveForward:         return TEXT("MoveForward");
+    case EHktVMTraceEvent::StopMovement:        return TEXT("StopMovement");
+    case EHktVMTraceEvent::FindInRadius:        return TEXT("FindInRadius");
+    case EHktVMTraceEvent::ApplyDamage:         return TEXT("ApplyDamage");
+    case EHktVMTraceEvent::ApplyEffect:         return TEXT("ApplyEffect");
+    case EHktVMTraceEvent::RemoveEffect:        return TEXT("RemoveEffect");
+    case EHktVMTraceEvent::PlayAnim:            return TEXT("PlayAnim");
+    case EHktVMTraceEvent::PlayAnimMontage:     return TEXT("PlayAnimMontage");
+    case EHktVMTraceEvent::StopAnim:            return TEXT("StopAnim");
+    case EHktVMTraceEvent::PlayVFX:             return TEXT("PlayVFX");
+    case EHktVMTraceEvent::PlayVFXAttached:     return TEXT("PlayVFXAttached");
+    case EHktVMTraceEvent::PlaySound:           return TEXT("PlaySound");
+    case EHktVMTraceEvent::PlaySoundAtLocation: return TEXT("PlaySoundAtLocation");
+    case EHktVMTraceEvent::SpawnEquipment:      return TEXT("SpawnEquipment");
+    case EHktVMTraceEvent::Log:                 return TEXT("Log");
+    case EHktVMTraceEvent::FindNearest:         return TEXT("FindNearest");
+    default:                                    return TEXT("Unknown");
+    }
+}
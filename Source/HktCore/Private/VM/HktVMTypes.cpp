@@ -1 +1,209 @@
-#include "HktVMTypes.h"
\ No newline at end of file
+#include "HktVMTypes.h"
+
+// ============================================================================
+// FInstruction
+// ============================================================================
+
+bool FInstruction::GetBranchTarget(int32& OutTarget) const
+{
+    switch (GetOpCode())
+    {
+    case EOpCode::Jump:
+        OutTarget = Imm20;
+        return true;
+    case EOpCode::JumpIf:
+    case EOpCode::JumpIfNot:
+    case EOpCode::JumpIfEq:
+    case EOpCode::JumpIfNe:
+    case EOpCode::JumpIfLt:
+    case EOpCode::JumpIfLe:
+    case EOpCode::JumpIfGt:
+    case EOpCode::JumpIfGe:
+        OutTarget = Imm12;
+        return true;
+    default:
+        return false;
+    }
+}
+
+void FInstruction::SetBranchTarget(int32 Target)
+{
+    if (GetOpCode() == EOpCode::Jump)
+    {
+        Imm20 = static_cast<uint32>(Target);
+    }
+    else
+    {
+        Imm12 = static_cast<uint16>(Target);
+    }
+}
+
+// ============================================================================
+// FRegisterUsage
+// ============================================================================
+
+namespace
+{
+    FORCEINLINE uint16 RegBit(uint32 Idx)
+    {
+        return Idx < MaxRegisters ? static_cast<uint16>(1u << Idx) : 0;
+    }
+    
+    /** Base, Base+1, Base+2 (위치 벡터) */
+    FORCEINLINE uint16 RegTriple(uint32 Base)
+    {
+        return RegBit(Base) | RegBit(Base + 1) | RegBit(Base + 2);
+    }
+}
+
+FRegisterUsage FRegisterUsage::Of(const FInstruction& Inst)
+{
+    FRegisterUsage U;
+    
+    switch (Inst.GetOpCode())
+    {
+    case EOpCode::Nop:
+    case EOpCode::Halt:
+    case EOpCode::Yield:
+    case EOpCode::YieldSeconds:
+    case EOpCode::Jump:
+    case EOpCode::PlaySound:
+    case EOpCode::Log:
+    case EOpCode::SaveStoreConst:
+        break;
+        
+    case EOpCode::JumpIf:
+    case EOpCode::JumpIfNot:
+    case EOpCode::SaveStore:
+    case EOpCode::DestroyEntity:
+    case EOpCode::MoveForward:
+    case EOpCode::StopMovement:
+    case EOpCode::ApplyEffect:
+    case EOpCode::RemoveEffect:
+    case EOpCode::PlayAnim:
+    case EOpCode::PlayAnimMontage:
+    case EOpCode::StopAnim:
+    case EOpCode::PlayVFXAttached:
+    case EOpCode::ApplyDamageConst:
+    case EOpCode::WaitMoveEnd:
+    case EOpCode::WaitAnimEnd:
+        U.Reads = RegBit(Inst.Src1);
+        break;
+        
+    case EOpCode::WaitCollision:
+        // 재개 시 Processor가 Hit 레지스터에 충돌 대상을 기록
+        U.Reads = RegBit(Inst.Src1);
+        U.Writes = RegBit(Reg::Hit);
+        break;
+        
+    case EOpCode::LoadConst:
+    case EOpCode::LoadConstPool:
+    case EOpCode::LoadStore:
+        U.Writes = RegBit(Inst.Dst);
+        break;
+        
+    case EOpCode::LoadConstHigh:
+    case EOpCode::AddImmWide:
+        U.Reads = RegBit(Inst.Dst);
+        U.Writes = RegBit(Inst.Dst);
+        break;
+        
+    case EOpCode::LoadStoreEntity:
+    case EOpCode::Move:
+    case EOpCode::AddImm:
+        U.Reads = RegBit(Inst.Src1);
+        U.Writes = RegBit(Inst.Dst);
+        break;
+        
+    case EOpCode::SaveStoreEntity:
+    case EOpCode::ApplyDamage:
+    case EOpCode::JumpIfEq:
+    case EOpCode::JumpIfNe:
+    case EOpCode::JumpIfLt:
+    case EOpCode::JumpIfLe:
+    case EOpCode::JumpIfGt:
+    case EOpCode::JumpIfGe:
+        U.Reads = RegBit(Inst.Src1) | RegBit(Inst.Src2);
+        break;
+        
+    case EOpCode::Add:
+    case EOpCode::Sub:
+    case EOpCode::Mul:
+    case EOpCode::Div:
+    case EOpCode::Mod:
+    case EOpCode::CmpEq:
+    case EOpCode::CmpNe:
+    case EOpCode::CmpLt:
+    case EOpCode::CmpLe:
+    case EOpCode::CmpGt:
+    case EOpCode::CmpGe:
+    case EOpCode::GetDistance:
+        U.Reads = RegBit(Inst.Src1) | RegBit(Inst.Src2);
+        U.Writes = RegBit(Inst.Dst);
+        break;
+        
+    case EOpCode::SpawnEntity:
+        // 소유자 기록을 위해 Self를 읽음
+        U.Reads = RegBit(Reg::Self);
+        U.Writes = RegBit(Reg::Spawned);
+        break;
+        
+    case EOpCode::SpawnEquipment:
+        U.Reads = RegBit(Inst.Src1);
+        U.Writes = RegBit(Reg::Spawned);
+        break;
+        
+    case EOpCode::GetPosition:
+        U.Reads = RegBit(Inst.Src1);
+        U.Writes = RegTriple(Inst.Dst);
+        break;
+        
+    case EOpCode::SetPosition:
+    case EOpCode::MoveToward:
+        U.Reads = RegBit(Inst.Dst) | RegTriple(Inst.Src1);
+        break;
+        
+    case EOpCode::PlayVFX:
+    case EOpCode::PlaySoundAtLocation:
+        U.Reads = RegTriple(Inst.Src1);
+        break;
+        
+    case EOpCode::Vec3Add:
+    case EOpCode::Vec3Sub:
+    case EOpCode::Vec3Toward:
+        U.Reads = RegTriple(Inst.Src1) | RegTriple(Inst.Src2);
+        U.Writes = RegTriple(Inst.Dst);
+        break;
+        
+    case EOpCode::Vec3Scale:
+        U.Reads = RegTriple(Inst.Src1) | RegBit(Inst.Src2);
+        U.Writes = RegTriple(Inst.Dst);
+        break;
+        
+    case EOpCode::Vec3DistSq:
+        U.Reads = RegTriple(Inst.Src1) | RegTriple(Inst.Src2);
+        U.Writes = RegBit(Inst.Dst);
+        break;
+        
+    case EOpCode::SaveStoreEntityConst:
+        U.Reads = RegBit(Inst._Dst);
+        break;
+        
+    case EOpCode::FindInRadius:
+    case EOpCode::FindNearest:
+        U.Reads = RegBit(Inst.Src1);
+        U.Writes = RegBit(Reg::Count);
+        break;
+        
+    case EOpCode::NextFound:
+        U.Writes = RegBit(Reg::Iter) | RegBit(Reg::Flag);
+        break;
+        
+    default:
+        // 알 수 없는 명령어: 모든 레지스터를 읽는 것으로 간주 (보수적)
+        U.Reads = 0xFFFF;
+        break;
+    }
+    
+    return U;
+}
@@ -30,6 +30,9 @@ struct FHktVMHandle
 using RegisterIndex = uint8;
 constexpr int32 MaxRegisters = 16;
 
+/** 로직 프레임 레이트 - WaitSeconds를 프레임 수로 변환 (HktGameState의 고정 프레임과 일치) */
+constexpr int32 LogicFramesPerSecond = 30;
+
 /**
  * Reg - 특수 레지스터 별칭
  * 
@@ -71,6 +74,7 @@ enum class EVMStatus : uint8
     Running,        // 실행 중
     Yielded,        // yield 상태 (다음 틱에 재개)
     WaitingEvent,   // 이벤트 대기 중
+    PendingSpawn,   // 엔티티 생성 대기 (Execute 라운드 사이에 순서대로 할당 후 재개)
     Completed,      // 정상 완료
     Failed,         // 오류로 중단
 };
@@ -83,6 +87,8 @@ enum class EWaitEventType : uint8
     None,
     Timer,
     Collision,
+    MoveEnd,
+    AnimEnd,
 };
 
 /**
@@ -112,10 +118,13 @@ enum class EOpCode : uint8
     
     // Event Wait
     WaitCollision,          // 충돌 이벤트 대기
+    WaitMoveEnd,            // 이동 완료 이벤트 대기
+    WaitAnimEnd,            // 애니메이션 종료 이벤트 대기
     
     // Data Operations
     LoadConst,              // 상수 → 레지스터
-    LoadConstHigh,          // 상수 상위 비트 로드
+    LoadConstHigh,          // 상수 상위 비트 로드 (ISA v1 호환)
+    LoadConstPool,          // 상수 풀[Imm20] → 레지스터 (32비트 상수 1개 명령어)
     LoadStore,              // Store 속성 → 레지스터
     LoadStoreEntity,        // 엔티티 속성 → 레지스터
     SaveStore,              // 레지스터 → Store 속성 (버퍼링됨)
@@ -129,6 +138,7 @@ enum class EOpCode : uint8
     Div,
     Mod,
     AddImm,                 // 즉시값 더하기
+    AddImmWide,             // Dst += 20비트 즉시값
     
     // Comparison (결과를 플래그 레지스터에 저장)
     CmpEq,
@@ -150,8 +160,16 @@ enum class EOpCode : uint8
     MoveForward,            // 전방 이동
     StopMovement,           // 이동 중지
     
+    // Vector (레지스터 Base~Base+2 = Vec3)
+    Vec3Add,                // Dst = A + B
+    Vec3Sub,                // Dst = A - B
+    Vec3Scale,              // Dst = A * 스칼라 레지스터
+    Vec3DistSq,             // 스칼라 Dst = |B - A|² (int32 포화)
+    Vec3Toward,             // Dst = (B - A) 방향, 길이 Imm12 (cm)
+    
     // Spatial Query
     FindInRadius,           // 반경 내 검색
+    FindNearest,            // 반경 내 가까운 순 K개 검색
     NextFound,              // 다음 검색 결과
     
     // Combat
@@ -176,6 +194,17 @@ enum class EOpCode : uint8
     // Utility
     Log,                    // 디버그 로그
     
+    // Superinstructions (FFlowBuilder 최적화 패스가 생성, 직접 Emit하지 않음)
+    SaveStoreConst,         // 상수 → Store 속성 (LoadConst + SaveStore)
+    SaveStoreEntityConst,   // 상수 → 엔티티 속성 (LoadConst + SaveStoreEntity)
+    ApplyDamageConst,       // 상수 데미지 적용 (LoadConst + ApplyDamage)
+    JumpIfEq,               // 비교 + 조건부 점프 (CmpXX + JumpIf)
+    JumpIfNe,
+    JumpIfLt,
+    JumpIfLe,
+    JumpIfGt,
+    JumpIfGe,
+    
     Max
 };
 
@@ -187,6 +216,12 @@ enum class EOpCode : uint8
  * 32비트 명령어 포맷:
  * [OpCode:8][Dst:4][Src1:4][Src2:4][Imm12:12] - 3-operand
  * [OpCode:8][Dst:4][Imm20:20]                 - Load immediate
+ * [OpCode:8][Dst:4][Value:12][PropertyId:8]   - 상수 저장 (SaveStoreConst, SaveStoreEntityConst)
+ *
+ * FindNearest는 3-operand 형식에서 Src2를 레지스터가 아닌 개수 K(1~15)로 사용합니다.
+ * LoadConstPool/AddImmWide는 Load immediate 형식 (Imm20 = 상수 풀 인덱스 / 부호 있는 즉시값).
+ * Vec3 명령어의 Dst/Src1/Src2는 레지스터 3개의 시작 인덱스이며 (Vec3Scale의 Src2, Vec3DistSq의 Dst는 스칼라),
+ * Add/Sub/Scale은 성분 순서(X→Y→Z)대로 스칼라 명령어 3개를 실행한 것과 같은 결과입니다.
  */
 struct FInstruction
 {
@@ -256,6 +291,50 @@ struct FInstruction
         }
         return Val;
     }
+    
+    // 제어 흐름 헬퍼 (최적화/검증 패스용)
+    
+    /** 분기 명령어면 점프 대상 반환 (Jump: Imm20, 조건부: Imm12) */
+    bool GetBranchTarget(int32& OutTarget) const;
+    void SetBranchTarget(int32 Target);
+    
+    /** 실행 후 다음 명령어(PC+1)로 진행할 수 있는지 (Halt, Jump 제외 전부) */
+    bool FallsThrough() const
+    {
+        return GetOpCode() != EOpCode::Halt && GetOpCode() != EOpCode::Jump;
+    }
+    
+    /** 상수 저장 포맷: Imm20 = [Value:12][PropertyId:8] */
+    static FInstruction MakePropConst(EOpCode Op, uint8 Entity, uint16 PropertyId, int32 Value)
+    {
+        return MakeImm(Op, Entity, ((Value & 0xFFF) << 8) | (PropertyId & 0xFF));
+    }
+    
+    uint16 GetPackedPropertyId() const { return static_cast<uint16>(Imm20 & 0xFF); }
+    
+    int32 GetPackedValue() const
+    {
+        int32 Val = (Imm20 >> 8) & 0xFFF;
+        if (Val & 0x800)
+        {
+            Val |= 0xFFFFF000;
+        }
+        return Val;
+    }
+};
+
+/**
+ * FRegisterUsage - 명령어가 읽고 쓰는 레지스터 (비트마스크)
+ * 
+ * 암묵적 레지스터(Spawned, Hit, Iter, Flag 등)까지 포함.
+ * FFlowBuilder 최적화 패스의 liveness 분석에 사용
+ */
+struct FRegisterUsage
+{
+    uint16 Reads = 0;
+    uint16 Writes = 0;
+    
+    static FRegisterUsage Of(const FInstruction& Inst);
 };
 
 static_assert(sizeof(FInstruction) == 4, "Instruction must be 32 bits");
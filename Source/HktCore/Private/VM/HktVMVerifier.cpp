@@ -0,0 +1,371 @@
+#include "HktVMVerifier.h"
+#include "HktVMProgram.h"
+#include "HktStashLayout.h"
+
+namespace
+{
+    /** 공간 검색 상태 (가능한 상태의 비트마스크로 데이터플로우 분석) */
+    namespace EQueryState
+    {
+        constexpr uint8 NotStarted = 1 << 0;    // FindInRadius 실행 전
+        constexpr uint8 Iterating = 1 << 1;     // FindInRadius ~ 순회 종료 전
+        constexpr uint8 Exhausted = 1 << 2;     // NextFound가 Flag=0을 반환해 루프를 빠져나감
+    }
+
+    /** NextFound 직후 Flag로 분기하는 명령어 (ForEach 루프 탈출 조건) */
+    bool IsLoopExitBranch(const TArray<FInstruction>& Code, int32 PC)
+    {
+        if (PC <= 0 || Code[PC - 1].GetOpCode() != EOpCode::NextFound)
+            return false;
+
+        const EOpCode Op = Code[PC].GetOpCode();
+        return (Op == EOpCode::JumpIf || Op == EOpCode::JumpIfNot) && Code[PC].Src1 == Reg::Flag;
+    }
+}
+
+bool FHktVMVerifier::Verify(FHktVMProgram& Program)
+{
+    FHktVMVerifier Verifier(Program);
+
+    Program.bVerified = false;
+    Program.Effects.Reset();
+
+    if (!Program.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("[VM Verify] %s: empty program"), *Program.Tag.ToString());
+        return false;
+    }
+
+    Program.bVerified = Verifier.VerifyInstructions() && Verifier.VerifySpatialQueries();
+    return Program.bVerified;
+}
+
+FHktVMVerifier::FHktVMVerifier(FHktVMProgram& InProgram)
+    : Program(InProgram)
+{
+}
+
+bool FHktVMVerifier::Fail(int32 PC, const TCHAR* Reason)
+{
+    UE_LOG(LogTemp, Error, TEXT("[VM Verify] %s @%d: %s"), *Program.Tag.ToString(), PC, Reason);
+    return false;
+}
+
+bool FHktVMVerifier::CheckRegisterTriple(int32 PC, uint32 Base)
+{
+    return Base + 2 < static_cast<uint32>(MaxRegisters) ? true : Fail(PC, TEXT("register triple out of range"));
+}
+
+bool FHktVMVerifier::CheckString(int32 PC, int32 Index)
+{
+    return Program.Strings.IsValidIndex(Index) ? true : Fail(PC, TEXT("string index out of range"));
+}
+
+bool FHktVMVerifier::CheckConstant(int32 PC, int32 Index)
+{
+    return Program.Constants.IsValidIndex(Index) ? true : Fail(PC, TEXT("constant index out of range"));
+}
+
+bool FHktVMVerifier::CheckPropertyId(int32 PC, uint32 PropertyId)
+{
+    return PropertyId < static_cast<uint32>(FHktStashLayout::MaxProperties) ? true : Fail(PC, TEXT("property id out of range"));
+}
+
+// ============================================================================
+// 명령어 단위 검증
+// ============================================================================
+
+bool FHktVMVerifier::VerifyInstructions()
+{
+    const TArray<FInstruction>& Code = Program.Code;
+    const int32 CodeSize = Code.Num();
+    bool bOk = true;
+
+    for (int32 PC = 0; PC < CodeSize; ++PC)
+    {
+        const FInstruction& Inst = Code[PC];
+
+        if (Inst.OpCode >= static_cast<uint32>(EOpCode::Max))
+        {
+            bOk = Fail(PC, TEXT("invalid opcode"));
+            continue;
+        }
+
+        int32 Target;
+        if (Inst.GetBranchTarget(Target) && (Target < 0 || Target >= CodeSize))
+        {
+            bOk = Fail(PC, TEXT("jump target out of range"));
+        }
+
+        switch (Inst.GetOpCode())
+        {
+        case EOpCode::LoadConstPool:
+            bOk &= CheckConstant(PC, Inst.Imm20);
+            break;
+        case EOpCode::LoadStore:
+        case EOpCode::LoadStoreEntity:
+        case EOpCode::SaveStore:
+        case EOpCode::SaveStoreEntity:
+            // Stash 열/효과 비트 밖의 Property는 효과로 기록하지 않음
+            if (!CheckPropertyId(PC, Inst.Imm12))
+            {
+                bOk = false;
+                continue;
+            }
+            break;
+        case EOpCode::SaveStoreConst:
+        case EOpCode::SaveStoreEntityConst:
+            if (!CheckPropertyId(PC, Inst.GetPackedPropertyId()))
+            {
+                bOk = false;
+                continue;
+            }
+            break;
+        case EOpCode::GetPosition:
+            bOk &= CheckRegisterTriple(PC, Inst.Dst);
+            break;
+        case EOpCode::Vec3Add:
+        case EOpCode::Vec3Sub:
+        case EOpCode::Vec3Toward:
+            bOk &= CheckRegisterTriple(PC, Inst.Dst);
+            bOk &= CheckRegisterTriple(PC, Inst.Src1);
+            bOk &= CheckRegisterTriple(PC, Inst.Src2);
+            break;
+        case EOpCode::Vec3Scale:
+            bOk &= CheckRegisterTriple(PC, Inst.Dst);
+            bOk &= CheckRegisterTriple(PC, Inst.Src1);
+            break;
+        case EOpCode::Vec3DistSq:
+            bOk &= CheckRegisterTriple(PC, Inst.Src1);
+            bOk &= CheckRegisterTriple(PC, Inst.Src2);
+            break;
+        case EOpCode::SetPosition:
+        case EOpCode::MoveToward:
+            bOk &= CheckRegisterTriple(PC, Inst.Src1);
+            break;
+        case EOpCode::PlayVFX:
+        case EOpCode::PlaySoundAtLocation:
+            bOk &= CheckRegisterTriple(PC, Inst.Src1);
+            bOk &= CheckString(PC, Inst.Imm12);
+            break;
+        case EOpCode::FindNearest:
+            if (Inst.Src2 == 0)
+            {
+                bOk = Fail(PC, TEXT("FindNearest with K = 0"));
+            }
+            break;
+        case EOpCode::SpawnEntity:
+        case EOpCode::PlaySound:
+        case EOpCode::Log:
+            bOk &= CheckString(PC, Inst.GetSignedImm20());
+            break;
+        case EOpCode::ApplyEffect:
+        case EOpCode::RemoveEffect:
+        case EOpCode::PlayAnim:
+        case EOpCode::PlayAnimMontage:
+        case EOpCode::PlayVFXAttached:
+        case EOpCode::SpawnEquipment:
+            bOk &= CheckString(PC, Inst.Imm12);
+            break;
+        default:
+            // 나머지 레지스터 피연산자는 4비트 필드라 항상 범위 내
+            break;
+        }
+
+        RecordEffects(Inst);
+    }
+
+    // 마지막 명령어가 다음으로 진행하면 PC가 코드 끝을 넘어감
+    if (Code.Last().FallsThrough())
+    {
+        bOk = Fail(CodeSize - 1, TEXT("control falls off the end of the program"));
+    }
+
+    return bOk;
+}
+
+// ============================================================================
+// ForEach (공간 검색) 중첩 검증
+// ============================================================================
+
+bool FHktVMVerifier::VerifySpatialQueries()
+{
+    const TArray<FInstruction>& Code = Program.Code;
+    const int32 CodeSize = Code.Num();
+
+    TArray<uint8> InStates;
+    InStates.Init(0, CodeSize);
+    InStates[0] = EQueryState::NotStarted;
+
+    TArray<int32> Worklist;
+    Worklist.Add(0);
+
+    auto Propagate = [&](int32 To, uint8 State)
+    {
+        if (To >= 0 && To < CodeSize && (InStates[To] | State) != InStates[To])
+        {
+            InStates[To] |= State;
+            Worklist.Add(To);
+        }
+    };
+
+    bool bOk = true;
+    TBitArray<> Reported(false, CodeSize);
+
+    while (Worklist.Num() > 0)
+    {
+        const int32 PC = Worklist.Pop();
+        const FInstruction& Inst = Code[PC];
+        const uint8 In = InStates[PC];
+        uint8 Out = In;
+
+        switch (Inst.GetOpCode())
+        {
+        case EOpCode::FindInRadius:
+        case EOpCode::FindNearest:
+            if ((In & EQueryState::Iterating) && !Reported[PC])
+            {
+                Reported[PC] = true;
+                bOk = Fail(PC, TEXT("nested spatial query while a ForEach is iterating"));
+            }
+            Out = EQueryState::Iterating;
+            break;
+
+        case EOpCode::NextFound:
+            if ((In & EQueryState::NotStarted) && !Reported[PC])
+            {
+                Reported[PC] = true;
+                bOk = Fail(PC, TEXT("NextFound before FindInRadius"));
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        int32 Target;
+        const bool bBranch = Inst.GetBranchTarget(Target);
+
+        if (bBranch && IsLoopExitBranch(Code, PC) && (In & EQueryState::Iterating))
+        {
+            // JumpIfNot Flag → 분기 = 순회 종료, JumpIf Flag → 진행 = 순회 종료
+            const uint8 Continue = In;
+            const uint8 Exit = (In & ~EQueryState::Iterating) | EQueryState::Exhausted;
+            const bool bExitOnBranch = Inst.GetOpCode() == EOpCode::JumpIfNot;
+
+            Propagate(Target, bExitOnBranch ? Exit : Continue);
+            Propagate(PC + 1, bExitOnBranch ? Continue : Exit);
+            continue;
+        }
+
+        if (bBranch)
+        {
+            Propagate(Target, Out);
+        }
+        if (Inst.FallsThrough())
+        {
+            Propagate(PC + 1, Out);
+        }
+    }
+
+    return bOk;
+}
+
+// ============================================================================
+// 효과 요약 기록
+// ============================================================================
+
+void FHktVMVerifier::RecordEffects(const FInstruction& Inst)
+{
+    FHktVMEffectSignature& Effects = Program.Effects;
+
+    auto ReadPosition = [&Effects]()
+    {
+        Effects.AddRead(PropertyId::PosX);
+        Effects.AddRead(PropertyId::PosY);
+        Effects.AddRead(PropertyId::PosZ);
+    };
+
+    switch (Inst.GetOpCode())
+    {
+    case EOpCode::Yield:
+        Effects.bYields = true;
+        break;
+    case EOpCode::YieldSeconds:
+        Effects.WaitMask |= 1u << static_cast<uint8>(EWaitEventType::Timer);
+        break;
+    case EOpCode::WaitCollision:
+        Effects.WaitMask |= 1u << static_cast<uint8>(EWaitEventType::Collision);
+        break;
+    case EOpCode::WaitMoveEnd:
+        Effects.WaitMask |= 1u << static_cast<uint8>(EWaitEventType::MoveEnd);
+        break;
+    case EOpCode::WaitAnimEnd:
+        Effects.WaitMask |= 1u << static_cast<uint8>(EWaitEventType::AnimEnd);
+        break;
+
+    case EOpCode::LoadStore:
+    case EOpCode::LoadStoreEntity:
+        Effects.AddRead(Inst.Imm12);
+        break;
+    case EOpCode::SaveStore:
+    case EOpCode::SaveStoreEntity:
+        Effects.AddWrite(Inst.Imm12);
+        break;
+    case EOpCode::SaveStoreConst:
+    case EOpCode::SaveStoreEntityConst:
+        Effects.AddWrite(Inst.GetPackedPropertyId());
+        break;
+
+    case EOpCode::SpawnEntity:
+    case EOpCode::SpawnEquipment:
+        Effects.bSpawnsEntities = true;
+        Effects.AddWrite(PropertyId::OwnerEntity);
+        Effects.AddWrite(PropertyId::EntityType);
+        break;
+    case EOpCode::DestroyEntity:
+        Effects.bDestroysEntities = true;
+        break;
+
+    case EOpCode::GetPosition:
+    case EOpCode::GetDistance:
+        ReadPosition();
+        break;
+    case EOpCode::SetPosition:
+        Effects.AddWrite(PropertyId::PosX);
+        Effects.AddWrite(PropertyId::PosY);
+        Effects.AddWrite(PropertyId::PosZ);
+        break;
+    case EOpCode::MoveToward:
+        Effects.AddWrite(PropertyId::MoveTargetX);
+        Effects.AddWrite(PropertyId::MoveTargetY);
+        Effects.AddWrite(PropertyId::MoveTargetZ);
+        Effects.AddWrite(PropertyId::MoveSpeed);
+        Effects.AddWrite(PropertyId::IsMoving);
+        break;
+    case EOpCode::MoveForward:
+        Effects.AddWrite(PropertyId::MoveSpeed);
+        Effects.AddWrite(PropertyId::IsMoving);
+        break;
+    case EOpCode::StopMovement:
+        Effects.AddWrite(PropertyId::IsMoving);
+        break;
+
+    case EOpCode::FindInRadius:
+    case EOpCode::FindNearest:
+        Effects.bQueriesSpatial = true;
+        ReadPosition();
+        Effects.AddRead(PropertyId::Team);
+        break;
+
+    case EOpCode::ApplyDamage:
+    case EOpCode::ApplyDamageConst:
+        Effects.AddRead(PropertyId::Health);
+        Effects.AddRead(PropertyId::Defense);
+        Effects.AddWrite(PropertyId::Health);
+        break;
+
+    default:
+        break;
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktVMTypes.h"
+
+struct FHktVMProgram;
+
+/**
+ * FHktVMVerifier - 로드 시점 바이트코드 검증 (FHktVMProgramRegistry::RegisterProgram에서 호출)
+ *
+ * 검증 항목:
+ * - OpCode 범위, 레지스터 인덱스 (위치 벡터 Base~Base+2 포함)
+ * - 점프 대상 범위, 마지막 명령어가 끝을 넘어 진행하지 않는지
+ * - 문자열/상수 인덱스, Store 명령어의 PropertyId (< FHktStashLayout::MaxProperties)
+ * - 공간 검색 중첩: FindInRadius/FindNearest 순회 중 다시 검색 금지,
+ *   FindInRadius 없이 NextFound 금지 (Runtime의 검색 결과 슬롯은 하나)
+ *
+ * 통과한 프로그램은 bVerified = true가 되어, 인터프리터가 PC 범위 검사와
+ * 레지스터 인덱스 검사 없이 실행합니다. 동시에 Program.Effects를 기록합니다.
+ */
+class FHktVMVerifier
+{
+public:
+    /** @return 검증 통과 여부 (Program.bVerified, Program.Effects 갱신) */
+    static bool Verify(FHktVMProgram& Program);
+
+private:
+    explicit FHktVMVerifier(FHktVMProgram& InProgram);
+
+    bool VerifyInstructions();
+    bool VerifySpatialQueries();
+    void RecordEffects(const FInstruction& Inst);
+
+    bool CheckRegisterTriple(int32 PC, uint32 Base);
+    bool CheckString(int32 PC, int32 Index);
+    bool CheckConstant(int32 PC, int32 Index);
+    bool CheckPropertyId(int32 PC, uint32 PropertyId);
+    bool Fail(int32 PC, const TCHAR* Reason);
+
+private:
+    FHktVMProgram& Program;
+};
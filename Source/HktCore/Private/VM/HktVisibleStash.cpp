@@ -11,10 +11,7 @@ FHktVisibleStash::FHktVisibleStash()
 
 void FHktVisibleStash::ApplyWrites(const TArray<FPendingWrite>& Writes)
 {
-    for (const auto& W : Writes)
-    {
-        SetProperty(W.Entity, W.PropertyId, W.Value);
-    }
+    FHktStashBase::ApplyWrites(Writes);
 }
 
 void FHktVisibleStash::ApplyEntitySnapshot(const FHktEntitySnapshot& Snapshot)
@@ -24,23 +21,21 @@ void FHktVisibleStash::ApplyEntitySnapshot(const FHktEntitySnapshot& Snapshot)
     
     FHktEntityId E = Snapshot.GetEntityId();
     
-    if (E.RawValue < 0 || E.RawValue >= MaxEntities)
+    if (E.RawValue < 0)
         return;
     
-    // 엔티티 활성화
-    ValidEntities[E.RawValue] = true;
-    if (E.RawValue >= NextEntityId)
-        NextEntityId = E.RawValue + 1;
+    // 엔티티 활성화 (서버 ID의 세대를 그대로 사용)
+    ActivateSlot(E);
     
     // Property 복사
     int32 NumProps = FMath::Min(Snapshot.Properties.Num(), MaxProperties);
     for (int32 PropId = 0; PropId < NumProps; ++PropId)
     {
-        Properties[PropId][E.RawValue] = Snapshot.Properties[PropId];
+        WritePropertyAt(E.GetIndex(), PropId, Snapshot.Properties[PropId]);
     }
     
     // Tag 복사
-    EntityTags[E.RawValue] = Snapshot.Tags;
+    SetSlotTagBits(E.GetIndex(), FHktTagRegistry::Get().MakeBits(Snapshot.Tags));
     
     UE_LOG(LogTemp, Verbose, TEXT("[VisibleStash] Applied snapshot for Entity %d (Tags: %d)"), 
         E.RawValue, Snapshot.Tags.Num());
@@ -58,18 +53,6 @@ void FHktVisibleStash::ApplySnapshots(const TArray<FHktEntitySnapshot>& Snapshot
 
 void FHktVisibleStash::Clear()
 {
-    ValidEntities.Init(false, MaxEntities);
-    FreeList.Reset();
-    NextEntityId = 0;
+    ResetStorage();
     CompletedFrameNumber = 0;
-    
-    for (int32 PropId = 0; PropId < MaxProperties; ++PropId)
-    {
-        FMemory::Memzero(Properties[PropId].GetData(), MaxEntities * sizeof(int32));
-    }
-    
-    for (int32 E = 0; E < MaxEntities; ++E)
-    {
-        EntityTags[E].Reset();
-    }
 }
@@ -27,11 +27,15 @@ public:
     virtual int32 GetEntityCount() const override { return FHktStashBase::GetEntityCount(); }
     virtual int32 GetCompletedFrameNumber() const override { return FHktStashBase::GetCompletedFrameNumber(); }
     virtual void MarkFrameCompleted(int32 FrameNumber) override { FHktStashBase::MarkFrameCompleted(FrameNumber); }
+    virtual const TArray<FHktEntityChange>& GetFrameChanges() const override { return FHktStashBase::GetFrameChanges(); }
     virtual void ForEachEntity(TFunctionRef<void(FHktEntityId)> Callback) const override { FHktStashBase::ForEachEntity(Callback); }
     virtual uint32 CalculateChecksum() const override { return FHktStashBase::CalculateChecksum(); }
+    virtual uint32 CalculateFullChecksum() const override { return FHktStashBase::CalculateFullChecksum(); }
+    virtual void GetEntityGroupHashes(FHktEntityId Entity, uint64 (&OutHashes)[HktHashGroup::Num]) const override { FHktStashBase::GetEntityGroupHashes(Entity, OutHashes); }
+    virtual const FHktStashBase* GetStorage() const override { return this; }
 
     // ========== Tag API Implementation ==========
-    virtual const FGameplayTagContainer& GetTags(FHktEntityId Entity) const override { return FHktStashBase::GetTags(Entity); }
+    virtual FGameplayTagContainer GetTags(FHktEntityId Entity) const override { return FHktStashBase::GetTags(Entity); }
     virtual void SetTags(FHktEntityId Entity, const FGameplayTagContainer& Tags) override { FHktStashBase::SetTags(Entity, Tags); }
     virtual void AddTag(FHktEntityId Entity, const FGameplayTag& Tag) override { FHktStashBase::AddTag(Entity, Tag); }
     virtual void RemoveTag(FHktEntityId Entity, const FGameplayTag& Tag) override { FHktStashBase::RemoveTag(Entity, Tag); }
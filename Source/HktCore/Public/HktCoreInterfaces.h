@@ -6,6 +6,55 @@
 #include "UObject/Interface.h"
 #include "HktCoreTypes.h"
 
+class FHktStashBase;
+
+/** Property 쓰기 한 건 (일괄 커밋 단위) */
+struct FHktPropertyWrite
+{
+    FHktEntityId Entity;
+    uint16 PropertyId;
+    int32 Value;
+};
+
+/** 한 프레임 동안의 엔티티 변경 (변경 피드 항목, 엔티티당 하나) */
+struct FHktEntityChange
+{
+    enum EFlags : uint8
+    {
+        Created    = 1 << 0,
+        Destroyed  = 1 << 1,
+        Properties = 1 << 2,
+        Tags       = 1 << 3,
+    };
+
+    /** Property 그룹 = PropertyId >> PropertyGroupShift (16개 단위, 8그룹) */
+    static constexpr int32 PropertyGroupShift = 4;
+
+    static constexpr uint8 GetPropertyGroupBit(uint16 PropertyId) { return static_cast<uint8>(1u << (PropertyId >> PropertyGroupShift)); }
+
+    /** 같은 프레임에 해제 후 재할당되면 새 엔티티 (Created | Destroyed) */
+    FHktEntityId Entity;
+    uint8 Flags = 0;
+
+    /** 값이 바뀐 Property 그룹 비트 */
+    uint8 PropertyGroups = 0;
+
+    bool HasAny(uint8 InFlags) const { return (Flags & InFlags) != 0; }
+    bool IsPropertyGroupDirty(uint16 PropertyId) const { return (PropertyGroups & GetPropertyGroupBit(PropertyId)) != 0; }
+};
+
+/** 엔티티 상태 해시 그룹 (desync 위치 추적 단위) */
+namespace HktHashGroup
+{
+    /** 0..7 = Property 그룹 (PropertyId >> FHktEntityChange::PropertyGroupShift) */
+    constexpr int32 NumPropertyGroups = 8;
+
+    /** 존재(ID) + 태그 */
+    constexpr int32 Tags = NumPropertyGroups;
+
+    constexpr int32 Num = NumPropertyGroups + 1;
+}
+
 //=============================================================================
 // IHktStashInterface - 순수 C++ Stash 인터페이스
 //=============================================================================
@@ -32,8 +81,22 @@ public:
     virtual int32 GetProperty(FHktEntityId Entity, uint16 PropertyId) const = 0;
     virtual void SetProperty(FHktEntityId Entity, uint16 PropertyId, int32 Value) = 0;
     
+    /**
+     * 일괄 쓰기 - 순서대로 적용 (같은 키는 마지막 값)
+     * VMProcessor는 프레임의 모든 커밋을 (PropertyId, EntityId) 순으로 정렬해 한 번 호출합니다.
+     * HktCore Stash는 열 단위로 쓰고 파생 상태(셀 등)를 엔티티당 한 번 갱신합니다.
+     */
+    virtual void ApplyWrites(const TArray<FHktPropertyWrite>& Writes)
+    {
+        for (const FHktPropertyWrite& W : Writes)
+        {
+            SetProperty(W.Entity, W.PropertyId, W.Value);
+        }
+    }
+    
     // ========== Tag API (GameplayTagContainer) ==========
-    virtual const FGameplayTagContainer& GetTags(FHktEntityId Entity) const = 0;
+    /** 태그 사본 - HktCore Stash는 비트셋으로 저장하므로 값으로 반환 (검사는 HasTag 계열 사용) */
+    virtual FGameplayTagContainer GetTags(FHktEntityId Entity) const = 0;
     virtual void SetTags(FHktEntityId Entity, const FGameplayTagContainer& Tags) = 0;
     virtual void AddTag(FHktEntityId Entity, const FGameplayTag& Tag) = 0;
     virtual void RemoveTag(FHktEntityId Entity, const FGameplayTag& Tag) = 0;
@@ -48,13 +111,37 @@ public:
     
     // ========== Frame Management ==========
     virtual int32 GetCompletedFrameNumber() const = 0;
+    
+    /** 프레임 종료 - 이번 프레임 변경을 변경 피드로 게시하고 더티 비트를 비움 */
     virtual void MarkFrameCompleted(int32 FrameNumber) = 0;
     
+    // ========== Change Feed ==========
+    /**
+     * 직전 MarkFrameCompleted 프레임에 바뀐 엔티티 (슬롯 인덱스 순, 엔티티당 한 항목)
+     * 다음 MarkFrameCompleted까지 유지 - 델타 복제/증분 저장/표시 갱신은 전체 순회 대신 이것을 사용
+     */
+    virtual const TArray<FHktEntityChange>& GetFrameChanges() const = 0;
+    
     // ========== Iteration ==========
     virtual void ForEachEntity(TFunctionRef<void(FHktEntityId)> Callback) const = 0;
     
     // ========== Checksum ==========
+    /** 증분 유지되는 상태 해시 기반 - O(1) (매 프레임 desync 검사용) */
     virtual uint32 CalculateChecksum() const = 0;
+    
+    /** 같은 값을 전체 재계산 (증분 해시 검증용, O(엔티티 × 할당된 열)) */
+    virtual uint32 CalculateFullChecksum() const = 0;
+    
+    /**
+     * 엔티티의 해시 그룹별 상태 해시 (모든 그룹·엔티티의 합 = 전체 상태 해시)
+     * 없는 엔티티는 모두 0 - FHktStashHashTree가 desync 위치 추적에 사용
+     */
+    virtual void GetEntityGroupHashes(FHktEntityId Entity, uint64 (&OutHashes)[HktHashGroup::Num]) const = 0;
+    
+    // ========== Direct Access (HktCore 내부) ==========
+    
+    /** 내장 SOA 저장소 - HktCore Stash 구현만 반환, 외부 구현은 nullptr (VM이 가상 호출 없이 읽는 데 사용) */
+    virtual const FHktStashBase* GetStorage() const { return nullptr; }
 };
 
 //=============================================================================
@@ -70,13 +157,8 @@ class HKTCORE_API IHktMasterStashInterface : public IHktStashInterface
 {
 public:
     // ========== Batch Operations ==========
-    struct FPendingWrite
-    {
-        FHktEntityId Entity;
-        uint16 PropertyId;
-        int32 Value;
-    };
-    virtual void ApplyWrites(const TArray<FPendingWrite>& Writes) = 0;
+    /** ApplyWrites는 IHktStashInterface에 있음 (위치 변경 시 셀 갱신 포함) */
+    using FPendingWrite = FHktPropertyWrite;
 
     // ========== Frame Validation ==========
     virtual bool ValidateEntityFrame(FHktEntityId Entity, int32 FrameNumber) const = 0;
@@ -92,6 +174,7 @@ public:
     virtual void SetPosition(FHktEntityId Entity, const FVector& Position) = 0;
 
     // ========== Partial Checksum ==========
+    /** 엔티티 집합의 상태 해시 합 (순서 무관) - 위치 추적은 FHktStashHashTree */
     virtual uint32 CalculatePartialChecksum(const TArray<FHktEntityId>& Entities) const = 0;
 
     // ========== Radius Query ==========
@@ -131,13 +214,8 @@ class HKTCORE_API IHktVisibleStashInterface : public IHktStashInterface
 {
 public:
     // ========== Batch Operations ==========
-    struct FPendingWrite
-    {
-        FHktEntityId Entity;
-        uint16 PropertyId;
-        int32 Value;
-    };
-    virtual void ApplyWrites(const TArray<FPendingWrite>& Writes) = 0;
+    /** ApplyWrites는 IHktStashInterface에 있음 */
+    using FPendingWrite = FHktPropertyWrite;
     
     // ========== Snapshot Sync ==========
     virtual void ApplyEntitySnapshot(const FHktEntitySnapshot& Snapshot) = 0;
@@ -170,6 +248,12 @@ public:
     
     /** 충돌 알림 (큐에 적재, Execute에서 일괄 처리) */
     virtual void NotifyCollision(FHktEntityId WatchedEntity, FHktEntityId HitEntity) = 0;
+    
+    /** 이동 완료 알림 (WaitMoveEnd 재개) */
+    virtual void NotifyMoveEnd(FHktEntityId Entity) = 0;
+    
+    /** 애니메이션 종료 알림 (WaitAnimEnd 재개) */
+    virtual void NotifyAnimEnd(FHktEntityId Entity) = 0;
 };
 
 //=============================================================================
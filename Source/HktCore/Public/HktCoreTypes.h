@@ -7,13 +7,26 @@
 #include "InstancedStruct.h"
 #include "HktCoreTypes.generated.h"
 
-/** 엔티티 식별자 (Stash 내 엔티티 인덱스) */
+/**
+ * 엔티티 식별자
+ *
+ * RawValue = (Generation << IndexBits) | Index
+ * - Index: Stash 슬롯 (하위 20비트, 최대 약 100만 엔티티)
+ * - Generation: 슬롯이 해제될 때마다 증가 (11비트, 부호 비트는 항상 0)
+ * 슬롯이 재사용되면 이전 ID는 세대가 달라 IsValidEntity에서 거부됩니다.
+ * 해당 슬롯의 첫 엔티티는 Generation 0이므로 RawValue == Index입니다.
+ */
 USTRUCT(BlueprintType)
 struct FHktEntityId
 {
     GENERATED_BODY()
 
 public:
+    static constexpr int32 IndexBits = 20;
+    static constexpr int32 IndexMask = (1 << IndexBits) - 1;
+    static constexpr int32 MaxIndex = 1 << IndexBits;
+    static constexpr int32 GenerationMask = (1 << (31 - IndexBits)) - 1;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Entity")
     int32 RawValue;
 
@@ -28,6 +41,17 @@ public:
 
     int32 GetValue() const { return RawValue; }
 
+    /** Stash 슬롯 인덱스 (배열 인덱싱은 항상 이것으로) */
+    constexpr int32 GetIndex() const { return RawValue & IndexMask; }
+
+    /** 슬롯 세대 */
+    constexpr int32 GetGeneration() const { return RawValue >> IndexBits; }
+
+    static constexpr FHktEntityId Make(int32 Index, int32 Generation)
+    {
+        return FHktEntityId(((Generation & GenerationMask) << IndexBits) | (Index & IndexMask));
+    }
+
     /** 1. 비교 연산자 (Comparison Operators) */
     // 동일성 검사
     FORCEINLINE bool operator==(const FHktEntityId& Other) const { return RawValue == Other.RawValue; }
@@ -0,0 +1,184 @@
+// Copyright Hkt Studios, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * HktFixedMath - 결정론 고정소수점 수학
+ *
+ * 시뮬레이션(VM, 충돌 판정)은 정수 cm 좌표를 쓰므로 float 없이 정수 연산만으로 계산합니다.
+ * 정수 덧셈/곱셈/시프트/나눗셈과 상수 테이블만 사용하므로 x86-64/ARM 등 플랫폼과
+ * 컴파일러 최적화(FMA 축약, x87 정밀도)에 관계없이 비트 단위로 같은 결과가 나옵니다.
+ *
+ * - FHktFixed: Q16.16 스칼라 (비율, 방향 성분, 각도 삼각함수 결과)
+ * - FHktFixedVector: Q16.16 벡터 (정규화된 방향 등)
+ * - HktMath: 정수 제곱근, cm 좌표 거리, 테이블 기반 Sin/Cos/Atan2
+ *
+ * 각도는 한 바퀴 = 65536인 이진 각도(HktMath::AngleFullTurn) 단위입니다.
+ * float 변환(ToFloat)은 표시/디버그 용도로만 사용하세요.
+ */
+
+// ============================================================================
+// FHktFixed - Q16.16
+// ============================================================================
+
+struct FHktFixed
+{
+    static constexpr int32 FracBits = 16;
+    static constexpr int32 OneRaw = 1 << FracBits;
+
+    int32 Raw = 0;
+
+    static constexpr FHktFixed FromRaw(int32 InRaw) { FHktFixed F; F.Raw = InRaw; return F; }
+    static constexpr FHktFixed FromInt(int32 Value) { return FromRaw(static_cast<int32>(static_cast<uint32>(Value) << FracBits)); }
+    static constexpr FHktFixed One() { return FromRaw(OneRaw); }
+
+    /** Num / Den (Den == 0이면 0, 0 방향 절사, |Num| < 2^47) */
+    static constexpr FHktFixed FromRatio(int64 Num, int64 Den)
+    {
+        return FromRaw(Den != 0 ? static_cast<int32>(Num * OneRaw / Den) : 0);
+    }
+
+    /** 내림 */
+    constexpr int32 FloorToInt() const { return Raw >> FracBits; }
+
+    /** 반올림 (0.5는 올림) */
+    constexpr int32 RoundToInt() const { return static_cast<int32>((static_cast<int64>(Raw) + (OneRaw >> 1)) >> FracBits); }
+
+    /** 표시용 - 시뮬레이션 경로에서 사용 금지 */
+    float ToFloat() const { return static_cast<float>(Raw) / OneRaw; }
+
+    constexpr FHktFixed operator-() const { return FromRaw(-Raw); }
+    constexpr FHktFixed operator+(FHktFixed Other) const { return FromRaw(Raw + Other.Raw); }
+    constexpr FHktFixed operator-(FHktFixed Other) const { return FromRaw(Raw - Other.Raw); }
+
+    /** 곱은 64비트 중간값 후 내림 시프트 */
+    constexpr FHktFixed operator*(FHktFixed Other) const
+    {
+        return FromRaw(static_cast<int32>((static_cast<int64>(Raw) * Other.Raw) >> FracBits));
+    }
+
+    /** 0으로 나누면 0 (VM Div와 동일한 규칙) */
+    constexpr FHktFixed operator/(FHktFixed Other) const
+    {
+        return FromRaw(Other.Raw != 0 ? static_cast<int32>(static_cast<int64>(Raw) * OneRaw / Other.Raw) : 0);
+    }
+
+    /** 정수 배 (시프트 없음) */
+    constexpr FHktFixed operator*(int32 Scalar) const { return FromRaw(Raw * Scalar); }
+
+    FHktFixed& operator+=(FHktFixed Other) { Raw += Other.Raw; return *this; }
+    FHktFixed& operator-=(FHktFixed Other) { Raw -= Other.Raw; return *this; }
+    FHktFixed& operator*=(FHktFixed Other) { *this = *this * Other; return *this; }
+
+    constexpr bool operator==(FHktFixed Other) const { return Raw == Other.Raw; }
+    constexpr bool operator!=(FHktFixed Other) const { return Raw != Other.Raw; }
+    constexpr bool operator<(FHktFixed Other) const { return Raw < Other.Raw; }
+    constexpr bool operator<=(FHktFixed Other) const { return Raw <= Other.Raw; }
+    constexpr bool operator>(FHktFixed Other) const { return Raw > Other.Raw; }
+    constexpr bool operator>=(FHktFixed Other) const { return Raw >= Other.Raw; }
+};
+
+// ============================================================================
+// FHktFixedVector - Q16.16 벡터
+// ============================================================================
+
+struct FHktFixedVector
+{
+    FHktFixed X, Y, Z;
+
+    static constexpr FHktFixedVector Zero() { return FHktFixedVector(); }
+
+    /** 정수 벡터를 그대로 Q16.16으로 (각 성분 ±32767 이내) */
+    static FHktFixedVector FromIntVector(const FIntVector& V)
+    {
+        return { FHktFixed::FromInt(V.X), FHktFixed::FromInt(V.Y), FHktFixed::FromInt(V.Z) };
+    }
+
+    FHktFixedVector operator+(const FHktFixedVector& O) const { return { X + O.X, Y + O.Y, Z + O.Z }; }
+    FHktFixedVector operator-(const FHktFixedVector& O) const { return { X - O.X, Y - O.Y, Z - O.Z }; }
+    FHktFixedVector operator-() const { return { -X, -Y, -Z }; }
+    FHktFixedVector operator*(FHktFixed S) const { return { X * S, Y * S, Z * S }; }
+
+    bool operator==(const FHktFixedVector& O) const { return X == O.X && Y == O.Y && Z == O.Z; }
+    bool operator!=(const FHktFixedVector& O) const { return !(*this == O); }
+
+    /** 내적 - 곱의 합을 64비트로 누적한 뒤 한 번만 시프트 */
+    static FHktFixed Dot(const FHktFixedVector& A, const FHktFixedVector& B)
+    {
+        const int64 Sum = static_cast<int64>(A.X.Raw) * B.X.Raw
+                        + static_cast<int64>(A.Y.Raw) * B.Y.Raw
+                        + static_cast<int64>(A.Z.Raw) * B.Z.Raw;
+        return FHktFixed::FromRaw(static_cast<int32>(Sum >> FHktFixed::FracBits));
+    }
+
+    /** 길이² (Raw², Q32.32) */
+    uint64 LengthSquaredRaw() const;
+
+    FHktFixed Length() const;
+
+    /** 길이 0이면 Zero */
+    FHktFixedVector GetSafeNormal() const;
+
+    /** 표시용 - 시뮬레이션 경로에서 사용 금지 */
+    FVector ToVector() const { return FVector(X.ToFloat(), Y.ToFloat(), Z.ToFloat()); }
+};
+
+// ============================================================================
+// HktMath - 정수/고정소수점 함수
+// ============================================================================
+
+namespace HktMath
+{
+    /** 이진 각도 단위: 한 바퀴 = 65536 */
+    constexpr int32 AngleFullTurn = 65536;
+    constexpr int32 AngleHalfTurn = AngleFullTurn / 2;
+    constexpr int32 AngleQuarterTurn = AngleFullTurn / 4;
+
+    /** floor(sqrt(V)) - 비트 단위 정수 제곱근 */
+    HKTCORE_API uint64 SqrtU64(uint64 V);
+
+    /** Q16.16 제곱근 (음수는 0) */
+    HKTCORE_API FHktFixed Sqrt(FHktFixed V);
+
+    /** cm 좌표 거리² (int32 차이도 넘치지 않도록 uint64, 합은 포화) */
+    HKTCORE_API uint64 DistanceSquared(const FIntVector& A, const FIntVector& B);
+
+    /** cm 좌표 거리 (내림, INT32_MAX 포화) */
+    HKTCORE_API int32 Distance(const FIntVector& A, const FIntVector& B);
+
+    /** 도 → 이진 각도 (0 방향 절사) */
+    constexpr int32 DegreesToAngle(int32 Degrees) { return static_cast<int32>(static_cast<int64>(Degrees) * AngleFullTurn / 360); }
+
+    /** 1/4 파 테이블(256구간) + 선형 보간 - 임의의 int32 각도 (한 바퀴 주기) */
+    HKTCORE_API FHktFixed Sin(int32 Angle);
+    HKTCORE_API FHktFixed Cos(int32 Angle);
+
+    /** (X, Y) 방향의 각도 [-AngleHalfTurn, AngleHalfTurn] - 원점이면 0 */
+    HKTCORE_API int32 Atan2(int32 Y, int32 X);
+}
+
+inline uint64 FHktFixedVector::LengthSquaredRaw() const
+{
+    // |Raw| < 2^31 → 제곱 < 2^62, 세 성분 합 < 2^64
+    auto Sq = [](FHktFixed F) { const int64 R = F.Raw; return static_cast<uint64>(R * R); };
+    return Sq(X) + Sq(Y) + Sq(Z);
+}
+
+inline FHktFixed FHktFixedVector::Length() const
+{
+    // sqrt(Raw²)는 곧 길이의 Raw
+    return FHktFixed::FromRaw(static_cast<int32>(FMath::Min<uint64>(HktMath::SqrtU64(LengthSquaredRaw()), INT32_MAX)));
+}
+
+inline FHktFixedVector FHktFixedVector::GetSafeNormal() const
+{
+    const int64 Len = Length().Raw;
+    if (Len == 0)
+    {
+        return Zero();
+    }
+    auto Div = [Len](FHktFixed F) { return FHktFixed::FromRaw(static_cast<int32>(static_cast<int64>(F.Raw) * FHktFixed::OneRaw / Len)); };
+    return { Div(X), Div(Y), Div(Z) };
+}
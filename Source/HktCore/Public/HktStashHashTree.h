@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HktCoreInterfaces.h"
+
+/**
+ * FHktStashHashTree - Stash 상태의 Merkle 요약 (desync 위치 추적)
+ *
+ * 프레임 체크섬이 어긋났을 때 어느 엔티티의 어느 해시 그룹이 다른지
+ * 전체 상태를 보내지 않고 찾기 위한 트리입니다.
+ *
+ * 모양은 엔티티 인덱스 공간에 고정 (팬아웃 16):
+ *   Level 0 (루트) ~ Level 5 (엔티티 한 슬롯) = 인덱스 범위, Level 6 = 엔티티의 해시 그룹
+ * 노드 해시 = 범위 안 리프 해시의 합 (64비트 wrap) - 전체 엔티티로 만든 루트 = Stash 상태 해시
+ *
+ * 노드는 저장하지 않고 인덱스 순 정렬된 리프의 누적합에서 이진 탐색으로 계산합니다.
+ * 빌드 O(N log N), 노드 질의 O(log N).
+ *
+ * 사용 (Master = 서버, Visible = 클라이언트):
+ *   1. 양쪽이 같은 엔티티 집합으로 Build (클라이언트는 자신이 가진 전체 엔티티)
+ *   2. 클라이언트 Query = { GetRootNode() }
+ *   3. 서버 AnswerQuery(Query) → 해시 배열, 클라이언트 Compare → 다음 Query + Desync
+ *   4. Query가 빌 때까지 반복 (최대 MaxLevel + 1 왕복, 왕복당 불일치 노드 × 16개)
+ */
+
+/** 트리 노드 식별자 - Level 0..5는 인덱스 범위, Level 6은 (엔티티 슬롯, 해시 그룹) */
+struct FHktHashNodeId
+{
+    int32 Index = 0;        // 범위 시작 인덱스 >> (해당 Level의 Shift)
+    uint8 Level = 0;
+    uint8 Group = 0;        // Level 6에서만 사용 (HktHashGroup)
+
+    bool operator==(const FHktHashNodeId& Other) const
+    {
+        return Index == Other.Index && Level == Other.Level && Group == Other.Group;
+    }
+};
+
+/** 불일치 엔티티 - 슬롯과 다른 해시 그룹 (HktHashGroup 비트) */
+struct FHktEntityDesync
+{
+    int32 SlotIndex = INDEX_NONE;
+    FHktEntityId LocalEntity = InvalidEntityId;     // 로컬에 없으면 Invalid
+    uint32 GroupMask = 0;
+};
+
+class HKTCORE_API FHktStashHashTree
+{
+public:
+    static constexpr int32 FanoutBits = 4;
+    static constexpr int32 Fanout = 1 << FanoutBits;
+    static constexpr uint8 EntityLevel = FHktEntityId::IndexBits / FanoutBits;    // 5
+    static constexpr uint8 GroupLevel = EntityLevel + 1;                         // 6
+    static constexpr uint8 MaxLevel = GroupLevel;
+
+    static_assert(FHktEntityId::IndexBits % FanoutBits == 0, "인덱스 비트는 팬아웃 비트의 배수");
+
+    /** Entities의 현재 상태로 리프 구성 (무효 엔티티는 제외) */
+    void Build(const IHktStashInterface& Stash, const TArray<FHktEntityId>& Entities);
+
+    /** Stash의 전체 엔티티로 구성 - 루트 해시 = Stash 상태 해시 */
+    void BuildAll(const IHktStashInterface& Stash);
+
+    void Reset();
+
+    static FHktHashNodeId GetRootNode() { return FHktHashNodeId(); }
+    uint64 GetRootHash() const { return GetNodeHash(GetRootNode()); }
+    int32 GetNumLeaves() const { return LeafIndices.Num(); }
+
+    /** 노드 해시 (범위 안 리프가 없으면 0) */
+    uint64 GetNodeHash(const FHktHashNodeId& Node) const;
+
+    /** 서버 측 - Query 순서대로 노드 해시 */
+    void AnswerQuery(const TArray<FHktHashNodeId>& Query, TArray<uint64>& OutHashes) const;
+
+    /**
+     * 클라이언트 측 - 서버 해시와 비교
+     * 다른 범위 노드는 자식 16개(엔티티 노드는 해시 그룹)를 OutNextQuery에 넣고,
+     * 다른 그룹 노드는 슬롯별로 모아 OutDesyncs에 추가합니다.
+     */
+    void Compare(const TArray<FHktHashNodeId>& Query, const TArray<uint64>& RemoteHashes,
+                 TArray<FHktHashNodeId>& OutNextQuery, TArray<FHktEntityDesync>& OutDesyncs) const;
+
+    /** 같은 프로세스 안의 두 트리를 끝까지 비교 (테스트/서버 리플레이 검증용) */
+    static void FindDesyncs(const FHktStashHashTree& Local, const FHktStashHashTree& Remote, TArray<FHktEntityDesync>& OutDesyncs);
+
+private:
+    static int32 GetLevelShift(uint8 Level) { return FHktEntityId::IndexBits - Level * FanoutBits; }
+
+    /** SlotIndex 이상인 첫 리프 위치 */
+    int32 FindLeaf(int32 SlotIndex) const;
+
+    // 인덱스 순 리프
+    TArray<int32> LeafIndices;
+    TArray<int32> LeafEntities;                         // RawValue
+    TArray<uint64> LeafGroupHashes;                     // 리프당 HktHashGroup::Num개
+    TArray<uint64> PrefixHashes;                        // Num + 1, PrefixHashes[i] = 앞 i개 리프 해시 합
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * HKT_VM_TRACE - 바이너리 트레이스 링 컴파일 스위치
+ *
+ * 기본 활성 (Shipping 포함). 기록 비용은 스레드 로컬 링에 16바이트 저장 1회이며
+ * 할당/문자열 포맷이 없습니다. 런타임에는 FHktVMTrace::SetEnabled로 끌 수 있습니다.
+ */
+#ifndef HKT_VM_TRACE
+#define HKT_VM_TRACE 1
+#endif
+
+// ============================================================================
+// 트레이스 이벤트
+// ============================================================================
+
+/** 레코드 종류 - 값은 덤프 포맷의 일부이므로 끝에만 추가 */
+enum class EHktVMTraceEvent : uint8
+{
+    None = 0,
+
+    // Frame / VM 수명 (VM 필드 = 슬롯 인덱스)
+    FrameBegin,             // A: 새 Intent 수, B: 활성 VM 수
+    FrameEnd,               // A: 완료된 VM 수, B: 활성 VM 수
+    VMCreated,              // A: SourceEntity, B: EventId
+    VMFinalized,            // A: 1 = Completed / 0 = Failed, B: 마지막 PC
+    VMTick,                 // A: PC, B: EVMStatus
+    AdmissionDeferred,      // A: 미뤄진 Intent 수, B: 활성 VM 수
+
+    // VM 액션 (A, B는 이벤트별 인자)
+    SpawnEntity,            // A: Owner, B: 문자열 인덱스
+    DestroyEntity,          // A: Entity
+    MoveToward,             // A: Entity, B: Speed
+    MoveForward,            // A: Entity, B: Speed
+    StopMovement,           // A: Entity
+    FindInRadius,           // A: Center, B: 검색된 수
+    ApplyDamage,            // A: Entity, B: Damage
+    ApplyEffect,            // A: Entity, B: 문자열 인덱스
+    RemoveEffect,           // A: Entity, B: 문자열 인덱스
+    PlayAnim,               // A: Entity, B: 문자열 인덱스
+    PlayAnimMontage,        // A: Entity, B: 문자열 인덱스
+    StopAnim,               // A: Entity
+    PlayVFX,                // A: 위치 X, B: 문자열 인덱스
+    PlayVFXAttached,        // A: Entity, B: 문자열 인덱스
+    PlaySound,              // B: 문자열 인덱스
+    PlaySoundAtLocation,    // A: 위치 X, B: 문자열 인덱스
+    SpawnEquipment,         // A: Owner, B: Slot
+    Log,                    // B: 문자열 인덱스
+    FindNearest,            // A: Center, B: 검색된 수
+
+    Max
+};
+
+/** 16바이트 고정 레코드 */
+struct FHktVMTraceRecord
+{
+    int32 Frame = 0;
+    uint32 Event : 8;
+    uint32 VM : 24;         // VM 슬롯 인덱스 (FHktVMHandle::Index, 0xFFFFFF = 없음)
+    int32 A = 0;
+    int32 B = 0;
+
+    FHktVMTraceRecord() : Event(0), VM(0xFFFFFF) {}
+
+    EHktVMTraceEvent GetEvent() const { return static_cast<EHktVMTraceEvent>(Event); }
+};
+
+static_assert(sizeof(FHktVMTraceRecord) == 16, "Trace record must be 16 bytes");
+
+/** 디코드된 레코드 (스레드 구분 포함) */
+struct FHktVMTraceEntry
+{
+    uint32 ThreadId = 0;
+    uint64 Sequence = 0;    // 해당 스레드 링에서의 기록 순번
+    FHktVMTraceRecord Record;
+};
+
+// ============================================================================
+// FHktVMTrace - 스레드별 고정 크기 링 버퍼
+// ============================================================================
+
+/**
+ * 각 스레드는 처음 기록할 때 RecordsPerThread개짜리 링을 한 번 할당받고,
+ * 이후 기록은 가장 오래된 레코드를 덮어쓰며 할당하지 않습니다.
+ *
+ * Dump/Reset은 워커가 기록하지 않는 시점(게임 스레드, Tick 사이)에 호출합니다.
+ * 덤프는 오프라인에서 Decode/FormatTimeline으로 프레임 순 타임라인으로 변환합니다.
+ */
+class HKTCORE_API FHktVMTrace
+{
+public:
+    /** 스레드당 레코드 수 (2의 거듭제곱, 16바이트 × 16384 = 256KB) */
+    static constexpr int32 RecordsPerThread = 1 << 14;
+
+    /** 덤프 포맷 */
+    static constexpr uint32 DumpMagic = 0x54544B48;    // 'HKTT'
+    static constexpr uint16 DumpVersion = 1;
+
+    static void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+    static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+
+    /** 이후 레코드에 찍힐 로직 프레임 (게임 스레드에서 Tick 시작 시) */
+    static void SetFrame(int32 Frame) { CurrentFrame.store(Frame, std::memory_order_relaxed); }
+
+    /** 현재 스레드의 링에 레코드 추가 (현재 스레드가 억제 중이면 무시) */
+    static void Write(EHktVMTraceEvent Event, uint32 VM, int32 A = 0, int32 B = 0);
+
+    /**
+     * 범위 안에서 현재 스레드의 기록을 억제 (중첩 가능)
+     * 게임 상태에 반영되지 않는 실행(네이티브 검증의 기준 실행 등)이 타임라인에 섞이지 않도록
+     */
+    struct HKTCORE_API FScopedSuppress
+    {
+        FScopedSuppress();
+        ~FScopedSuppress();
+    };
+
+    /** 모든 스레드 링을 오래된 순서로 직렬화 */
+    static void Dump(TArray<uint8>& OutData);
+    static bool DumpToFile(const FString& FilePath);
+
+    /** 모든 링 비우기 (링 메모리는 유지) */
+    static void Reset();
+
+    // ========== 디코더 ==========
+
+    /** 덤프 → 레코드 (프레임, 스레드, 순번 순 정렬). 포맷이 다르면 false */
+    static bool Decode(const TArray<uint8>& Data, TArray<FHktVMTraceEntry>& OutEntries);
+
+    /** 덤프 → 사람이 읽는 프레임별 타임라인 */
+    static FString FormatTimeline(const TArray<uint8>& Data);
+
+    static const TCHAR* GetEventName(EHktVMTraceEvent Event);
+
+private:
+    static std::atomic<bool> bEnabled;
+    static std::atomic<int32> CurrentFrame;
+};
+
+// ============================================================================
+// 기록 매크로
+// ============================================================================
+
+#if HKT_VM_TRACE
+    #define HKT_VM_TRACE_EVENT(Event, VM, A, B) \
+        do { if (FHktVMTrace::IsEnabled()) { FHktVMTrace::Write(EHktVMTraceEvent::Event, (VM), (A), (B)); } } while (0)
+    #define HKT_VM_TRACE_FRAME(Frame) \
+        FHktVMTrace::SetFrame(Frame)
+#else
+    #define HKT_VM_TRACE_EVENT(Event, VM, A, B)
+    #define HKT_VM_TRACE_FRAME(Frame)
+#endif
@@ -93,3 +93,19 @@ void UHktVMProcessorComponent::NotifyCollision(FHktEntityId WatchedEntity, FHktE
         VMProcessor->NotifyCollision(WatchedEntity, HitEntity);
     }
 }
+
+void UHktVMProcessorComponent::NotifyMoveEnd(FHktEntityId Entity)
+{
+    if (VMProcessor)
+    {
+        VMProcessor->NotifyMoveEnd(Entity);
+    }
+}
+
+void UHktVMProcessorComponent::NotifyAnimEnd(FHktEntityId Entity)
+{
+    if (VMProcessor)
+    {
+        VMProcessor->NotifyAnimEnd(Entity);
+    }
+}
@@ -50,6 +50,12 @@ public:
     /** 충돌 알림 */
     void NotifyCollision(FHktEntityId WatchedEntity, FHktEntityId HitEntity);
     
+    /** 이동 완료 알림 */
+    void NotifyMoveEnd(FHktEntityId Entity);
+    
+    /** 애니메이션 종료 알림 */
+    void NotifyAnimEnd(FHktEntityId Entity);
+    
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;